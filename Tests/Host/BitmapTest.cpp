@@ -0,0 +1,277 @@
+/*
+ * BitmapTest.cpp
+ *
+ * Checks the bitmap drawing functions of UTFT in all 32 combinations of the orientation flags:
+ * - drawCompressedBitmap puts every run where a simple decode of the data says it should go
+ * - drawPalettedBitmap draws each icon exactly as drawBitmap draws the uncompressed icon it was made from, opaque and transparent
+ * - the rotating drawBitmap matches a floating point inverse mapping, exactly at multiples of 90 degrees
+ * - with UTFT_READBACK, readCompressedBitmap followed by drawCompressedBitmap restores an area exactly
+ * It prints the number of bus writes for each in landscape orientation.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "SimDisplay.hpp"
+#include "RawIcons.hpp"
+
+using HostTest::Check;
+
+const uint16_t background = 0x1234;
+
+static void InitOrientation(unsigned int flags)
+{
+	SimDisplay::Init((DisplayOrientation)flags);
+	SimDisplay::Fill(background);
+}
+
+// Return the number of pixels that differ from 'expected' inside the area, plus the number that are not the background outside it
+static unsigned int CountWrongPixels(int x, int y, int w, int h, const std::vector<uint16_t>& expected)
+{
+	unsigned int wrong = 0;
+	for (int py = 0; py < SimDisplay::GetHeight(); ++py)
+	{
+		for (int px = 0; px < SimDisplay::GetWidth(); ++px)
+		{
+			const bool inside = px >= x && px < x + w && py >= y && py < y + h;
+			if (SimDisplay::GetPixel(px, py) != ((inside) ? expected[(py - y) * w + (px - x)] : background))
+			{
+				++wrong;
+			}
+		}
+	}
+	return wrong;
+}
+
+static void TestCompressedBitmaps()
+{
+	srand(1);
+	unsigned int failures = 0;
+	for (unsigned int flags = 0; flags < 32; ++flags)
+	{
+		InitOrientation(flags);
+		for (int trial = 0; trial < 20; ++trial)
+		{
+			// Random runs, stored by columns as drawCompressedBitmap expects
+			const int w = 1 + rand() % 60, h = 1 + rand() % 60;
+			const int x = rand() % (SimDisplay::GetWidth() - w), y = rand() % (SimDisplay::GetHeight() - h);
+			std::vector<uint16_t> data, expected(w * h);
+			for (int i = 0; i < w * h; )
+			{
+				int run = 1 + ((rand() % 4 == 0) ? rand() % (3 * h) : rand() % 5);
+				if (run > w * h - i)
+				{
+					run = w * h - i;
+				}
+				const uint16_t colour = rand() & 0xFFFF;
+				data.push_back(run - 1);
+				data.push_back(colour);
+				for (; run != 0; --run, ++i)
+				{
+					expected[(i % h) * w + (i / h)] = colour;
+				}
+			}
+			SimDisplay::Fill(background);
+			lcd.drawCompressedBitmap(x, y, w, h, data.data());
+			if (CountWrongPixels(x, y, w, h, expected) != 0)
+			{
+				++failures;
+			}
+		}
+	}
+	Check(failures == 0 && SimDisplay::GetErrors() == 0, "drawCompressedBitmap: %u misplaced bitmaps", failures);
+
+	// A full-screen image with a mixture of long and short runs
+	for (DisplayOrientation o : { Landscape, InvLandscape, Portrait, InvPortrait })
+	{
+		InitOrientation(o);
+		const int total = SimDisplay::GetWidth() * SimDisplay::GetHeight();
+		std::vector<uint16_t> data;
+		for (int i = 0; i < total; )
+		{
+			int run = (rand() % 8 == 0) ? 1 + rand() % 2000 : 1 + rand() % 8;
+			if (run > total - i)
+			{
+				run = total - i;
+			}
+			data.push_back(run - 1);
+			data.push_back(rand());
+			i += run;
+		}
+		lcd.drawCompressedBitmap(0, 0, SimDisplay::GetWidth(), SimDisplay::GetHeight(), data.data());
+		printf("drawCompressedBitmap full screen, orientation 0x%02x: %u runs, %u bus writes\n", (unsigned int)o, (unsigned int)data.size()/2, SimDisplay::TakeBusWrites());
+	}
+}
+
+static void TestIcons()
+{
+	unsigned int failures = 0;
+	for (unsigned int flags = 0; flags < 32; ++flags)
+	{
+		for (int transparent = 0; transparent < 2; ++transparent)
+		{
+			for (size_t i = 0; i < numIconPairs; ++i)
+			{
+				const IconPair& icon = iconPairs[i];
+				const int w = icon.compressed[0], h = icon.compressed[1], x = 100 + i, y = 50 + flags;
+				if (!Check(icon.raw[0] == w && icon.raw[1] == h, "%s: compressed icon is %dx%d but raw icon is %dx%d", icon.name, w, h, icon.raw[0], icon.raw[1]))
+				{
+					continue;
+				}
+
+				InitOrientation(flags);
+				lcd.setTransparentBackground(transparent);
+				lcd.drawPalettedBitmap(x, y, w, h, icon.compressed + 2);
+				const uint32_t palettedWrites = SimDisplay::TakeBusWrites();
+				const std::vector<uint16_t> paletted = SimDisplay::GetFrame();
+
+				SimDisplay::Fill(background);
+				lcd.drawBitmap(x, y, w, h, icon.raw + 2);
+				const uint32_t rawWrites = SimDisplay::TakeBusWrites();
+				if (SimDisplay::GetFrame() != paletted)
+				{
+					++failures;
+					printf("%s differs in orientation 0x%02x%s\n", icon.name, flags, (transparent) ? " with transparent background" : "");
+				}
+				if (flags == Landscape)
+				{
+					printf("%-14s %2dx%2d %s: paletted %5u, raw %5u bus writes\n", icon.name, w, h, (transparent) ? "transparent" : "opaque     ", palettedWrites, rawWrites);
+				}
+			}
+		}
+	}
+	lcd.setTransparentBackground(false);
+	Check(failures == 0 && SimDisplay::GetErrors() == 0, "drawPalettedBitmap: %u icons differ from drawBitmap", failures);
+}
+
+static void TestRotation()
+{
+	const int w = 37, h = 23, centreX = 11, centreY = 7, x = 200, y = 100;
+	std::vector<uint16_t> bitmap(w * h);
+	srand(3);
+	for (uint16_t& p : bitmap)
+	{
+		p = rand() & 0xFFFF;
+	}
+	for (int i = 0; i < 10; ++i)
+	{
+		bitmap[i] = 0x5555;										// a run of the same colour
+	}
+
+	unsigned int failures = 0;
+	for (int degrees : { 90, 180, 270, -90, 30, 45, 123, 1, 359, 450 })
+	{
+		std::vector<uint16_t> first;
+		for (unsigned int flags = 0; flags < 32; ++flags)
+		{
+			InitOrientation(flags);
+			lcd.drawBitmap(x, y, w, h, bitmap.data(), degrees, centreX, centreY);
+			const uint32_t writes = SimDisplay::TakeBusWrites();
+
+			// Compare with a floating point inverse mapping of each pixel in an area that includes the rotated bitmap
+			unsigned int wrong = 0, covered = 0;
+			const double a = degrees * M_PI/180.0, c = cos(a), s = sin(a);
+			std::vector<uint16_t> area;
+			for (int py = 0; py < y + 200; ++py)
+			{
+				for (int px = 0; px < x + 200; ++px)
+				{
+					const double u = px - (x + centreX), v = py - (y + centreY);
+					const double fx = centreX + u * c + v * s + 0.5, fy = centreY - u * s + v * c + 0.5;
+					const bool inside = fx >= 0 && fx < w && fy >= 0 && fy < h;
+					const uint16_t pixel = SimDisplay::GetPixel(px, py);
+					if (inside)
+					{
+						++covered;
+					}
+					if (pixel != ((inside) ? bitmap[(int)fy * w + (int)fx] : background))
+					{
+						++wrong;
+					}
+					area.push_back(pixel);
+				}
+			}
+
+			if (flags == 0)
+			{
+				first = area;
+			}
+			else if (area != first)
+			{
+				++failures;
+				printf("rotation %d, orientation 0x%02x: differs from orientation 0\n", degrees, flags);
+			}
+			if ((degrees % 90 == 0 && wrong != 0) || wrong * 50 > covered)
+			{
+				++failures;
+				printf("rotation %d, orientation 0x%02x: %u of %u pixels differ from reference\n", degrees, flags, wrong, covered);
+			}
+			if (flags == Landscape)
+			{
+				printf("rotation %4d: %3u of %u pixels differ from floating point reference, %u bus writes (per-pixel windows: %d)\n",
+						degrees, wrong, covered, writes, w * h * 12);
+			}
+		}
+	}
+	Check(failures == 0 && SimDisplay::GetErrors() == 0, "rotated drawBitmap: %u failures", failures);
+}
+
+#ifdef UTFT_READBACK
+
+static void TestReadback()
+{
+	static uint16_t buffer[200000];
+	unsigned int failures = 0;
+	srand(2);
+	for (unsigned int flags = 0; flags < 32; ++flags)
+	{
+		InitOrientation(flags);
+		for (int y = 0; y < SimDisplay::GetHeight(); ++y)
+		{
+			for (int x = 0; x < SimDisplay::GetWidth(); ++x)
+			{
+				SimDisplay::SetPixel(x, y, (rand() % 16 == 0) ? rand() % 4 : (y / 8) % 4);
+			}
+		}
+		for (int trial = 0; trial < 20; ++trial)
+		{
+			const int w = 1 + rand() % 200, h = 1 + rand() % 200;
+			const int x = rand() % (SimDisplay::GetWidth() - w), y = rand() % (SimDisplay::GetHeight() - h);
+			const std::vector<uint16_t> before = SimDisplay::GetFrame();
+			const size_t len = lcd.readCompressedBitmap(x, y, w, h, buffer, sizeof(buffer)/sizeof(buffer[0]));
+			size_t total = 0;
+			for (size_t i = 0; i < len; i += 2)
+			{
+				total += buffer[i] + 1;
+			}
+			lcd.setColor(0x7777);
+			lcd.fillRect(x, y, x + w - 1, y + h - 1);
+			lcd.drawCompressedBitmap(x, y, w, h, buffer);
+			if (len == 0 || total != (size_t)(w * h) || SimDisplay::GetFrame() != before)
+			{
+				++failures;
+			}
+		}
+		if (lcd.readCompressedBitmap(0, 0, 100, 100, buffer, 4) != 0)
+		{
+			++failures;						// it should report that the buffer is too small
+		}
+	}
+	Check(failures == 0 && SimDisplay::GetErrors() == 0, "readCompressedBitmap: %u failed round trips", failures);
+}
+
+#endif
+
+int main(int argc, char **argv)
+{
+	TestCompressedBitmaps();
+	TestIcons();
+	TestRotation();
+#ifdef UTFT_READBACK
+	TestReadback();
+#endif
+	return HostTest::Result();
+}
+
+// End
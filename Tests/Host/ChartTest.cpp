@@ -0,0 +1,89 @@
+/*
+ * ChartTest.cpp
+ *
+ * Checks the temperature chart: adding a sample costs about the same however many samples have been added, and at intervals while the
+ * chart fills up and wraps round, drawing it a sample at a time gives the same frame as redrawing it completely.
+ * It prints the smallest and largest number of bus writes for adding a sample, and the number for redrawing the whole chart.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include "SimDisplay.hpp"
+#include "Display.hpp"
+#include "RefreshCheck.hpp"
+
+using HostTest::Check;
+
+extern const uint8_t glcd19x21[];
+
+static const DisplayStyle styles[] =
+{
+	{ COLOUR_ROLE(chartGridColour), COLOUR_ROLE(popupInfoBackColour) }
+};
+
+const unsigned int numSamples = 225, numSeries = 3;
+static uint8_t samples[numSamples * numSeries * 2];
+static const Colour seriesColours[numSeries] = { UTFT::fromRGB(255, 0, 0), UTFT::fromRGB(0, 128, 255), UTFT::fromRGB(0, 160, 0) };
+static const char * const seriesNames[numSeries] = { "Bed", "1", "2" };
+
+static MainWindow mgr;
+
+int main(int argc, char **argv)
+{
+	SimDisplay::Init(Landscape);
+	DisplayField::SetDefaultFont(glcd19x21);
+	DisplayField::SetStyles(styles);
+	DisplayField::SetColourScheme(colourSchemes[0]);
+	mgr.Init(colourSchemes[0].defaultBackColour);
+
+	ChartField *chart = new ChartField(50, 60, 380, numSamples, 3, numSeries, samples, seriesColours, seriesNames, 300, 50);
+	mgr.AddField(chart);
+	mgr.Refresh(true);
+	printf("%-36s %7u bus writes\n", "clear screen and draw empty chart", SimDisplay::TakeBusWrites());
+
+	// A bed and a tool heating up, and another tool that is only in use for a while, so that series start and stop and the legend changes
+	uint32_t minWrites = UINT32_MAX, maxWrites = 0;
+	for (int t = 0; t < 600; ++t)
+	{
+		chart->SetValue(0, 20 + 40 * (1 - exp(-t / 30.0)));
+		chart->SetTarget(0, 60);
+		if (t > 20)
+		{
+			chart->SetValue(1, 20 + 190 * (1 - exp(-(t - 20) / 40.0)) + 3 * sin(t / 3.0));
+			chart->SetTarget(1, (t < 400) ? 210 : 150);
+		}
+		if (t > 100 && t < 500)
+		{
+			chart->SetValue(2, 22 + t / 10.0);
+		}
+		chart->AddSample();
+
+		if (t % 97 == 0 || t == 599)
+		{
+			char name[40];
+			snprintf(name, sizeof(name), "sample %d", t);
+			RefreshCheck::Step(mgr, name);
+		}
+		else
+		{
+			mgr.Refresh(false);
+			const uint32_t writes = SimDisplay::TakeBusWrites();
+			if (t > 110)										// after the last series has appeared in the legend
+			{
+				minWrites = std::min(minWrites, writes);
+				maxWrites = std::max(maxWrites, writes);
+			}
+		}
+	}
+	printf("%-36s %7u to %u bus writes\n", "add a sample", minWrites, maxWrites);
+	mgr.Refresh(true);
+	const uint32_t fullWrites = SimDisplay::TakeBusWrites();
+	printf("%-36s %7u bus writes\n", "full chart", fullWrites);
+	Check(maxWrites * 50 < fullWrites, "adding a sample costs more than 1/50 of redrawing the chart");
+
+	SimDisplay::CheckImage("Chart", 50, 40, 400, 250);
+	return HostTest::Result();
+}
+
+// End
@@ -0,0 +1,273 @@
+/*
+ * DmaBufferTest.cpp
+ *
+ * Checks the serial receive buffer against a simulated UART PDC, which fills the blocks that it is given and moves on to the queued block
+ * when one is full, setting ENDRX. The simulated ISR queues the next block as receiveBlockDone does, and the main loop reads the data as
+ * CheckInput does:
+ * - a stream several times the size of the buffer arrives in bursts of different sizes, some ending with the ISR still pending, and is read
+ *   back exactly as it was sent
+ * - GetData reports an overrun when the reader is more than (numBlocks - 1) blocks behind, and not when it is exactly that far behind, and data
+ *   handed out at that limit is not overwritten while the PDC fills one more block
+ * - GetToken returns a pointer into the buffer for a token that doesn't reach the end of the buffer, and a copy truncated to fit the scratch
+ *   buffer for one that wraps round it
+ * - reading the number of characters written is right wherever the PDC finishes a block relative to the register reads in CheckInput
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include "SimDisplay.hpp"
+#include "Library/DmaReceiveBuffer.hpp"
+
+using HostTest::Check;
+
+const size_t blockSize = DmaReceiveBuffer::blockSize;
+const size_t bufferSize = DmaReceiveBuffer::bufferSize;
+
+static DmaReceiveBuffer rxBuffer;
+
+// The receive half of the UART PDC
+class SimPdc
+{
+public:
+	// As SerialIo::Init
+	void Start()
+	{
+		rxBuffer.Reset();
+		rpr = rxBuffer.GetBlock(0);
+		rcr = blockSize;
+		rnpr = rxBuffer.GetBlock(1);
+		rncr = blockSize;
+		endrx = false;
+		lost = 0;
+	}
+
+	// Store a received character. When the current block is full the PDC sets ENDRX and moves on to the queued block, if there is one.
+	void Receive(char c)
+	{
+		if (rcr == 0)
+		{
+			++lost;
+			return;
+		}
+		*rpr++ = c;
+		if (--rcr == 0)
+		{
+			endrx = true;
+			if (rncr != 0)
+			{
+				rpr = rnpr;
+				rcr = rncr;
+				rncr = 0;
+			}
+		}
+	}
+
+	// As UART1_Handler and SerialIo::receiveBlockDone
+	void Interrupt()
+	{
+		if (endrx)
+		{
+			rnpr = rxBuffer.BlockDone();
+			rncr = blockSize;
+			endrx = false;
+		}
+	}
+
+	size_t GetRcr() const { return rcr; }
+	bool GetEndrx() const { return endrx; }
+	unsigned int GetLost() const { return lost; }
+
+private:
+	char * array rpr;
+	size_t rcr;
+	char * array rnpr;
+	size_t rncr;
+	bool endrx;
+	unsigned int lost;
+};
+
+static SimPdc pdc;
+static std::string sent;
+
+static char NextChar()
+{
+	const char c = (char)('!' + (sent.size() * 7 + sent.size() / 97) % 90);
+	sent += c;
+	return c;
+}
+
+// Receive some characters. If 'isr' is true then the ISR runs as soon as the PDC sets ENDRX, else it stays pending.
+static void ReceiveChars(size_t n, bool isr = false)
+{
+	while (n-- != 0)
+	{
+		pdc.Receive(NextChar());
+		if (isr)
+		{
+			pdc.Interrupt();
+		}
+	}
+}
+
+// Get the number of characters written as CheckInput does with interrupts disabled. The PDC receives 'extra' characters just before
+// register read number 'when', so that the end of a block can fall between any two of the reads.
+static uint32_t GetBytesWritten(int when = -1, size_t extra = 0)
+{
+	if (when == 0) { ReceiveChars(extra); }
+	size_t remaining = pdc.GetRcr();
+	if (when == 1) { ReceiveChars(extra); }
+	if (pdc.GetEndrx())
+	{
+		pdc.Interrupt();				// the PDC has moved on to the next block but the ISR hasn't run yet
+		if (when == 2) { ReceiveChars(extra); }
+		remaining = pdc.GetRcr();
+	}
+	return rxBuffer.GetBytesWritten(remaining);
+}
+
+// Read everything available as CheckInput does, appending it to 'received'. Return true if there was an overrun.
+static bool ReadAll(std::string& received, uint32_t bytesWritten)
+{
+	bool hadOverrun = false;
+	for (;;)
+	{
+		const char * array data = nullptr;
+		bool overrun;
+		const size_t len = rxBuffer.GetData(bytesWritten, data, overrun);
+		hadOverrun |= overrun;
+		if (len == 0)
+		{
+			return hadOverrun;
+		}
+		received.append(data, len);
+	}
+}
+
+static void TestStream()
+{
+	static const size_t bursts[] = { 1, 100, 411, 512, 1, 1023, 7, 1536, 300, 212, 1000, 536, 64, 1535, 2, 511, 513, 1200, 29 };
+	pdc.Start();
+	sent.clear();
+	std::string received;
+	bool overrun = false;
+	unsigned int pending = 0;
+	for (size_t i = 0; i < sizeof(bursts)/sizeof(bursts[0]); ++i)
+	{
+		if (i % 3 != 2)
+		{
+			ReceiveChars(bursts[i], true);
+		}
+		else
+		{
+			// Hold the ISR off for the last block's worth of characters, so that CheckInput may have to deal with a pending ENDRX
+			const size_t masked = std::min<size_t>(bursts[i], blockSize);
+			ReceiveChars(bursts[i] - masked, true);
+			ReceiveChars(masked);
+			if (pdc.GetEndrx())
+			{
+				++pending;
+			}
+		}
+		overrun |= ReadAll(received, GetBytesWritten());
+	}
+	printf("stream: %u characters received, %u times round the buffer, %u reads with the ISR pending\n",
+			(unsigned int)received.size(), (unsigned int)(sent.size() / bufferSize), pending);
+	Check(!overrun && pdc.GetLost() == 0, "stream: overrun reported or characters lost");
+	Check(received == sent, "stream: received data differs from the data sent");
+}
+
+static void TestOverrun()
+{
+	for (size_t behind = bufferSize - blockSize - 1; behind <= bufferSize - blockSize + 1; ++behind)
+	{
+		pdc.Start();
+		sent.clear();
+		ReceiveChars(300, true);		// start part way through a block
+		std::string received;
+		ReadAll(received, GetBytesWritten());
+		ReceiveChars(behind, true);
+		const uint32_t bytesWritten = GetBytesWritten();
+		const char * array data = nullptr;
+		bool overrun;
+		const size_t len = rxBuffer.GetData(bytesWritten, data, overrun);
+		printf("reader %u characters behind: %s\n", (unsigned int)behind, overrun ? "overrun" : "no overrun");
+		Check(overrun == (behind > bufferSize - blockSize), "%u characters behind: wrong overrun report", (unsigned int)behind);
+		if (!overrun)
+		{
+			// The data handed out must survive the PDC filling the rest of its current block, because it isn't told to stop
+			const std::string handedOut(data, len);
+			ReceiveChars(pdc.GetRcr());
+			Check(std::string(data, len) == handedOut && handedOut == sent.substr(300, len), "%u characters behind: data handed out was overwritten", (unsigned int)behind);
+		}
+		else
+		{
+			Check(rxBuffer.GetBytesRead() == bytesWritten, "%u characters behind: overrun didn't skip the lost data", (unsigned int)behind);
+		}
+	}
+}
+
+static void TestToken()
+{
+	char scratch[128];
+	pdc.Start();
+	sent.clear();
+	ReceiveChars(bufferSize - 40, true);
+	ReceiveChars(300, true);
+
+	// A token that ends just before the last character of the buffer stays in place, with room for the terminator
+	uint32_t pos = bufferSize - 140;
+	size_t len = 139;
+	const char * array p = rxBuffer.GetToken(pos, len, scratch, sizeof(scratch));
+	Check(p != scratch && len == 139 && std::string(p, len) == sent.substr(pos, len), "token before end of buffer");
+
+	// A token that ends at the end of the buffer is copied, because its terminator would be at the start
+	pos = bufferSize - 50;
+	len = 50;
+	p = rxBuffer.GetToken(pos, len, scratch, sizeof(scratch));
+	Check(p == scratch && len == 50 && std::string(p, len) == sent.substr(pos, len), "token at end of buffer");
+
+	// A token that wraps round is copied and truncated to leave room for the terminator
+	pos = bufferSize - 30;
+	len = 200;
+	p = rxBuffer.GetToken(pos, len, scratch, sizeof(scratch));
+	printf("token of 200 characters across the end of the buffer: %u characters copied to scratch\n", (unsigned int)len);
+	Check(p == scratch && len == sizeof(scratch) - 1 && std::string(p, len) == sent.substr(pos, len), "token across end of buffer");
+}
+
+static void TestBlockEndRace()
+{
+	static const char * const when[] = { "before reading RCR", "between reading RCR and SR", "after handling ENDRX" };
+	for (int w = 0; w < 3; ++w)
+	{
+		for (size_t extra = 1; extra <= 3; ++extra)
+		{
+			pdc.Start();
+			sent.clear();
+			ReceiveChars(blockSize - 2, true);
+			std::string received;
+			ReadAll(received, GetBytesWritten());
+			if (w == 2)
+			{
+				ReceiveChars(2);		// make sure that there is an ENDRX to handle
+			}
+
+			const uint32_t bytesWritten = GetBytesWritten(w, extra);
+			const bool overrun = ReadAll(received, bytesWritten);
+			pdc.Interrupt();
+			ReadAll(received, GetBytesWritten());
+			Check(!overrun && received == sent, "block ends %s, %u characters later: received data differs from data sent", when[w], (unsigned int)extra);
+		}
+	}
+}
+
+int main(int argc, char **argv)
+{
+	TestStream();
+	TestOverrun();
+	TestToken();
+	TestBlockEndRace();
+	return HostTest::Result();
+}
+
+// End
@@ -0,0 +1,305 @@
+/*
+ * JsonValueTest.cpp
+ *
+ * Checks the number parsing in JsonValue against the C library functions that it replaced:
+ * - fixed values: rounding of halves, the limits of int and unsigned int, integers that overflow with and without an exponent, exponents
+ *   beyond the table of powers of ten, more than 9 significant digits, and malformed numbers
+ * - random numbers, which GetUnsignedInteger must parse as strtoul does, GetInteger as strtol does or else as strtod does rounded half away
+ *   from zero, and GetFloat as strtof does within the tolerance below
+ * - random strings of the characters that numbers are made of, which must be accepted exactly when they match the number format
+ *
+ * GetFloat is exact for up to 7 significant digits when the power of ten is within 10, because it then does a single correctly-rounded multiply
+ * or divide. Otherwise it may round two or three times, and we accept results up to 3 units in the last place from strtof. One consequence is
+ * that a value within a few units of FLT_MAX can come out as infinity.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <regex>
+#include <string>
+#include "SimDisplay.hpp"
+#include "Library/JsonValue.hpp"
+
+using HostTest::Check;
+
+const uint32_t maxUlps = 3;
+
+// The number format that JsonValue accepts. Unlike JSON it allows leading zeros.
+static const std::regex numberFormat("-?[0-9]+(\\.[0-9]+)?([eE][-+]?[0-9]+)?");
+
+static bool GetInteger(const std::string& s, int& rslt)
+{
+	return JsonValue(s.c_str(), s.size()).GetInteger(rslt);
+}
+
+static bool GetUnsignedInteger(const std::string& s, unsigned int& rslt)
+{
+	return JsonValue(s.c_str(), s.size()).GetUnsignedInteger(rslt);
+}
+
+static bool GetFloat(const std::string& s, float& rslt)
+{
+	return JsonValue(s.c_str(), s.size()).GetFloat(rslt);
+}
+
+// The C library results. Each returns false if the function wouldn't parse the whole string or the value is out of range.
+static bool RefUnsignedInteger(const std::string& s, unsigned int& rslt)
+{
+	char *end;
+	errno = 0;
+	const unsigned long val = strtoul(s.c_str(), &end, 10);
+	rslt = (unsigned int)val;
+	return !s.empty() && *end == 0 && errno == 0 && val <= UINT_MAX;
+}
+
+static bool RefInteger(const std::string& s, int& rslt)
+{
+	char *end;
+	errno = 0;
+	const long val = strtol(s.c_str(), &end, 10);
+	if (!s.empty() && *end == 0)
+	{
+		rslt = (int)val;
+		return errno == 0 && val >= INT_MIN && val <= INT_MAX;
+	}
+	const double d = strtod(s.c_str(), &end);
+	const double rounded = (d < 0.0) ? ceil(d - 0.5) : floor(d + 0.5);
+	rslt = (int)rounded;
+	return !s.empty() && *end == 0 && rounded >= INT_MIN && rounded <= INT_MAX;
+}
+
+static bool RefFloat(const std::string& s, float& rslt)
+{
+	char *end;
+	rslt = strtof(s.c_str(), &end);
+	return !s.empty() && *end == 0;
+}
+
+// Distance between two floats in units in the last place
+static uint32_t UlpDistance(float a, float b)
+{
+	int32_t ia, ib;
+	memcpy(&ia, &a, sizeof(ia));
+	memcpy(&ib, &b, sizeof(ib));
+	const int64_t la = (ia < 0) ? (int64_t)INT32_MIN - ia : ia;		// order the bit patterns of negative floats the same way as the values
+	const int64_t lb = (ib < 0) ? (int64_t)INT32_MIN - ib : ib;
+	return (uint32_t)std::min<int64_t>(llabs(la - lb), UINT32_MAX);
+}
+
+static void TestFixedValues()
+{
+	// Expected results of GetInteger. 'ok' is false where it must reject the value.
+	static const struct { const char *s; bool ok; int val; } integers[] =
+	{
+		{ "0", true, 0 }, { "-0", true, 0 }, { "42", true, 42 }, { "007", true, 7 },
+		{ "2.5", true, 3 }, { "-2.5", true, -3 }, { "0.5", true, 1 }, { "-0.5", true, -1 }, { "0.49", true, 0 }, { "2.4999999", true, 2 },
+		{ "1.5e0", true, 2 }, { "25e-1", true, 3 }, { "-25e-1", true, -3 }, { "1e5", true, 100000 }, { "1e-20", true, 0 },
+		{ "2147483647", true, INT_MAX }, { "-2147483648", true, INT_MIN }, { "2147483647.4", true, INT_MAX }, { "-2147483648.4", true, INT_MIN },
+		{ "2147483648", false, 0 }, { "-2147483649", false, 0 }, { "2147483647.5", false, 0 }, { "-2147483648.5", false, 0 },
+		{ "99999999999", false, 0 }, { "3e9", false, 0 }, { "-3e9", false, 0 }, { "1e100", false, 0 },
+		{ "12345678901e-5", true, 123457 }, { "21474836470e-1", false, 0 },
+		{ "", false, 0 }, { "-", false, 0 }, { "1.", false, 0 }, { "1e", false, 0 }, { "1e+", false, 0 }, { ".5", false, 0 }, { "+1", false, 0 },
+		{ "--1", false, 0 }, { "1.2.3", false, 0 }, { "1x", false, 0 }, { " 1", false, 0 }, { "1e-5.0", false, 0 }
+	};
+	for (const auto& t : integers)
+	{
+		int val = 0;
+		const bool ok = GetInteger(t.s, val);
+		Check(ok == t.ok && (!ok || val == t.val), "GetInteger(\"%s\") gave %s %d", t.s, (ok) ? "true" : "false", val);
+	}
+
+	static const struct { const char *s; bool ok; unsigned int val; } unsignedIntegers[] =
+	{
+		{ "0", true, 0 }, { "00012", true, 12 }, { "4294967295", true, UINT_MAX },
+		{ "4294967296", false, 0 }, { "99999999999", false, 0 }, { "-1", false, 0 }, { "1.0", false, 0 }, { "1e3", false, 0 }, { "", false, 0 }, { "+1", false, 0 }
+	};
+	for (const auto& t : unsignedIntegers)
+	{
+		unsigned int val = 0;
+		const bool ok = GetUnsignedInteger(t.s, val);
+		Check(ok == t.ok && (!ok || val == t.val), "GetUnsignedInteger(\"%s\") gave %s %u", t.s, (ok) ? "true" : "false", val);
+	}
+
+	// Floats are compared with strtof, and printed so that the distance from it is on record
+	static const char * const floats[] =
+	{
+		"0", "-0", "21.3", "-1.50", "215.0", "0.1", "1e10", "1e11", "1e-10", "1e-11", "0.00001233867", "1e38", "3.4028235e38", "1.17549435e-38",
+		"123456789", "1234567891", "12345678951", "0.1234567891234", "9999999999", "16777217", "1e39", "1e-50"
+	};
+	for (const char *s : floats)
+	{
+		float val = 0.0f, ref;
+		const bool ok = GetFloat(s, val);
+		RefFloat(s, ref);
+		const uint32_t ulps = UlpDistance(val, ref);
+		printf("%-16s %-16.9g strtof %-16.9g %u ULP\n", s, val, ref, ulps);
+		Check(ok && ulps <= maxUlps, "GetFloat(\"%s\") gave %s %.9g", s, (ok) ? "true" : "false", val);
+	}
+	static const char * const badFloats[] = { "", "-", "1.", "1e", "1e+", "1e-", ".5", "-.5", "1.e5", "+1", "1x", "e5", "1e5e5", "0x10", "inf", "nan" };
+	for (const char *s : badFloats)
+	{
+		float val;
+		Check(!GetFloat(s, val), "GetFloat(\"%s\") accepted it", s);
+	}
+}
+
+static std::string RandomDigits(int n)
+{
+	std::string s;
+	while (n-- != 0)
+	{
+		s += (char)('0' + rand() % 10);
+	}
+	return s;
+}
+
+static void TestRandomIntegers()
+{
+	srand(25);
+	unsigned int unsignedDiffs = 0, integerDiffs = 0, accepted = 0;
+	for (int i = 0; i < 1000000; ++i)
+	{
+		// Integers of up to 11 digits, some with fractions and some with short exponents
+		std::string s = ((rand() % 2 == 0) ? "-" : "") + RandomDigits(1 + rand() % 11);
+		const int form = rand() % 4;
+		if (form == 1)
+		{
+			s += "." + RandomDigits(1 + rand() % 6);
+		}
+		else if (form == 2 && s.size() - (s[0] == '-') <= 7)
+		{
+			// With up to 7 significant digits and a result below 2^24, the float that GetInteger rounds is close enough to the exact value
+			s += "e-" + std::to_string(rand() % 8);
+		}
+
+		unsigned int u = 0, refU = 0;
+		const bool okU = GetUnsignedInteger(s, u), refOkU = s.find_first_not_of("0123456789") == std::string::npos && RefUnsignedInteger(s, refU);
+		if (okU != refOkU || (okU && u != refU))
+		{
+			if (++unsignedDiffs <= 3)
+			{
+				printf("GetUnsignedInteger(\"%s\") gave %s %u, strtoul %s %u\n", s.c_str(), (okU) ? "true" : "false", u, (refOkU) ? "true" : "false", refU);
+			}
+		}
+
+		int v = 0, refV = 0;
+		const bool ok = GetInteger(s, v), refOk = RefInteger(s, refV);
+		if (ok)
+		{
+			++accepted;
+		}
+		if (ok != refOk || (ok && v != refV))
+		{
+			if (++integerDiffs <= 3)
+			{
+				printf("GetInteger(\"%s\") gave %s %d, strtol/strtod %s %d\n", s.c_str(), (ok) ? "true" : "false", v, (refOk) ? "true" : "false", refV);
+			}
+		}
+	}
+	printf("integers: 1000000 random values, %u in range, %u different from strtoul, %u different from strtol or rounded strtod\n", accepted, unsignedDiffs, integerDiffs);
+	Check(unsignedDiffs == 0 && integerDiffs == 0, "random integers differ from the C library");
+}
+
+static void TestRandomFloats()
+{
+	srand(26);
+	unsigned int exactDiffs = 0, histogram[maxUlps + 2] = { 0 };
+	uint32_t maxSeen = 0;
+	for (int i = 0; i < 1000000; ++i)
+	{
+		// Up to 12 significant digits and a power of ten within 38, written with or without a decimal point and an exponent
+		const int digits = 1 + rand() % 12;
+		std::string mantissa = std::to_string(1 + rand() % 9) + RandomDigits(digits - 1);
+		int power = rand() % 77 - 38;
+		const bool shortForm = digits <= 7 && power >= -10 && power <= 10;
+		std::string s = (rand() % 2 == 0) ? "-" : "";
+		const int pointPos = rand() % (digits + 1);
+		if (pointPos != digits)
+		{
+			mantissa.insert(pointPos, ".");
+			if (pointPos == 0)
+			{
+				mantissa.insert(0, "0");
+			}
+			power += digits - pointPos;					// the decimal point makes the value smaller, so raise the exponent to match
+		}
+		s += mantissa;
+		if (power != 0 || rand() % 2 == 0)
+		{
+			s += ((rand() % 2 == 0) ? "e" : "E") + std::to_string(power);
+		}
+
+		float val = 0.0f, ref;
+		const bool ok = GetFloat(s, val);
+		RefFloat(s, ref);
+		if (!ok || !std::isnormal(ref))
+		{
+			Check(ok, "GetFloat(\"%s\") rejected it", s.c_str());
+			continue;
+		}
+		const uint32_t ulps = UlpDistance(val, ref);
+		++histogram[std::min(ulps, maxUlps + 1)];
+		maxSeen = std::max(maxSeen, ulps);
+		if (shortForm && ulps != 0)
+		{
+			if (++exactDiffs <= 3)
+			{
+				printf("GetFloat(\"%s\") gave %.9g, strtof %.9g\n", s.c_str(), val, ref);
+			}
+		}
+	}
+	printf("floats: 1000000 random values, ULP from strtof 0: %u, 1: %u, 2: %u, 3: %u, more: %u, largest %u\n",
+			histogram[0], histogram[1], histogram[2], histogram[3], histogram[4], maxSeen);
+	Check(maxSeen <= maxUlps, "random floats: %u ULP from strtof, more than the tolerance of %u", maxSeen, maxUlps);
+	Check(exactDiffs == 0, "random floats: %u values with up to 7 significant digits and a power of ten within 10 not the same as strtof", exactDiffs);
+}
+
+static void TestRandomStrings()
+{
+	srand(27);
+	unsigned int wrong = 0, numbers = 0;
+	for (int i = 0; i < 1000000; ++i)
+	{
+		std::string s;
+		for (int n = rand() % 7; n != 0; --n)
+		{
+			s += "0123456789.-+eE"[rand() % 15];
+		}
+		const bool isNumber = std::regex_match(s, numberFormat);
+		int v;
+		unsigned int u;
+		float f;
+		const bool intOk = GetInteger(s, v), unsignedOk = GetUnsignedInteger(s, u), floatOk = GetFloat(s, f);
+		if (isNumber)
+		{
+			++numbers;
+		}
+		const bool isUnsigned = !s.empty() && s.find_first_not_of("0123456789") == std::string::npos;		// never out of range with so few digits
+		if (floatOk != isNumber || (intOk && !isNumber) || unsignedOk != isUnsigned)
+		{
+			if (++wrong <= 3)
+			{
+				printf("\"%s\": GetInteger %d GetUnsignedInteger %d GetFloat %d\n", s.c_str(), intOk, unsignedOk, floatOk);
+			}
+		}
+	}
+	printf("strings: 1000000 random strings of number characters, %u numbers, %u accepted or rejected wrongly\n", numbers, wrong);
+	Check(wrong == 0, "random strings accepted or rejected wrongly");
+}
+
+int main(int argc, char **argv)
+{
+	TestFixedValues();
+	TestRandomIntegers();
+	TestRandomFloats();
+	TestRandomStrings();
+	return HostTest::Result();
+}
+
+// End
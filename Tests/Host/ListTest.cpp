@@ -0,0 +1,206 @@
+/*
+ * ListTest.cpp
+ *
+ * Checks the scrolling list in a popup, as used for the file list. The list is scrolled by a sequence of small and large steps, some
+ * past either end, with items pressed and released along the way, and each frame as displayed (taking account of hardware scrolling) is
+ * compared with a full redraw of the list without hardware scrolling. This is done in landscape orientation and in the flipped landscape
+ * orientation, where the display lines scroll the other way. Opening and closing another popup over the scrolled list must stop the
+ * hardware scrolling without leaving anything behind, and so must drawing another field in the rows that the list occupies, such as the error
+ * message that the file list popup shows in place of the list.
+ * It prints the number of bus writes for scrolling by one row and for redrawing the whole list.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+#include "SimDisplay.hpp"
+#include "Display.hpp"
+
+using HostTest::Check;
+
+extern const uint8_t glcd19x21[];
+
+static const DisplayStyle styles[] =
+{
+	{ COLOUR_ROLE(popupButtonTextColour), COLOUR_ROLE(popupButtonBackColour) }
+};
+
+const unsigned int numItems = 57;
+static char itemText[numItems][24];
+static const char *items[numItems];
+
+// Scroll steps in pixels. The rows are 13 pixels apart.
+static const int moves[] =
+{
+	3, 5, 1, 17, 40, -2, -9, -30, 383, 385, -500, 800, -3, 2, 7, 11, -1000,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 200, 200,
+	-13, -13, -13, -13, -13, -13, -13, -13, -13
+};
+
+static MainWindow mgr;
+
+// Redraw the list without hardware scrolling and return the frame
+static std::vector<uint16_t> Redraw()
+{
+	ListField::StopHardwareScroll(nullptr);
+	mgr.Refresh(true);
+	SimDisplay::TakeBusWrites();
+	return SimDisplay::GetFrame();
+}
+
+static unsigned int CountDifferences(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b)
+{
+	unsigned int n = 0;
+	for (size_t i = 0; i < a.size(); ++i)
+	{
+		if (a[i] != b[i])
+		{
+			++n;
+		}
+	}
+	return n;
+}
+
+static void TestOrientation(const char *orientationName, DisplayOrientation orient)
+{
+	SimDisplay::Init(orient);
+	mgr.Init(colourSchemes[0].defaultBackColour);
+	PopupWindow *filePopup = new PopupWindow(472, 792, colourSchemes[0].popupBackColour, colourSchemes[0].popupBorderColour);
+	ListField *list = new ListField(68, 20, 752, 384, 2, 12, 12, 1);
+	filePopup->AddField(list);
+	list->SetItems(items, numItems);
+	IntegerField *errorField = new IntegerField(136, 20, 752, TextAlignment::Centre, "Error ", " accessing SD card");
+	errorField->Show(false);
+	filePopup->AddField(errorField);
+	PopupWindow *otherPopup = new PopupWindow(200, 400, colourSchemes[0].popupBackColour, colourSchemes[0].popupBorderColour);
+	mgr.SetPopup(filePopup, 4, 4);
+	mgr.Refresh(false);
+	SimDisplay::TakeBusWrites();
+
+	// Scroll through the list twice, the first time redrawing the list completely after each step to get the expected frames, and the second
+	// time comparing the frames drawn the normal way with them
+	std::vector<std::vector<uint16_t>> expected;
+	unsigned int badFrames = 0;
+	for (int pass = 0; pass < 2; ++pass)
+	{
+		list->ScrollTo(0);
+		list->Press(false, 30);
+		list->Press(false, 9);
+		Redraw();
+		int pos = 0;
+		unsigned int frame = 0;
+		for (int move : moves)
+		{
+			pos += move;
+			list->ScrollTo(pos);
+			pos = std::max(pos, 0);
+			if (frame == 5)
+			{
+				list->Press(true, 9);
+			}
+			else if (frame == 9)
+			{
+				list->Press(false, 9);
+				list->Press(true, 30);
+			}
+			else if (frame == 20)
+			{
+				list->Press(false, 30);
+			}
+			mgr.Refresh(false);
+			SimDisplay::TakeBusWrites();
+			if (pass == 0)
+			{
+				expected.push_back(Redraw());
+			}
+			else
+			{
+				const unsigned int differ = CountDifferences(SimDisplay::GetFrame(), expected[frame]);
+				if (differ != 0)
+				{
+					printf("%s, frame %u (scroll by %d): %u pixels differ from full redraw\n", orientationName, frame, move, differ);
+					++badFrames;
+				}
+			}
+			++frame;
+		}
+	}
+	Check(badFrames == 0 && SimDisplay::GetErrors() == 0, "%s: %u of %u scrolled frames differ from full redraw", orientationName, badFrames, (unsigned int)expected.size());
+
+	// Open another popup over the list while it is hardware scrolled, then close it and scroll again
+	list->ScrollTo(123);
+	mgr.Refresh(false);
+	list->ScrollTo(131);
+	mgr.Refresh(false);
+	mgr.SetPopup(otherPopup, 200, 140);
+	mgr.Refresh(false);
+	std::vector<uint16_t> shown = SimDisplay::GetFrame();
+	mgr.Refresh(true);
+	Check(CountDifferences(shown, SimDisplay::GetFrame()) == 0, "%s: popup over scrolled list differs from full redraw", orientationName);
+	mgr.ClearPopup();
+	mgr.Refresh(false);
+	list->ScrollTo(140);
+	mgr.Refresh(false);
+	shown = SimDisplay::GetFrame();
+	Check(CountDifferences(shown, Redraw()) == 0, "%s: scrolled list after closing popup differs from full redraw", orientationName);
+
+	// Hide the list while it is hardware scrolled and show the error message in its place, as the file list popup does if the card can't be read
+	list->ScrollTo(145);
+	mgr.Refresh(false);
+	list->ScrollTo(152);
+	mgr.Refresh(false);
+	mgr.Show(list, false);
+	errorField->SetValue(3);
+	mgr.Show(errorField, true);
+	mgr.Refresh(false);
+	shown = SimDisplay::GetFrame();
+	Check(CountDifferences(shown, Redraw()) == 0, "%s: error message in place of scrolled list differs from full redraw", orientationName);
+	mgr.Show(errorField, false);
+	mgr.Show(list, true);
+	mgr.Refresh(false);
+
+	// Close the list while it is hardware scrolled
+	list->ScrollTo(150);
+	mgr.Refresh(false);
+	mgr.ClearPopup();
+	mgr.Refresh(false);
+	shown = SimDisplay::GetFrame();
+	mgr.Refresh(true);
+	Check(CountDifferences(shown, SimDisplay::GetFrame()) == 0 && SimDisplay::GetErrors() == 0, "%s: closing scrolled list differs from full redraw", orientationName);
+
+	// Costs
+	mgr.SetPopup(filePopup, 4, 4);
+	list->ScrollTo(200);
+	mgr.Refresh(false);
+	SimDisplay::TakeBusWrites();
+	list->ScrollTo(213);
+	mgr.Refresh(false);
+	printf("%s: %-24s %7u bus writes\n", orientationName, "scroll by one row", SimDisplay::TakeBusWrites());
+	list->SetItems(items, numItems);
+	mgr.Refresh(false);
+	printf("%s: %-24s %7u bus writes\n", orientationName, "redraw list", SimDisplay::TakeBusWrites());
+	if (orient == Landscape)
+	{
+		SimDisplay::CheckImage("List", 0, 0, 800, 160);
+	}
+	mgr.ClearAllPopups();
+}
+
+int main(int argc, char **argv)
+{
+	DisplayField::SetDefaultFont(glcd19x21);
+	ButtonWithText::SetFont(glcd19x21);
+	DisplayField::SetStyles(styles);
+	DisplayField::SetColourScheme(colourSchemes[0]);
+	for (unsigned int i = 0; i < numItems; ++i)
+	{
+		snprintf(itemText[i], sizeof(itemText[i]), "%sfile number %u.gcode", (i % 7 == 0) ? "*" : "", i);
+		items[i] = itemText[i];
+	}
+
+	TestOrientation("landscape", Landscape);
+	TestOrientation("flipped", (DisplayOrientation)(Landscape ^ (ReverseX | ReverseY | InvertText | InvertBitmap)));
+	return HostTest::Result();
+}
+
+// End
@@ -0,0 +1,970 @@
+/*
+ * ParserTest.cpp
+ *
+ * Checks the JSON parser in SerialIo.cpp against the parser that it replaced, which copied each ID and value into a String one character
+ * at a time. The new one hands out values where they lie in the receive buffer, terminating them in place, and processes escape sequences
+ * and combining characters in place. Both are fed the same stream of random messages, the new one through a simulated UART PDC in bursts
+ * of random sizes, and they must make the same calls to the functions in PanelDue.cpp:
+ * - the messages contain escape sequences, combining characters, other UTF-8 characters, numbers, arrays, unknown IDs and errors
+ * - every value that the new parser hands out is null-terminated just after its last character
+ * - values that wrap round the end of the receive buffer are copied out and arrive intact, and a long one is truncated to the scratch buffer
+ * - string values of 100 characters or more, which the old parser cut short, arrive whole
+ */
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "SimDisplay.hpp"
+#include "Hardware/SerialIo.hpp"
+#include "Library/Vector.hpp"
+#include "Library/DmaReceiveBuffer.hpp"
+#include "PanelDue.hpp"
+
+using HostTest::Check;
+
+// The UART, and the ASF driver functions that SerialIo.cpp calls. Only the receive PDC does anything.
+Uart simUart;
+
+extern "C" {
+
+	uint32_t uart_init(Uart *p_uart, const sam_uart_opt_t *p_uart_opt) { return 0; }
+	void uart_enable_interrupt(Uart *p_uart, uint32_t ul_sources) { }
+	void uart_disable_interrupt(Uart *p_uart, uint32_t ul_sources) { }
+	uint32_t uart_write(Uart *p_uart, const uint8_t uc_data) { return 0; }
+	uint32_t pio_configure(Pio *p_pio, const pio_type_t ul_type, const uint32_t ul_mask, const uint32_t ul_attribute) { return 1; }
+	void UART1_Handler();
+}
+
+// The receive half of the UART PDC, working on the registers of simUart. The pointer registers are 32 bits wide, which is why the test
+// is linked to run below 4GB.
+namespace SimPdc
+{
+	static char *bufferStart = nullptr;			// lowest address that SerialIo has given the PDC, which is the start of the receive buffer
+	static unsigned int lost = 0;
+
+	static char *Pointer(uint32_t reg)
+	{
+		char * const p = reinterpret_cast<char *>(static_cast<uintptr_t>(reg));
+		if (bufferStart == nullptr || p < bufferStart)
+		{
+			bufferStart = p;
+		}
+		return p;
+	}
+
+	// Writing RNCR clears ENDRX, and if the current block is already full the PDC moves straight on to the new one
+	static void AfterFirmware()
+	{
+		if (simUart.UART_RNCR != 0)
+		{
+			simUart.UART_SR &= ~UART_SR_ENDRX;
+			if (simUart.UART_RCR == 0)
+			{
+				simUart.UART_RPR = simUart.UART_RNPR;
+				simUart.UART_RCR = simUart.UART_RNCR;
+				simUart.UART_RNCR = 0;
+			}
+		}
+	}
+
+	static void Receive(char c)
+	{
+		if (simUart.UART_RCR == 0)
+		{
+			++lost;
+			return;
+		}
+		*Pointer(simUart.UART_RPR) = c;
+		++simUart.UART_RPR;
+		if (--simUart.UART_RCR == 0)
+		{
+			simUart.UART_SR |= UART_SR_ENDRX;
+			if (simUart.UART_RNCR != 0)
+			{
+				Pointer(simUart.UART_RNPR);
+				simUart.UART_RPR = simUart.UART_RNPR;
+				simUart.UART_RCR = simUart.UART_RNCR;
+				simUart.UART_RNCR = 0;
+			}
+		}
+	}
+
+	static void Interrupt()
+	{
+		if ((simUart.UART_SR & UART_SR_ENDRX) != 0)
+		{
+			UART1_Handler();
+			AfterFirmware();
+		}
+	}
+
+	// True if a value handed out by SerialIo is in the receive buffer rather than the scratch buffer
+	static bool InReceiveBuffer(const char *p)
+	{
+		return p >= bufferStart && p < bufferStart + DmaReceiveBuffer::bufferSize;
+	}
+}
+
+// The IDs that FindReceivedDataEvent knows. Any other ID is handled as an unknown one.
+static const char * const knownIds[] = { "status", "heaters", "active", "standby", "hstat", "pos", "efactor", "sfactor", "message", "resp", "dir",
+		"files", "err", "fraction_printed", "generatedBy", "filament", "myName" };
+const size_t numKnownIds = sizeof(knownIds)/sizeof(knownIds[0]);
+
+static ReceivedDataEvent LookUp(const char *id)
+{
+	for (size_t i = 0; i < numKnownIds; ++i)
+	{
+		if (strcmp(id, knownIds[i]) == 0)
+		{
+			return (ReceivedDataEvent)(i + 1);
+		}
+	}
+	return rcvUnknown;
+}
+
+// The calls that a parser makes, one string per call
+static std::vector<std::string> calls;
+
+static void Record(const char *fmt, ...) __attribute__ ((format (printf, 1, 2)));
+
+static void Record(const char *fmt, ...)
+{
+	char buf[400];
+	va_list args;
+	va_start(args, fmt);
+	vsnprintf(buf, sizeof(buf), fmt, args);
+	va_end(args);
+	calls.push_back(buf);
+}
+
+// Statistics and faults in the values that SerialIo hands out
+static unsigned int hashErrors = 0, unterminated = 0, copiedValues = 0, values = 0;
+
+// The functions in PanelDue.cpp that SerialIo calls
+ReceivedDataEvent FindReceivedDataEvent(uint32_t hash, const char id[])
+{
+	if (hash != JsonKey::Hash(id))
+	{
+		++hashErrors;
+	}
+	return LookUp(id);
+}
+
+void ProcessReceivedValue(ReceivedDataEvent rde, const JsonValue& val, int index)
+{
+	if (val[val.size()] != 0 || strlen(val.c_str()) != val.size())
+	{
+		++unterminated;
+	}
+	if (!SimPdc::InReceiveBuffer(val.c_str()))
+	{
+		++copiedValues;
+	}
+	++values;
+	Record("value %d[%d] \"%s\"", rde, index, val.c_str());
+}
+
+void ProcessArrayLength(ReceivedDataEvent rde, int length)
+{
+	Record("length %d %d", rde, length);
+}
+
+void StartReceivedMessage()
+{
+	Record("start");
+}
+
+void EndReceivedMessage()
+{
+	Record("end");
+}
+
+// The parser as it was before values were handed out in place, with the functions it called
+namespace OldParser
+{
+	static void ProcessReceivedValue(const char id[], const char data[], int index)
+	{
+		const ReceivedDataEvent rde = LookUp(id);
+		if (rde != rcvUnknown)
+		{
+			Record("value %d[%d] \"%s\"", rde, index, data);
+		}
+	}
+
+	static void ProcessArrayLength(const char id[], int length)
+	{
+		Record("length %d %d", LookUp(id), length);
+	}
+
+	using ::StartReceivedMessage;
+	using ::EndReceivedMessage;
+
+	
+	const char* array trGrave =			"A\xC0" "E\xC8" "I\xCC"         "O\xD2" "U\xD9" "a\xE0" "e\xE8" "i\xEC" "o\xF2" "u\xF9"        ;
+	const char* array trAcute =			"A\xC1" "E\xC9" "I\xCD"         "O\xD3" "U\xDA" "a\xE1" "e\xE9" "i\xED" "o\xF3" "u\xFA" "y\xFD";
+	const char* array trCircumflex =	"A\xC2" "E\xCA" "I\xCE"         "O\xD4" "U\xDB" "a\xE2" "e\xEA" "i\xEE" "o\xF4" "u\xFB"        ;
+	const char* array trTilde =			"A\xC3"                 "N\xD1" "O\xD5"         "a\xE3"                 "o\xF5"                ;
+	const char* array trUmlaut =		"A\xC4" "E\xCB" "I\xCF"         "O\xD6" "U\xDC" "a\xE4" "e\xEB" "i\xEF" "o\xF6" "u\xFC" "y\xFF";
+	const char* array trCircle =		"A\xC5"                                         "a\xE5"                                        ;
+	const char* array trCedilla =		"C\xC7" "c\xE7";
+
+	// Enumeration to represent the json parsing state.
+	// We don't allow nested objects or nested arrays, so we don't need a state stack.
+	// An additional variable elementCount is 0 if we are not in an array, else the number of elements we have found (including the current one)
+	enum JsonState 
+	{
+		jsBegin,			// initial state, expecting '{'
+		jsExpectId,			// just had '{' so expecting a quoted ID
+		jsId,				// expecting an identifier, or in the middle of one
+		jsHadId,			// had a quoted identifier, expecting ':'
+		jsVal,				// had ':', expecting value
+		jsStringVal,		// had '"' and expecting or in a string value
+		jsStringEscape,		// just had backslash in a string
+		jsIntVal,			// receiving an integer value
+		jsNegIntVal,		// had '-' so expecting a integer value
+		jsFracVal,			// receiving a fractional value
+		jsEndVal,			// had the end of a string or array value, expecting comma or ] or }
+		jsError				// something went wrong
+	};
+	
+	JsonState state = jsBegin;
+	
+	String<20> fieldId;
+	String<100> fieldVal;
+	int arrayElems = -1;
+	
+	static void ProcessField()
+	{
+		ProcessReceivedValue(fieldId.c_str(), fieldVal.c_str(), arrayElems);
+		fieldVal.clear();
+	}
+	
+	static void EndArray()
+	{
+		ProcessArrayLength(fieldId.c_str(), arrayElems);
+		arrayElems = -1;
+	}
+	
+	// Look for combining characters in the string value and convert them if possible
+	static void ConvertUnicode()
+	{
+		unsigned int numContinuationBytesLeft = 0;
+		uint32_t charVal;
+		for (size_t i = 0; i < fieldVal.size(); )
+		{
+			const unsigned char c = fieldVal[i++];
+			if (numContinuationBytesLeft == 0)
+			{
+				if (c >= 0x80)
+				{
+					if ((c & 0xE0) == 0xC0)
+					{
+						charVal = (uint32_t)(c & 0x1F);
+						numContinuationBytesLeft = 1;
+					}
+					else if ((c & 0xF0) == 0xE0)
+					{
+						charVal = (uint32_t)(c & 0x0F);
+						numContinuationBytesLeft = 2;
+					}
+					else if ((c & 0xF8) == 0xF0)
+					{
+						charVal = (uint32_t)(c & 0x07);
+						numContinuationBytesLeft = 3;
+					}
+					else if ((c & 0xFC) == 0xF8)
+					{
+						charVal = (uint32_t)(c & 0x03);
+						numContinuationBytesLeft = 4;
+					}
+					else if ((c & 0xFE) == 0xFC)
+					{
+						charVal = (uint32_t)(c & 0x01);
+						numContinuationBytesLeft = 5;
+					}
+				}
+			}
+			else if ((c & 0xC0) == 0x80)
+			{
+				charVal = (charVal << 6) | (c & 0x3F);
+				--numContinuationBytesLeft;
+				if (numContinuationBytesLeft == 0)
+				{
+					const char* array trtab;
+					switch(charVal)
+					{
+					case 0x0300:	// grave accent
+						trtab = trGrave;
+						break;
+					case 0x0301:	// acute accent
+						trtab = trAcute;
+						break;
+					case 0x0302:	// circumflex
+						trtab = trCircumflex;
+						break;
+					case 0x0303:	// tilde
+						trtab = trTilde;
+						break;
+					case 0x0308:	// umlaut
+						trtab = trUmlaut;
+						break;
+					case 0x030A:	// small circle
+						trtab = trCircle;
+						break;
+					case 0x327:		// cedilla
+						trtab = trCedilla;
+						break;
+					default:
+						trtab = nullptr;
+						break;
+					}
+
+					// If it is a diacritical mark that we handle, try to combine it with the previous character.
+					// The diacritical marks are in the range 03xx so they are encoded as 2 UTF8 bytes.
+					if (trtab != nullptr && i > 2)
+					{
+						const char c2 = fieldVal[i - 3];
+						while (*trtab != 0 && *trtab != c2)
+						{
+							trtab += 2;
+						}
+						if (*trtab != 0)
+						{
+							// Get he translated character and encode it as 2 ITF8 bytes
+							const unsigned char c3 = trtab[1];
+							fieldVal[i - 3] = (c3 >> 6) | 0xC0;
+							fieldVal[i - 2] = (c3 & 0x3F) | 0x80;
+							fieldVal.erase(i - 1);
+							--i;
+						}
+					}
+				}
+			}
+			else
+			{
+				// Bad UTF8 state
+				numContinuationBytesLeft = 0;
+			}
+		}
+	}
+	
+	// Process a received character
+	static void ProcessChar(char c)
+	{
+		if (c == '\n')
+		{
+			state = jsBegin;		// abandon current parse (if any) and start again
+		}
+		else
+		{
+			switch(state)
+			{
+			case jsBegin:			// initial state, expecting '{'
+				if (c == '{')
+				{
+					StartReceivedMessage();
+					state = jsExpectId;
+					fieldVal.clear();
+				}
+				break;
+
+			case jsExpectId:		// expecting a quoted ID
+				switch (c)
+				{
+				case ' ':
+					break;
+				case '"':
+					fieldId.clear();
+					state = jsId;
+					break;
+				case '}':
+					EndReceivedMessage();
+					state = jsBegin;
+					break;
+				default:
+					state = jsError;
+					break;
+				}
+				break;
+					
+			case jsId:				// expecting an identifier, or in the middle of one
+				switch (c)
+				{
+				case '"':
+					state = jsHadId;
+					break;
+				default:
+					if (c >= ' ' && !fieldId.full())
+					{
+						fieldId.add(c);
+					}
+					else
+					{
+						state = jsError;
+					}
+					break;
+				}
+				break;
+
+			case jsHadId:			// had a quoted identifier, expecting ':'
+				switch(c)
+				{
+				case ':':
+					arrayElems = -1;
+					state = jsVal;
+					break;
+				case ' ':
+					break;
+				default:
+					state = jsError;
+					break;
+				}
+				break;
+
+			case jsVal:				// had ':', expecting value
+				switch(c)
+				{
+				case ' ':
+					break;
+				case '"':
+					fieldVal.clear();
+					state = jsStringVal;
+					break;
+				case '[':
+					if (arrayElems == -1)
+					{
+						arrayElems = 0;
+					}
+					else
+					{
+						state = jsError;
+					}
+					break;
+				case ']':
+					if (arrayElems == 0)
+					{
+						EndArray();
+						state = jsEndVal;
+					}
+					else
+					{
+						state = jsError;
+					}
+					break;
+				case '-':
+					fieldVal.clear();
+					fieldVal.add(c);
+					state = jsNegIntVal;
+					break;
+				default:
+					if (c >= '0' && c <= '9')
+					{
+						fieldVal.clear();
+						fieldVal.add(c);
+						state = jsIntVal;
+						break;
+					}
+					else
+					{
+						state = jsError;
+					}
+				}
+				break;
+				
+			case jsStringVal:		// just had '"' and expecting a string value
+				switch (c)
+				{
+				case '"':
+					ConvertUnicode();
+					ProcessField();
+					state = jsEndVal;
+					break;
+				case '\\':
+					state = jsStringEscape;
+					break;
+				default:
+					if (c < ' ')
+					{
+						state = jsError;
+					}
+					else if (!fieldVal.full())
+					{
+						fieldVal.add(c);
+					}
+					break;
+				}
+				break;
+
+			case jsStringEscape:	// just had backslash in a string
+				if (!fieldVal.full())
+				{
+					switch (c)
+					{
+					case '"':
+					case '\\':
+					case '/':
+						fieldVal.add(c);
+						break;
+					case 'n':
+					case 't':
+						fieldVal.add(' ');		// replace newline and tab by space
+						break;
+					case 'b':
+					case 'f':
+					case 'r':
+					default:
+						break;
+					}
+				}
+				state = jsStringVal;
+				break;
+
+			case jsNegIntVal:		// had '-' so expecting a integer value
+				if (c >= '0' && c <= '9')
+				{
+					fieldVal.add(c);
+					state = jsIntVal;
+				}
+				else
+				{
+					state = jsError;
+				}
+				break;
+				
+			case jsIntVal:			// receiving an integer value
+				switch(c)
+				{
+				case '.':
+					if (fieldVal.full())
+					{
+						state = jsError;
+					}
+					else
+					{
+						fieldVal.add(c);
+						state = jsFracVal;
+					}
+					break;
+				case ',':
+					ProcessField();
+					if (arrayElems >= 0)
+					{
+						++arrayElems;
+						state = jsVal;
+					}
+					else
+					{
+						state = jsExpectId;
+					}
+					break;					
+				case ']':
+					if (arrayElems >= 0)
+					{
+						ProcessField();
+						++arrayElems;
+						EndArray();
+						state = jsEndVal;
+					}
+					else
+					{
+						state = jsError;
+					}
+					break;
+				case '}':
+					if (arrayElems == -1)
+					{
+						ProcessField();
+						EndReceivedMessage();
+						state = jsBegin;
+					}
+					else
+					{
+						state = jsError;
+					}
+					break;
+				default:
+					if (c >= '0' && c <= '9' && !fieldVal.full())
+					{
+						fieldVal.add(c);
+					}
+					else
+					{
+						state = jsError;
+					}
+					break;
+				}
+				break;
+
+			case jsFracVal:			// receiving a fractional value
+				switch(c)
+				{
+				case ',':
+					ProcessField();
+					if (arrayElems >= 0)
+					{
+						++arrayElems;
+						state = jsVal;
+					}
+					else
+					{
+						state = jsExpectId;
+					}
+					break;
+				case ']':
+					if (arrayElems >= 0)
+					{
+						ProcessField();
+						++arrayElems;
+						EndArray();
+						state = jsEndVal;
+					}
+					else
+					{
+						state = jsError;
+					}
+					break;
+				case '}':
+					if (arrayElems == -1)
+					{
+						ProcessField();
+						EndReceivedMessage();
+						state = jsBegin;
+					}
+					else
+					{
+						state = jsError;
+					}
+					break;
+				default:
+					if (c >= '0' && c <= '9' && !fieldVal.full())
+					{
+						fieldVal.add(c);
+					}
+					else
+					{
+						state = jsError;
+					}
+					break;
+				}
+				break;
+
+			case jsEndVal:			// had the end of a string or array value, expecting comma or ] or }
+				switch (c)
+				{
+				case ',':
+					if (arrayElems >= 0)
+					{
+						++arrayElems;
+						fieldVal.clear();
+						state = jsVal;
+					}
+					else
+					{
+						state = jsExpectId;
+					}
+					break;
+				case ']':
+					if (arrayElems >= 0)
+					{
+						++arrayElems;
+						EndArray();
+						state = jsEndVal;
+					}
+					else
+					{
+						state = jsError;
+					}
+					break;
+				case '}':
+					if (arrayElems == -1)
+					{
+						EndReceivedMessage();
+						state = jsBegin;
+					}
+					else
+					{
+						state = jsError;
+					}
+					break;
+				default:
+					break;
+				}
+				break;
+
+			case jsError:
+				// Ignore all characters. State will be reset to jsBegin at the start of this function when we receive a newline.
+				break;
+			}
+		}
+	}
+}
+
+const size_t bufferSize = DmaReceiveBuffer::bufferSize;
+
+static uint32_t streamPos = 0;			// number of characters sent to the new parser so far
+
+static void FeedOld(const std::string& s)
+{
+	for (char c : s)
+	{
+		OldParser::ProcessChar(c);
+	}
+}
+
+// Send characters to SerialIo in bursts of random sizes. At the end of some bursts the ISR is held off for up to a block's worth of
+// characters, so that CheckInput finds ENDRX pending.
+static void FeedNew(const std::string& s)
+{
+	size_t i = 0;
+	while (i < s.size())
+	{
+		const size_t burst = std::min<size_t>(1 + rand() % 700, s.size() - i);
+		const size_t masked = (rand() % 4 == 0) ? std::min<size_t>(burst, DmaReceiveBuffer::blockSize) : 0;
+		for (size_t j = 0; j < burst; ++j)
+		{
+			SimPdc::Receive(s[i + j]);
+			if (j < burst - masked)
+			{
+				SimPdc::Interrupt();
+			}
+		}
+		i += burst;
+		streamPos += burst;
+		SerialIo::CheckInput();
+		SimPdc::AfterFirmware();
+		SimPdc::Interrupt();
+	}
+}
+
+// Feed both parsers and check that they make the same calls. Return the calls that the new one made.
+static std::vector<std::string> Compare(const char *name, const std::string& s)
+{
+	calls.clear();
+	FeedOld(s);
+	const std::vector<std::string> oldCalls = calls;
+	calls.clear();
+	FeedNew(s);
+	size_t i = 0;
+	while (i < oldCalls.size() && i < calls.size() && oldCalls[i] == calls[i])
+	{
+		++i;
+	}
+	Check(i == oldCalls.size() && i == calls.size(), "%s: call %u differs, old parser %s, new parser %s", name, (unsigned int)i,
+			(i < oldCalls.size()) ? oldCalls[i].c_str() : "none", (i < calls.size()) ? calls[i].c_str() : "none");
+	return calls;
+}
+
+// Random message generation. The parsers are only the same for values of fewer than 100 characters, because the old one truncated longer ones.
+static unsigned int numEscapes, numCombining, numErrors;
+
+static const char * const combiningMarks[] = { "\xCC\x80", "\xCC\x81", "\xCC\x82", "\xCC\x83", "\xCC\x88", "\xCC\x8A", "\xCC\xA7", "\xCC\x84" };
+
+static void AddStringChars(std::string& s, size_t len)
+{
+	const size_t start = s.size();
+	while (s.size() - start < len)
+	{
+		switch (rand() % 12)
+		{
+		case 0:
+			s += '\\';
+			s += "\"\\/ntbfru"[rand() % 9];
+			++numEscapes;
+			break;
+		case 1:
+			s += "AEIOUaeiouyNnCcx"[rand() % 16];
+			// no break
+		case 2:
+			s += combiningMarks[rand() % 8];
+			++numCombining;
+			break;
+		case 3:
+			s += (char)(0xC2 + rand() % 2);
+			s += (char)(0x80 + rand() % 0x40);
+			break;
+		case 4:
+			s += (rand() % 2 == 0) ? "\xE2\x82\xAC" : "\xF0\x9F\x98\x80";
+			break;
+		case 5:
+			s += (char)(0x80 + rand() % 0x40);		// continuation byte without a start byte
+			break;
+		default:
+			{
+				char c;
+				do
+				{
+					c = (char)(' ' + rand() % 95);
+				} while (c == '"' || c == '\\');
+				s += c;
+			}
+			break;
+		}
+	}
+}
+
+static void AddNumber(std::string& s)
+{
+	if (rand() % 3 == 0)
+	{
+		s += '-';
+	}
+	s += std::to_string(rand() % ((rand() % 2 == 0) ? 10 : 100000));
+	if (rand() % 2 == 0)
+	{
+		s += '.';
+		for (int n = rand() % 4; n != 0; --n)
+		{
+			s += (char)('0' + rand() % 10);
+		}
+	}
+}
+
+static void AddValue(std::string& s)
+{
+	if (rand() % 2 == 0)
+	{
+		s += '"';
+		AddStringChars(s, rand() % 60);
+		s += '"';
+	}
+	else
+	{
+		AddNumber(s);
+	}
+}
+
+static std::string RandomMessage()
+{
+	std::string s = "{";
+	for (int fields = 1 + rand() % 6; fields != 0; --fields)
+	{
+		s += '"';
+		const int idType = rand() % 20;
+		if (idType < 14)
+		{
+			s += knownIds[rand() % numKnownIds];
+		}
+		else
+		{
+			for (int n = (idType == 14) ? 21 : 1 + rand() % 12; n != 0; --n)
+			{
+				s += (char)('a' + rand() % 26);
+			}
+		}
+		s += (rand() % 8 == 0) ? "\" : " : "\":";
+		if (rand() % 3 == 0)
+		{
+			s += '[';
+			const bool strings = rand() % 2 == 0;
+			for (int elems = rand() % 6; elems != 0; --elems)
+			{
+				if (strings)
+				{
+					s += '"';
+					AddStringChars(s, rand() % 20);
+					s += '"';
+				}
+				else
+				{
+					AddNumber(s);
+				}
+				s += (elems == 1) ? "" : (rand() % 4 == 0) ? ", " : ",";
+			}
+			s += ']';
+		}
+		else
+		{
+			AddValue(s);
+		}
+		if (fields != 1)
+		{
+			s += ',';
+		}
+	}
+	s += '}';
+
+	// Sometimes corrupt the message, as a line error or a reply that we don't understand would
+	if (rand() % 25 == 0)
+	{
+		s[rand() % s.size()] = "x\"{}[],:-.\x01 "[rand() % 12];
+		++numErrors;
+	}
+	return s + "\n";
+}
+
+static void TestRandomMessages()
+{
+	srand(23);
+	numEscapes = numCombining = numErrors = 0;
+	std::string s;
+	for (int i = 0; i < 3000; ++i)
+	{
+		s += RandomMessage();
+	}
+	values = copiedValues = 0;
+	const std::vector<std::string> newCalls = Compare("random messages", s);
+	printf("random messages: %u characters, %u times round the receive buffer, %u escapes, %u combining characters, %u corrupted\n",
+			(unsigned int)s.size(), (unsigned int)(s.size() / bufferSize), numEscapes, numCombining, numErrors);
+	printf("random messages: %u calls, %u values of which %u were copied because they wrapped round the receive buffer\n",
+			(unsigned int)newCalls.size(), values, copiedValues);
+}
+
+// Send a message with a string value, with the value starting 'offset' characters before the end of the receive buffer
+static std::vector<std::string> SendString(const char *name, const std::string& value, size_t offset, bool same)
+{
+	const std::string start = "{\"message\":\"";
+	const size_t padding = (2 * bufferSize - offset - (streamPos + start.size()) % bufferSize) % bufferSize;
+	const std::string s = std::string(padding, '\n') + start + value + "\"}\n";
+	copiedValues = 0;
+	if (same)
+	{
+		return Compare(name, s);
+	}
+	calls.clear();
+	FeedNew(s);
+	return calls;
+}
+
+static void TestValuePlacement()
+{
+	// Short strings with escapes and combining characters, across the end of the buffer and just before it
+	const std::string value = "Caf\x65\xCC\x81 \\\"na\xC3\xAFve\\\" \\\\ \\/ tab\\there \\u00e9 N\xCC\x83 \xE2\x82\xAC";
+	for (size_t offset = value.size() + 2; offset != 0; --offset)
+	{
+		char name[40];
+		snprintf(name, sizeof(name), "string %u before end of buffer", (unsigned int)offset);
+		SendString(name, value, offset, true);
+		Check(copiedValues == ((offset <= value.size()) ? 1 : 0), "%s: value %s", name, (copiedValues == 0) ? "not copied" : "copied");
+	}
+
+	// Long strings, which the old parser truncated
+	std::string longValue;
+	for (int i = 0; i < 300; ++i)
+	{
+		longValue += (char)('A' + i % 26);
+	}
+	const std::string expected = "value " + std::to_string(LookUp("message")) + "[-1] \"";
+	std::vector<std::string> c = SendString("long string", longValue, 1000, false);
+	printf("string of 300 characters: %s\n", (c.size() == 3 && copiedValues == 0) ? "handed out in place" : "copied");
+	Check(c.size() == 3 && c[1] == expected + longValue + "\"", "long string not handed out whole");
+	c = SendString("long string across end of buffer", longValue, 30, false);
+	printf("string of 300 characters across end of buffer: %u characters copied\n", (c.size() == 3) ? (unsigned int)(c[1].size() - expected.size() - 1) : 0);
+	Check(c.size() == 3 && copiedValues == 1 && c[1] == expected + longValue.substr(0, 127) + "\"", "long string across end of buffer not truncated");
+}
+
+int main(int argc, char **argv)
+{
+	SerialIo::Init(57600);
+	SimPdc::AfterFirmware();
+	TestRandomMessages();
+	TestValuePlacement();
+	Check(hashErrors == 0 && unterminated == 0 && SimPdc::lost == 0, "%u ID hashes wrong, %u values not terminated, %u characters lost",
+			hashErrors, unterminated, SimPdc::lost);
+	return HostTest::Result();
+}
+
+// End
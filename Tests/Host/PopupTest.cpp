@@ -0,0 +1,168 @@
+/*
+ * PopupTest.cpp
+ *
+ * Checks opening and closing popup windows over a page of fields: nested popups, closing several at once, fields changing or being hidden
+ * under a popup, and changing page or colour scheme with a popup open. After each step, refreshing only the damaged areas and changed
+ * fields must leave the display the same as redrawing everything.
+ * PopupTestReadback is the same test built with UTFT_READBACK, so that closing a popup restores the pixels that were saved when it opened.
+ * It prints the same frame hashes as PopupTest, but fewer bus writes for closing popups.
+ */
+
+#include <cstdio>
+#include "SimDisplay.hpp"
+#include "Display.hpp"
+#include "RefreshCheck.hpp"
+
+using HostTest::Check;
+
+extern const uint8_t glcd28x32[];
+
+enum Style : style_t { styleLabel = 0, styleInfo, styleButton, stylePopupText, stylePopupButton, styleAlert };
+
+static const DisplayStyle styles[] =
+{
+	{ COLOUR_ROLE(labelTextColour), COLOUR_ROLE(defaultBackColour) },
+	{ COLOUR_ROLE(infoTextColour), COLOUR_ROLE(infoBackColour) },
+	{ COLOUR_ROLE(buttonTextColour), COLOUR_ROLE(buttonBackColour) },
+	{ COLOUR_ROLE(popupTextColour), COLOUR_ROLE(popupBackColour) },
+	{ COLOUR_ROLE(popupButtonTextColour), COLOUR_ROLE(popupButtonBackColour) },
+	{ COLOUR_ROLE(alertPopupTextColour), COLOUR_ROLE(alertPopupBackColour) }
+};
+
+const event_t evButton = 1;
+
+static MainWindow mgr;
+
+static void Step(const char *name)
+{
+	RefreshCheck::Step(mgr, name);
+}
+
+int main(int argc, char **argv)
+{
+	SimDisplay::Init(Landscape);
+	DisplayField::SetStyles(styles);
+	DisplayField::SetColourScheme(colourSchemes[0]);
+	DisplayField::SetDefaultFont(glcd28x32);
+	ButtonWithText::SetFont(glcd28x32);
+	SingleButton::SetTextMargin(1);
+	mgr.Init(colourSchemes[0].defaultBackColour);
+
+	// A page with a grid of values and buttons
+	FloatField *values[12];
+	TextButton *buttons[12];
+	for (int i = 0; i < 12; ++i)
+	{
+		DisplayField::SetDefaultStyle(styleInfo);
+		mgr.AddField(values[i] = new FloatField(10 + 52 * (i % 6), 10 + 400 * (i / 6), 180, TextAlignment::Right, 1, "T", "C"));
+		values[i]->SetValue(20.0 + i);
+		DisplayField::SetDefaultStyle(styleButton);
+		mgr.AddField(buttons[i] = new TextButton(10 + 52 * (i % 6), 200 + 400 * (i / 6), 180, "Button", evButton, i));
+	}
+	DisplayField::SetDefaultStyle(styleLabel);
+	StaticTextField *status = new StaticTextField(330, 10, 780, TextAlignment::Left, "Status");
+	mgr.AddField(status);
+	DisplayField * const pageRoot = mgr.GetRoot();
+
+	mgr.SetRoot(nullptr);
+	DisplayField::SetDefaultStyle(styleLabel);
+	StaticTextField *otherPageField = new StaticTextField(200, 10, 780, TextAlignment::Centre, "Another page");
+	mgr.AddField(otherPageField);
+	DisplayField * const otherRoot = mgr.GetRoot();
+	mgr.SetRoot(pageRoot);
+
+	PopupWindow *big = new PopupWindow(250, 420, colourSchemes[0].popupBackColour, colourSchemes[0].popupBorderColour);
+	DisplayField::SetDefaultStyle(stylePopupText);
+	IntegerField *bigValue = new IntegerField(20, 20, 380, TextAlignment::Centre, "Value ", nullptr);
+	big->AddField(bigValue);
+	DisplayField::SetDefaultStyle(stylePopupButton);
+	big->AddField(new TextButton(100, 20, 180, "OK", evButton, 100));
+	big->AddField(new TextButton(100, 220, 180, "Cancel", evButton, 101));
+
+	PopupWindow *small = new PopupWindow(110, 260, colourSchemes[0].popupBackColour, colourSchemes[0].popupBorderColour);
+	DisplayField::SetDefaultStyle(stylePopupText);
+	small->AddField(new StaticTextField(20, 10, 240, TextAlignment::Centre, "Are you sure?"));
+
+	PopupWindow *alert = new PopupWindow(80, 500, colourSchemes[0].alertPopupBackColour, colourSchemes[0].popupBorderColour);
+	DisplayField::SetDefaultStyle(styleAlert);
+	alert->AddField(new StaticTextField(20, 10, 480, TextAlignment::Centre, "Alert"));
+
+	mgr.Refresh(true);
+	SimDisplay::TakeBusWrites();
+
+	mgr.SetPopup(big, 100, 60);
+	Step("open popup");
+	bigValue->SetValue(42);
+	Step("change in popup");
+	mgr.ClearPopup();
+	Step("close popup");
+
+	mgr.SetPopup(big, 100, 60);
+	Step("open popup again");
+	mgr.SetPopup(small, 200, 200);
+	Step("open nested popup");
+	mgr.ClearPopup();
+	Step("close nested popup");
+	mgr.SetPopup(small, 450, 250);
+	Step("open nested popup partly outside");
+	mgr.ClearPopup();
+	mgr.ClearPopup();
+	Step("close both");
+
+	mgr.SetPopup(big, 100, 60);
+	values[1]->SetValue(99.0);							// under the popup
+	values[8]->SetValue(77.0);							// partly under the popup
+	values[11]->SetValue(55.0);							// clear of it
+	Step("changes under popup");
+	mgr.ClearPopup();
+	Step("close after changes");
+
+	mgr.SetPopup(big, 100, 60);
+	Step("open popup over changed fields");
+	mgr.Show(buttons[2], false);						// hidden under the popup
+	Step("hide under popup");
+	mgr.ClearPopup();
+	Step("close after hide");
+	mgr.Show(buttons[2], true);
+	Step("show again");
+
+	mgr.SetPopup(big, 100, 60);
+	mgr.SetPopup(small, 200, 200);
+	mgr.SetPopup(alert, 150, 380);
+	Step("three popups");
+	mgr.ClearPopup(true, alert);
+	mgr.ClearPopup(true, small);
+	mgr.ClearPopup(true, big);
+	Step("close all three");
+
+	mgr.SetPopup(big, 100, 60);
+	Step("open popup before page change");
+	mgr.ClearAllPopups();
+	mgr.SetRoot(otherRoot);
+	mgr.Refresh(true);
+	SimDisplay::TakeBusWrites();
+	mgr.SetPopup(small, 200, 200);
+	Step("popup on other page");
+	mgr.ClearPopup();
+	Step("close on other page");
+	mgr.SetRoot(pageRoot);
+	mgr.Refresh(true);
+	SimDisplay::TakeBusWrites();
+
+	mgr.SetPopup(big, 100, 60);
+	DisplayField::SetColourScheme(colourSchemes[1]);
+	mgr.SetBackgroundColour(colourSchemes[1].defaultBackColour);
+	big->SetColours(colourSchemes[1].popupBackColour, colourSchemes[1].popupBorderColour);
+	mgr.Refresh(true);
+	SimDisplay::TakeBusWrites();
+	Step("colour scheme changed with popup open");
+	mgr.ClearPopup();
+	Step("close in new colour scheme");
+
+	mgr.SetPopup(big, 100, 60);
+	mgr.Refresh(false);
+	SimDisplay::CheckImage("Popup", 80, 40, 460, 290);
+	return HostTest::Result();
+}
+
+// End
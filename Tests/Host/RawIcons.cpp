@@ -0,0 +1,39 @@
+/*
+ * RawIcons.cpp
+ *
+ * The uncompressed RGB565 icons that Icons/iconcompress.py reads, compiled into namespace RawIcons so that the host tests can compare
+ * drawing them with drawing the compressed icons in IconData.cpp that have the same names.
+ */
+
+#include "asf.h"
+#include "Configuration.hpp"
+#include "Icons/Icons.hpp"
+#include "RawIcons.hpp"
+
+namespace RawIcons
+{
+#include "Icons/HomeIcons.cpp"
+#include "Icons/KeyIcons.cpp"
+#include "Icons/MiscIcons.cpp"
+#include "Icons/NozzleIcons.cpp"
+}
+
+#define ICON(_name)		{ #_name, _name, RawIcons::_name }
+
+const IconPair iconPairs[] =
+{
+	ICON(IconNozzle1), ICON(IconNozzle2), ICON(IconNozzle3), ICON(IconNozzle4),
+#if DISPLAY_X == 800
+	ICON(IconNozzle5), ICON(IconNozzle6),
+#endif
+	ICON(IconHomeAll), ICON(IconHomeX), ICON(IconHomeY), ICON(IconHomeZ), ICON(IconHomeU), ICON(IconBedComp),
+#if DISPLAY_X == 800
+	ICON(IconHomeV), ICON(IconHomeW),
+#endif
+	ICON(IconBed), ICON(IconOk), ICON(IconCancel), ICON(IconFiles), ICON(IconKeyboard), ICON(IconTrash),
+	ICON(IconBackspace), ICON(IconUp), ICON(IconDown), ICON(IconEnter)
+};
+
+const size_t numIconPairs = sizeof(iconPairs)/sizeof(iconPairs[0]);
+
+// End
@@ -0,0 +1,25 @@
+/*
+ * RawIcons.hpp
+ *
+ * Each compressed icon with the uncompressed icon that it was made from
+ */
+
+#ifndef RAWICONS_H_
+#define RAWICONS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+struct IconPair
+{
+	const char *name;
+	const uint8_t *compressed;			// width, height, then palette and run-length encoded data as UTFT::drawPalettedBitmap takes
+	const uint16_t *raw;				// width, height, then RGB565 pixels by rows
+};
+
+extern const IconPair iconPairs[];
+extern const size_t numIconPairs;
+
+#endif /* RAWICONS_H_ */
+
+// End
@@ -0,0 +1,128 @@
+/*
+ * RefreshCheck.cpp
+ *
+ * Check that refreshing only what has changed leaves the display showing the same as redrawing everything
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+#include "SimDisplay.hpp"
+#include "RefreshCheck.hpp"
+
+namespace RefreshCheck
+{
+	struct Area
+	{
+		int xmin, ymin, xmax, ymax;
+
+		bool Contains(int x, int y) const { return x >= xmin && x <= xmax && y >= ymin && y <= ymax; }
+
+		// Return true if the point is one that a popup draws. The rounded corners of its double border and background leave out 5 pixels at each corner.
+		bool ContainsRounded(int x, int y) const
+		{
+			const int dx = std::min(x - xmin, xmax - x), dy = std::min(y - ymin, ymax - y);
+			return Contains(x, y) && dx + dy >= 2 && !(dx == 2 && dy == 1) && !(dx == 1 && dy == 2);
+		}
+	};
+
+	// Get the windows that are displayed, starting with the main window
+	static std::vector<Window*> GetWindows(MainWindow& mgr)
+	{
+		std::vector<Window*> windows;
+		for (Window *w = &mgr; w != nullptr; w = w->GetPopup())
+		{
+			windows.push_back(w);
+		}
+		return windows;
+	}
+
+	void Redraw(MainWindow& mgr)
+	{
+		std::vector<Window*> windows = GetWindows(mgr);
+		std::vector<PixelNumber> xpos, ypos;
+		for (Window *w : windows)
+		{
+			xpos.push_back(w->Xpos());
+			ypos.push_back(w->Ypos());
+		}
+		for (size_t i = 1; i < windows.size(); ++i)
+		{
+			mgr.ClearPopup(false);
+		}
+		mgr.Refresh(true);
+		for (size_t i = 1; i < windows.size(); ++i)
+		{
+			mgr.SetPopup(static_cast<PopupWindow*>(windows[i]), xpos[i], ypos[i]);
+		}
+	}
+
+	bool Step(MainWindow& mgr, const char *name)
+	{
+		mgr.Refresh(false);
+		const uint32_t writes = SimDisplay::TakeBusWrites();
+		const std::vector<uint16_t> frame = SimDisplay::GetFrame();
+		const uint64_t hash = SimDisplay::Hash();
+
+		// Find the parts of fields that show round the edges of a popup that covers them partly, and the popups above them
+		const std::vector<Window*> windows = GetWindows(mgr);
+		std::vector<Area> popups;
+		std::vector<std::pair<Area, size_t>> partlyCovered;
+		for (size_t i = 0; i < windows.size(); ++i)
+		{
+			const Window *w = windows[i];
+			if (i != 0)
+			{
+				const PopupWindow *p = static_cast<const PopupWindow*>(w);
+				popups.push_back(Area{ p->Xpos(), p->Ypos(), p->Xpos() + p->GetWidth() - 1, p->Ypos() + p->GetHeight() - 1 });
+			}
+			for (const DisplayField *f = w->GetRoot(); f != nullptr; f = f->next)
+			{
+				if (f->IsVisible() && w->ObscuredByPopup(f))
+				{
+					partlyCovered.push_back(std::make_pair(Area{ w->Xpos() + f->GetMinX(), w->Ypos() + f->GetMinY(), w->Xpos() + f->GetMaxX(), w->Ypos() + f->GetMaxY() }, i));
+				}
+			}
+		}
+
+		Redraw(mgr);
+		SimDisplay::TakeBusWrites();
+		const std::vector<uint16_t> expected = SimDisplay::GetFrame();
+		const int width = SimDisplay::GetWidth();
+		unsigned int differ = 0;
+		for (size_t n = 0; n < frame.size(); ++n)
+		{
+			if (frame[n] != expected[n])
+			{
+				const int x = n % width, y = n / width;
+				bool ignore = false;
+				for (const std::pair<Area, size_t>& field : partlyCovered)
+				{
+					if (field.first.Contains(x, y))
+					{
+						ignore = true;
+						for (size_t j = field.second; j < popups.size(); ++j)
+						{
+							if (popups[j].ContainsRounded(x, y))
+							{
+								ignore = false;				// popup j is above the window that the field is in
+							}
+						}
+						if (ignore)
+						{
+							break;
+						}
+					}
+				}
+				if (!ignore)
+				{
+					++differ;
+				}
+			}
+		}
+		printf("%-36s %7u bus writes, frame %016llx\n", name, writes, (unsigned long long)hash);
+		return HostTest::Check(differ == 0 && SimDisplay::GetErrors() == 0, "%s: %u pixels differ from full redraw", name, differ);
+	}
+}
+
+// End
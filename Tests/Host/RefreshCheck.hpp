@@ -0,0 +1,26 @@
+/*
+ * RefreshCheck.hpp
+ *
+ * Check that refreshing only what has changed leaves the display showing the same as redrawing everything
+ */
+
+#ifndef REFRESHCHECK_H_
+#define REFRESHCHECK_H_
+
+#include <cstdint>
+#include "Display.hpp"
+
+namespace RefreshCheck
+{
+	// Refresh the changed fields, print the number of bus writes that took and a hash of the frame, then redraw everything and check that the display is the same.
+	// If popups are open then the redraw is of the main window without them followed by opening them again, because a field that a popup
+	// covers partly is neither redrawn nor erased while the popup is open, and the parts of it that show are not compared.
+	bool Step(MainWindow& mgr, const char *name);
+
+	// Redraw everything as described above
+	void Redraw(MainWindow& mgr);
+}
+
+#endif /* REFRESHCHECK_H_ */
+
+// End
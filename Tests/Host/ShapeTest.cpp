@@ -0,0 +1,291 @@
+/*
+ * ShapeTest.cpp
+ *
+ * Checks the UTFT rectangle, rounded rectangle and circle functions in all 32 combinations of the orientation flags against a reference
+ * that plots the same shapes one pixel at a time, using the line-by-line and midpoint circle algorithms that UTFT used before it drew
+ * shapes as spans. The reference fills the whole of each circle span, which the old fillCircle did not.
+ * It prints the number of bus writes for each shape in landscape orientation, and compares a group of shapes with a golden image.
+ */
+
+#include <cstdio>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "SimDisplay.hpp"
+
+using HostTest::Check;
+
+const uint16_t background = 0x1234;
+
+// Reference renderer working on a logical frame buffer
+class Reference
+{
+public:
+	Reference() : width(SimDisplay::GetWidth()), height(SimDisplay::GetHeight()), colour(0), frame(width * height, background) { }
+
+	void SetColour(uint16_t c) { colour = c; }
+	const std::vector<uint16_t>& GetFrame() const { return frame; }
+
+	void Pixel(int x, int y)
+	{
+		if (x >= 0 && x < width && y >= 0 && y < height)
+		{
+			frame[y * width + x] = colour;
+		}
+	}
+
+	void HLine(int x, int y, int len)
+	{
+		for (int i = 0; i <= len; ++i)
+		{
+			Pixel(x + i, y);
+		}
+	}
+
+	void VLine(int x, int y, int len)
+	{
+		for (int i = 0; i <= len; ++i)
+		{
+			Pixel(x, y + i);
+		}
+	}
+
+	void DrawRect(int x1, int y1, int x2, int y2)
+	{
+		Order(x1, y1, x2, y2);
+		HLine(x1, y1, x2 - x1);
+		HLine(x1, y2, x2 - x1);
+		VLine(x1, y1, y2 - y1);
+		VLine(x2, y1, y2 - y1);
+	}
+
+	void DrawRoundRect(int x1, int y1, int x2, int y2)
+	{
+		Order(x1, y1, x2, y2);
+		if (x2 - x1 > 4 && y2 - y1 > 4)
+		{
+			Pixel(x1 + 1, y1 + 1);
+			Pixel(x2 - 1, y1 + 1);
+			Pixel(x1 + 1, y2 - 1);
+			Pixel(x2 - 1, y2 - 1);
+			HLine(x1 + 2, y1, x2 - x1 - 4);
+			HLine(x1 + 2, y2, x2 - x1 - 4);
+			VLine(x1, y1 + 2, y2 - y1 - 4);
+			VLine(x2, y1 + 2, y2 - y1 - 4);
+		}
+	}
+
+	// The gradient runs across the display's scan lines, which are columns in SwapXY orientations
+	void FillRect(int x1, int y1, int x2, int y2, uint16_t grad, uint8_t gradChange, bool swapXY)
+	{
+		Order(x1, y1, x2, y2);
+		const uint16_t save = colour;
+		unsigned int count = 0;
+		if (swapXY)
+		{
+			for (int i = x1; i <= x2; ++i)
+			{
+				VLine(i, y1, y2 - y1);
+				Step(count, grad, gradChange);
+			}
+		}
+		else
+		{
+			for (int i = y1; i <= y2; ++i)
+			{
+				HLine(x1, i, x2 - x1);
+				Step(count, grad, gradChange);
+			}
+		}
+		colour = save;
+	}
+
+	void FillRoundRect(int x1, int y1, int x2, int y2, uint16_t grad, uint8_t gradChange)
+	{
+		Order(x1, y1, x2, y2);
+		if (x2 - x1 > 4 && y2 - y1 > 4)
+		{
+			const uint16_t save = colour;
+			unsigned int count = 0;
+			for (int y = y1; y <= y2; ++y)
+			{
+				const int inset = (y == y1 || y == y2) ? 2 : (y == y1 + 1 || y == y2 - 1) ? 1 : 0;
+				HLine(x1 + inset, y, x2 - x1 - 2 * inset);
+				Step(count, grad, gradChange);
+			}
+			colour = save;
+		}
+	}
+
+	// Midpoint circle, calling 'span' with the centre offset and half width of each pair of symmetric spans
+	static void Midpoint(int radius, std::function<void(int, int)> span)
+	{
+		int f = 1 - radius, ddFx = 1, ddFy = -2 * radius, x1 = 0, y1 = radius;
+		span(radius, 0);
+		span(0, radius);
+		while (x1 < y1)
+		{
+			if (f >= 0)
+			{
+				--y1;
+				ddFy += 2;
+				f += ddFy;
+			}
+			++x1;
+			ddFx += 2;
+			f += ddFx;
+			span(y1, x1);
+			span(x1, y1);
+		}
+	}
+
+	void DrawCircle(int x, int y, int radius)
+	{
+		Midpoint(radius, [this, x, y](int dy, int halfWidth)
+			{
+				Pixel(x - halfWidth, y + dy);
+				Pixel(x + halfWidth, y + dy);
+				Pixel(x - halfWidth, y - dy);
+				Pixel(x + halfWidth, y - dy);
+			});
+	}
+
+	void FillCircle(int x, int y, int radius)
+	{
+		Midpoint(radius, [this, x, y](int dy, int halfWidth)
+			{
+				HLine(x - halfWidth, y + dy, 2 * halfWidth);
+				HLine(x - halfWidth, y - dy, 2 * halfWidth);
+			});
+	}
+
+private:
+	static void Order(int& x1, int& y1, int& x2, int& y2)
+	{
+		if (x1 > x2)
+		{
+			std::swap(x1, x2);
+		}
+		if (y1 > y2)
+		{
+			std::swap(y1, y2);
+		}
+	}
+
+	void Step(unsigned int& count, uint16_t grad, uint8_t gradChange)
+	{
+		if (grad != 0 && ++count == gradChange)
+		{
+			count = 0;
+			colour += grad;
+		}
+	}
+
+	int width, height;
+	uint16_t colour;
+	std::vector<uint16_t> frame;
+};
+
+struct Shape
+{
+	const char *name;
+	std::function<void()> draw;						// draw with UTFT
+	std::function<void(Reference&, bool)> reference;	// draw with the reference renderer, given whether SwapXY is set
+};
+
+const uint16_t buttonGradient = 0xFFFF - 0x0821 + 1;
+
+static const std::vector<Shape> shapes =
+{
+	{ "button 150x40 (gradient fill and outline)",
+		[]() { lcd.setColor(0x2222); lcd.fillRoundRect(100, 101, 249, 138, buttonGradient, 12); lcd.setColor(0x3333); lcd.drawRoundRect(100, 100, 249, 139); },
+		[](Reference& r, bool) { r.SetColour(0x2222); r.FillRoundRect(100, 101, 249, 138, buttonGradient, 12); r.SetColour(0x3333); r.DrawRoundRect(100, 100, 249, 139); } },
+	{ "popup 300x200 (fill and double border)",
+		[]() { lcd.setColor(0x4444); lcd.fillRoundRect(51, 52, 348, 247); lcd.setColor(0x5555); lcd.drawRoundRect(50, 50, 349, 249); lcd.drawRoundRect(51, 51, 348, 248); },
+		[](Reference& r, bool) { r.SetColour(0x4444); r.FillRoundRect(51, 52, 348, 247, 0, 1); r.SetColour(0x5555); r.DrawRoundRect(50, 50, 349, 249); r.DrawRoundRect(51, 51, 348, 248); } },
+	{ "fillRect 200x50",
+		[]() { lcd.setColor(0x6666); lcd.fillRect(209, 59, 10, 10); },
+		[](Reference& r, bool swapXY) { r.SetColour(0x6666); r.FillRect(10, 10, 209, 59, 0, 1, swapXY); } },
+	{ "fillRect 200x50 with gradient",
+		[]() { lcd.setColor(0x6666); lcd.fillRect(10, 10, 209, 59, 0x0021, 3); },
+		[](Reference& r, bool swapXY) { r.SetColour(0x6666); r.FillRect(10, 10, 209, 59, 0x0021, 3, swapXY); } },
+	{ "drawRect 200x50",
+		[]() { lcd.setColor(0x7777); lcd.drawRect(10, 59, 209, 10); },
+		[](Reference& r, bool) { r.SetColour(0x7777); r.DrawRect(10, 10, 209, 59); } },
+	{ "small rounded rectangles",
+		[]() { lcd.setColor(0x8888); lcd.fillRoundRect(10, 10, 14, 14); lcd.fillRoundRect(20, 10, 25, 16); lcd.drawRoundRect(30, 10, 35, 16); lcd.drawRoundRect(40, 10, 44, 14); },
+		[](Reference& r, bool) { r.SetColour(0x8888); r.FillRoundRect(10, 10, 14, 14, 0, 1); r.FillRoundRect(20, 10, 25, 16, 0, 1); r.DrawRoundRect(30, 10, 35, 16); r.DrawRoundRect(40, 10, 44, 14); } },
+	{ "fillCircle r=8",
+		[]() { lcd.setColor(0x9999); lcd.fillCircle(200, 200, 8); },
+		[](Reference& r, bool) { r.SetColour(0x9999); r.FillCircle(200, 200, 8); } },
+	{ "fillCircle r=40",
+		[]() { lcd.setColor(0x9999); lcd.fillCircle(200, 200, 40); },
+		[](Reference& r, bool) { r.SetColour(0x9999); r.FillCircle(200, 200, 40); } },
+	{ "drawCircle r=40",
+		[]() { lcd.setColor(0xAAAA); lcd.drawCircle(200, 200, 40); },
+		[](Reference& r, bool) { r.SetColour(0xAAAA); r.DrawCircle(200, 200, 40); } },
+	{ "circles r=0 to 5",
+		[]() { lcd.setColor(0xBBBB); for (int i = 0; i <= 5; ++i) { lcd.fillCircle(20 + 20 * i, 20, i); lcd.drawCircle(20 + 20 * i, 40, i); } },
+		[](Reference& r, bool) { r.SetColour(0xBBBB); for (int i = 0; i <= 5; ++i) { r.FillCircle(20 + 20 * i, 20, i); r.DrawCircle(20 + 20 * i, 40, i); } } },
+};
+
+int main(int argc, char **argv)
+{
+	for (const Shape& shape : shapes)
+	{
+		unsigned int failures = 0;
+		for (unsigned int flags = 0; flags < 32; ++flags)
+		{
+			SimDisplay::Init((DisplayOrientation)flags);
+			SimDisplay::Fill(background);
+			shape.draw();
+			const uint32_t writes = SimDisplay::TakeBusWrites();
+
+			Reference ref;
+			shape.reference(ref, (flags & SwapXY) != 0);
+			unsigned int wrong = 0;
+			const std::vector<uint16_t> frame = SimDisplay::GetFrame();
+			for (size_t i = 0; i < frame.size(); ++i)
+			{
+				if (frame[i] != ref.GetFrame()[i])
+				{
+					++wrong;
+				}
+			}
+			if (wrong != 0)
+			{
+				++failures;
+				printf("%s, orientation 0x%02x: %u pixels differ from reference\n", shape.name, flags, wrong);
+			}
+			if (flags == Landscape)
+			{
+				printf("%-42s %6u bus writes\n", shape.name, writes);
+			}
+		}
+		Check(failures == 0 && SimDisplay::GetErrors() == 0, "%s: differs from reference in %u orientations", shape.name, failures);
+	}
+
+	// A popup holding a button and some circles, as the display shows them in landscape orientation
+	SimDisplay::Init(Landscape);
+	SimDisplay::Fill(0);
+	lcd.setColor(0x4208);
+	lcd.fillRoundRect(11, 12, 248, 167);
+	lcd.setColor(0xFFFF);
+	lcd.drawRoundRect(10, 10, 249, 169);
+	lcd.drawRoundRect(11, 11, 248, 168);
+	lcd.setColor(0x04DF);
+	lcd.fillRoundRect(30, 31, 179, 68, buttonGradient, 12);
+	lcd.setColor(0xFFFF);
+	lcd.drawRoundRect(30, 30, 179, 69);
+	lcd.setColor(0xF800);
+	lcd.fillCircle(70, 120, 30);
+	lcd.setColor(0x07E0);
+	lcd.drawCircle(150, 120, 30);
+	lcd.setColor(0xFFE0);
+	lcd.fillRect(200, 90, 229, 150, 0xFFFF - 0x0841 + 1, 4);
+	SimDisplay::CheckImage("Shapes", 0, 0, 260, 180);
+
+	return HostTest::Result();
+}
+
+// End
@@ -0,0 +1,44 @@
+/*
+ * SimBus.h
+ *
+ * Bus layer for the host build, selected by defining UTFT_BUS_HEADER as "SimBus.h". It replaces HW_AVR.h and passes
+ * every word that UTFT writes to the simulated display controller in SimDisplay.cpp.
+ */
+
+#ifndef SIMBUS_H_
+#define SIMBUS_H_
+
+#include "SimDisplay.hpp"
+
+void UTFT::LCD_Write_Bus(uint16_t VHL)
+{
+#ifdef UTFT_STATISTICS
+	++stats.busWrites;
+#endif
+	SimDisplay::BusWrite(VHL);
+}
+
+void UTFT::LCD_Write_Again(uint32_t num)
+{
+#ifdef UTFT_STATISTICS
+	stats.busWrites += num;
+#endif
+	SimDisplay::BusWriteAgain(num);
+}
+
+void UTFT::_set_direction_registers()
+{
+}
+
+#ifdef UTFT_READBACK
+
+uint16_t UTFT::LCD_Read_Bus()
+{
+	return SimDisplay::BusRead();
+}
+
+#endif
+
+#endif /* SIMBUS_H_ */
+
+// End
@@ -0,0 +1,429 @@
+/*
+ * SimDisplay.cpp
+ *
+ * Simulated SSD1963 display controller and the other hardware stubs that the host tests need.
+ */
+
+// The standard headers come first, because ecv.h defines macros such as "value" and "array" that they use as identifiers
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "SimDisplay.hpp"
+#include "Hardware/OneBitPort.hpp"
+#include "Hardware/SysTick.hpp"
+
+UTFT lcd(UTFT_CONTROLLER, TMode16bit, SimDisplay::RsPin, SimDisplay::WrPin, SimDisplay::CsPin, SimDisplay::RstPin);
+
+// Port pins write to these instead of the PIO controllers
+static Pio simPorts[64];
+
+OneBitPort::OneBitPort(unsigned int pin) : port(&simPorts[pin]), mask(1) { }
+void OneBitPort::setMode(PortMode mode) { }
+void OneBitPort::delay(uint8_t del) { }
+extern "C" void portable_delay_cycles(unsigned long n) { }
+
+namespace SimDisplay
+{
+	static DisplayOrientation orient;
+	static int dispX, dispY;							// physical size minus 1, as disp_x_size and disp_y_size in UTFT
+	static int width, height;							// logical size
+	static std::vector<uint16_t> frame;					// frame memory in logical coordinates
+
+	static bool rsHigh = false;
+	static int command = -1;
+	static unsigned int numParams = 0;
+	static uint16_t params[8];
+	static int physX1, physX2, physY1, physY2;			// address window in physical coordinates
+	static int winX1, winX2, winY1, winY2;				// address window in logical coordinates
+	static bool inWindow = false;
+	static int fillPos;
+	static uint16_t lastData;
+	static int scrollTop = 0, scrollArea = 0, scrollStart = 0;
+	static unsigned long errors = 0;
+	static uint64_t totalBusWrites = 0;
+
+	void Init(DisplayOrientation o)
+	{
+		orient = o;
+		lcd.InitLCD(o, false);
+		width = lcd.getDisplayXSize();
+		height = lcd.getDisplayYSize();
+		dispX = ((o & SwapXY) ? height : width) - 1;
+		dispY = ((o & SwapXY) ? width : height) - 1;
+		frame.assign(width * height, 0);
+		scrollTop = scrollArea = scrollStart = 0;
+		errors = 0;
+		lcd.resetStatistics();
+	}
+
+	int GetWidth() { return width; }
+	int GetHeight() { return height; }
+
+	void Fill(uint16_t colour)
+	{
+		std::fill(frame.begin(), frame.end(), colour);
+	}
+
+	void SetPixel(int x, int y, uint16_t colour)
+	{
+		frame[y * width + x] = colour;
+	}
+
+	// Undo the transformation that UTFT::setXY applies, to get the address window in logical coordinates
+	static void StartMemoryAccess()
+	{
+		int x1 = physX1, x2 = physX2, y1 = physY1, y2 = physY2;
+		if (orient & SwapXY)
+		{
+			if (orient & ReverseY)
+			{
+				x1 = dispX - x1;
+				x2 = dispX - x2;
+				std::swap(x1, x2);
+			}
+			if (orient & ReverseX)
+			{
+				y1 = dispY - y1;
+				y2 = dispY - y2;
+				std::swap(y1, y2);
+			}
+			winX1 = y1; winX2 = y2; winY1 = x1; winY2 = x2;
+		}
+		else
+		{
+			if (orient & ReverseY)
+			{
+				y1 = dispY - y1;
+				y2 = dispY - y2;
+				std::swap(y1, y2);
+			}
+			if (orient & ReverseX)
+			{
+				x1 = dispX - x1;
+				x2 = dispX - x2;
+				std::swap(x1, x2);
+			}
+			winX1 = x1; winX2 = x2; winY1 = y1; winY2 = y2;
+		}
+		fillPos = 0;
+		inWindow = true;
+	}
+
+	// Return the frame memory index of the next pixel in the address window and advance, or -1 if we have run off the end of the window.
+	// The controller fills the window by columns when SwapXY is set, right to left with InvertBitmap and bottom to top with InvertText.
+	static int NextPixel()
+	{
+		const int w = winX2 - winX1 + 1, h = winY2 - winY1 + 1;
+		if (!inWindow || fillPos >= w * h)
+		{
+			++errors;
+			return -1;
+		}
+		int x, y;
+		if (orient & SwapXY)
+		{
+			x = fillPos / h;
+			y = fillPos % h;
+		}
+		else
+		{
+			y = fillPos / w;
+			x = fillPos % w;
+		}
+		if (orient & InvertBitmap)
+		{
+			x = w - 1 - x;
+		}
+		if (orient & InvertText)
+		{
+			y = h - 1 - y;
+		}
+		x += winX1;
+		y += winY1;
+		++fillPos;
+		return (x >= 0 && x < width && y >= 0 && y < height) ? y * width + x : -1;
+	}
+
+	static inline int Param16(unsigned int n)
+	{
+		return (params[n] << 8) | (params[n + 1] & 0xFF);
+	}
+
+	void BusWrite(uint16_t val)
+	{
+		++totalBusWrites;
+		Pio& rs = simPorts[RsPin];
+		if (rs.PIO_CODR != 0)
+		{
+			rsHigh = false;
+			rs.PIO_CODR = 0;
+		}
+		if (rs.PIO_SODR != 0)
+		{
+			rsHigh = true;
+			rs.PIO_SODR = 0;
+		}
+
+		if (!rsHigh)
+		{
+			command = val;
+			numParams = 0;
+			inWindow = false;
+			if (val == 0x2C || val == 0x2E)				// write memory start, read memory start
+			{
+				StartMemoryAccess();
+			}
+		}
+		else if (command == 0x2C)
+		{
+			lastData = val;
+			const int i = NextPixel();
+			if (i >= 0)
+			{
+				frame[i] = val;
+			}
+		}
+		else
+		{
+			if (numParams < 8)
+			{
+				params[numParams++] = val;
+			}
+			switch (command)
+			{
+			case 0x2A:									// set column address
+				if (numParams == 4)
+				{
+					physY1 = Param16(0);
+					physY2 = Param16(2);
+				}
+				break;
+			case 0x2B:									// set page address
+				if (numParams == 4)
+				{
+					physX1 = Param16(0);
+					physX2 = Param16(2);
+				}
+				break;
+			case 0x33:									// set vertical scroll area
+				if (numParams == 6)
+				{
+					scrollTop = Param16(0);
+					scrollArea = Param16(2);
+				}
+				break;
+			case 0x37:									// set vertical scroll start
+				if (numParams == 2)
+				{
+					scrollStart = Param16(0);
+				}
+				break;
+			default:
+				break;
+			}
+		}
+	}
+
+	void BusWriteAgain(uint32_t num)
+	{
+		totalBusWrites += num;
+		if (command == 0x2C)
+		{
+			while (num-- != 0)
+			{
+				const int i = NextPixel();
+				if (i >= 0)
+				{
+					frame[i] = lastData;
+				}
+			}
+		}
+	}
+
+	uint16_t BusRead()
+	{
+		if (command != 0x2E)
+		{
+			return 0;
+		}
+		const int i = NextPixel();
+		return (i >= 0) ? frame[i] : 0;
+	}
+
+	uint16_t GetPixel(int x, int y)
+	{
+		// Hardware scrolling applies to panel lines, which are logical rows in landscape orientations
+		int line = (orient & ReverseY) ? dispX - y : y;
+		if (scrollArea != 0 && line >= scrollTop && line < scrollTop + scrollArea)
+		{
+			line = scrollTop + ((scrollStart - scrollTop) + (line - scrollTop)) % scrollArea;
+		}
+		const int row = (orient & ReverseY) ? dispX - line : line;
+		return frame[row * width + x];
+	}
+
+	std::vector<uint16_t> GetFrame()
+	{
+		std::vector<uint16_t> f(width * height);
+		for (int y = 0; y < height; ++y)
+		{
+			for (int x = 0; x < width; ++x)
+			{
+				f[y * width + x] = GetPixel(x, y);
+			}
+		}
+		return f;
+	}
+
+	uint64_t Hash()
+	{
+		uint64_t h = 14695981039346656037ull;
+		for (uint16_t v : GetFrame())
+		{
+			h = (h ^ v) * 1099511628211ull;
+		}
+		return h;
+	}
+
+	unsigned long GetErrors()
+	{
+		return errors;
+	}
+
+	uint32_t TakeBusWrites()
+	{
+		const uint32_t n = lcd.getStatistics().busWrites;
+		lcd.resetStatistics();
+		return n;
+	}
+
+	static std::string GetDirectory(const char *envName, const char *dflt)
+	{
+		const char *dir = getenv(envName);
+		return std::string((dir != nullptr) ? dir : dflt) + "/";
+	}
+
+	static bool WritePpm(const std::string& filename, const std::vector<uint8_t>& rgb, int w, int h)
+	{
+		FILE *f = fopen(filename.c_str(), "wb");
+		if (f == nullptr)
+		{
+			return false;
+		}
+		fprintf(f, "P6\n%d %d\n255\n", w, h);
+		fwrite(rgb.data(), 1, rgb.size(), f);
+		fclose(f);
+		return true;
+	}
+
+	static bool ReadPpm(const std::string& filename, std::vector<uint8_t>& rgb, int& w, int& h)
+	{
+		FILE *f = fopen(filename.c_str(), "rb");
+		if (f == nullptr)
+		{
+			return false;
+		}
+		int maxVal;
+		const bool ok = fscanf(f, "P6 %d %d %d", &w, &h, &maxVal) == 3 && maxVal == 255 && fgetc(f) != EOF;
+		if (ok)
+		{
+			rgb.resize(w * h * 3);
+			const bool complete = fread(rgb.data(), 1, rgb.size(), f) == rgb.size();
+			fclose(f);
+			return complete;
+		}
+		fclose(f);
+		return false;
+	}
+
+	bool CheckImage(const char *name, int x, int y, int w, int h)
+	{
+		// Convert RGB565 to 8 bits per channel, copying the top bits of each channel into the bottom ones
+		std::vector<uint8_t> rgb;
+		rgb.reserve(w * h * 3);
+		for (int row = y; row < y + h; ++row)
+		{
+			for (int col = x; col < x + w; ++col)
+			{
+				const uint16_t c = GetPixel(col, row);
+				const unsigned int r = c >> 11, g = (c >> 5) & 0x3F, b = c & 0x1F;
+				rgb.push_back((uint8_t)((r << 3) | (r >> 2)));
+				rgb.push_back((uint8_t)((g << 2) | (g >> 4)));
+				rgb.push_back((uint8_t)((b << 3) | (b >> 2)));
+			}
+		}
+
+		const std::string filename = std::string(name) + ".ppm";
+		WritePpm(GetDirectory("HOST_TEST_OUTPUT", "build") + filename, rgb, w, h);
+		const std::string golden = GetDirectory("HOST_TEST_GOLDEN", "Golden") + filename;
+		if (getenv("UPDATE_GOLDEN") != nullptr)
+		{
+			const bool written = WritePpm(golden, rgb, w, h);
+			printf("image %s: %s\n", name, (written) ? "golden image written" : "could not write golden image");
+			return written;
+		}
+
+		std::vector<uint8_t> expected;
+		int gw, gh;
+		if (!ReadPpm(golden, expected, gw, gh))
+		{
+			return HostTest::Check(false, "image %s: no golden image %s", name, golden.c_str());
+		}
+		if (gw != w || gh != h)
+		{
+			return HostTest::Check(false, "image %s: size %dx%d, golden image is %dx%d", name, w, h, gw, gh);
+		}
+		unsigned int differ = 0;
+		for (size_t i = 0; i < rgb.size(); i += 3)
+		{
+			if (memcmp(&rgb[i], &expected[i], 3) != 0)
+			{
+				++differ;
+			}
+		}
+		printf("image %s: %s\n", name, (differ == 0) ? "matches golden image" : "differs from golden image");
+		return HostTest::Check(differ == 0, "image %s: %u pixels differ from %s", name, differ, golden.c_str());
+	}
+}
+
+// Pretend time: the refresh budget is measured in ticks, so make them depend only on how much has been sent to the display
+uint32_t SystemTick::GetTickCount()
+{
+	return (uint32_t)(SimDisplay::totalBusWrites / SimDisplay::BusWritesPerTick);
+}
+
+namespace HostTest
+{
+	static unsigned int failures = 0;
+
+	bool Check(bool ok, const char *fmt, ...)
+	{
+		if (!ok)
+		{
+			++failures;
+			va_list args;
+			va_start(args, fmt);
+			printf("FAIL: ");
+			vprintf(fmt, args);
+			printf("\n");
+			va_end(args);
+		}
+		return ok;
+	}
+
+	int Result()
+	{
+		printf("%u failures\n", failures);
+		return (failures == 0) ? 0 : 1;
+	}
+
+	bool Benchmarking(int argc, char **argv)
+	{
+		return argc > 1 && strcmp(argv[1], "--bench") == 0;
+	}
+}
+
+// End
@@ -0,0 +1,57 @@
+/*
+ * SimDisplay.hpp
+ *
+ * Simulated SSD1963 display controller for the host tests. UTFT drives it through SimBus.h. It decodes the commands that UTFT sends
+ * (column and page address, write and read memory, vertical scroll) into a frame buffer held in logical coordinates, i.e. the
+ * coordinates that UTFT's callers use in the current orientation.
+ */
+
+#ifndef SIMDISPLAY_H_
+#define SIMDISPLAY_H_
+
+#include <cstdint>
+#include <vector>
+#include "Hardware/UTFT.hpp"
+
+extern UTFT lcd;
+
+namespace SimDisplay
+{
+	// Port pins that the UTFT object is constructed with. We only need to watch RS, to tell commands from data.
+	const unsigned int RsPin = 16, WrPin = 17, CsPin = 18, RstPin = 19;
+
+	// SystemTick::GetTickCount returns the number of bus writes so far divided by this, i.e. we pretend that 5000 writes take 1ms
+	const uint32_t BusWritesPerTick = 5000;
+
+	void Init(DisplayOrientation orient);				// initialise the display in the given orientation and clear the frame memory
+	int GetWidth();										// logical width in the current orientation
+	int GetHeight();									// logical height in the current orientation
+	void Fill(uint16_t colour);							// set the whole frame memory without using the bus
+	void SetPixel(int x, int y, uint16_t colour);		// set one pixel of frame memory without using the bus
+	uint16_t GetPixel(int x, int y);					// the pixel shown at logical (x, y), taking account of hardware scrolling
+	std::vector<uint16_t> GetFrame();					// all the pixels shown, a row at a time
+	uint64_t Hash();									// FNV-1a hash of GetFrame()
+	unsigned long GetErrors();							// number of pixels written or read outside the current address window
+	uint32_t TakeBusWrites();							// return the number of bus writes that UTFT has counted and reset the count
+
+	// Write the w x h area at (x, y) to <name>.ppm in the output directory and compare it with <name>.ppm in the golden image directory.
+	// If the environment variable UPDATE_GOLDEN is set, write the golden image instead.
+	bool CheckImage(const char *name, int x, int y, int w, int h);
+
+	// Bus interface used by SimBus.h
+	void BusWrite(uint16_t val);
+	void BusWriteAgain(uint32_t num);
+	uint16_t BusRead();
+}
+
+// Test result reporting
+namespace HostTest
+{
+	bool Check(bool ok, const char *fmt, ...) __attribute__ ((format (printf, 2, 3)));		// if !ok, print "FAIL: " and the message and count a failure
+	int Result();																			// print the number of failures and return the exit code
+	bool Benchmarking(int argc, char **argv);												// true if the test was run with --bench
+}
+
+#endif /* SIMDISPLAY_H_ */
+
+// End
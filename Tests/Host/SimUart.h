@@ -0,0 +1,39 @@
+/*
+ * SimUart.h
+ *
+ * Host build of the serial I/O module only. It is included ahead of SerialIo.cpp on the command line, and replaces the parts of the
+ * ASF that need the real CPU: the interrupt enable and disable functions, which use Cortex-M instructions, and UART1, which becomes
+ * the simulated UART in ParserTest.cpp. The ASF UART and PIO driver functions that SerialIo.cpp calls are defined there too.
+ */
+
+#ifndef SIMUART_H_
+#define SIMUART_H_
+
+#include <cstdint>
+
+// Defining the include guard of interrupt_sam_nvic.h stops compiler.h including it, so these take the place of what it provides
+#define UTILS_INTERRUPT_INTERRUPT_H
+
+typedef uint32_t irqflags_t;
+
+#define irq_register_handler(int_num, int_prio)
+
+static inline irqflags_t cpu_irq_save()
+{
+	return 0;
+}
+
+static inline void cpu_irq_restore(irqflags_t flags)
+{
+}
+
+#include "asf.h"
+
+extern Uart simUart;
+
+#undef UART1
+#define UART1	(&simUart)
+
+#endif /* SIMUART_H_ */
+
+// End
@@ -0,0 +1,13 @@
+/*
+ * compiler.h
+ *
+ * Host build only. The ASF compiler.h defines min and max as macros, which clash with the templates in Library/Misc.hpp
+ * and with the host's standard library, so we include it and then remove them.
+ */
+
+#include_next <compiler.h>
+
+#undef min
+#undef max
+
+// End
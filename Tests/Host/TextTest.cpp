@@ -0,0 +1,227 @@
+/*
+ * TextTest.cpp
+ *
+ * Checks text drawing and measuring:
+ * - TextMeasurer gives the same width as UTFT advances when it draws the same text, for each font including one with no generated
+ *   metrics tables, and measuring sends nothing to the display
+ * - text comes out the same in all 32 combinations of the orientation flags, and the same with a transparent background as with an
+ *   opaque one of the same colour
+ * - text fields are not redrawn when their text is unchanged, and are redrawn when different text happens to have the same hash
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "SimDisplay.hpp"
+#include "Display.hpp"
+#include "Hardware/FontMetrics.hpp"
+#include "RefreshCheck.hpp"
+
+using HostTest::Check;
+
+extern const uint8_t glcd19x20[];					// no metrics tables are generated for this one
+extern const uint8_t glcd19x21[];
+extern const uint8_t glcd28x32[];
+
+struct Font
+{
+	const char *name;
+	const uint8_t *data;
+};
+
+static const Font fonts[] = { { "glcd19x20", glcd19x20 }, { "glcd19x21", glcd19x21 }, { "glcd28x32", glcd28x32 } };
+
+// Append the UTF-8 encoding of a character in the range 0x20 to 0xFF, which is what the fonts cover
+static void AppendUtf8(std::string& s, unsigned int c)
+{
+	if (c < 0x80)
+	{
+		s += (char)c;
+	}
+	else
+	{
+		s += (char)(0xC0 | (c >> 6));
+		s += (char)(0x80 | (c & 0x3F));
+	}
+}
+
+static std::string RandomText()
+{
+	std::string s;
+	const int len = 1 + rand() % 40;
+	for (int i = 0; i < len; ++i)
+	{
+		AppendUtf8(s, (rand() % 4 == 0) ? 0x20 + rand() % 0xE0 : 0x20 + rand() % 0x5F);
+	}
+	return s;
+}
+
+static void TestMeasurement()
+{
+	SimDisplay::Init(Landscape);
+	srand(4);
+	for (const Font& font : fonts)
+	{
+		unsigned int mismatches = 0, busWrites = 0;
+		lcd.setFont(font.data);
+		for (int i = 0; i < 20000; ++i)
+		{
+			const std::string s = RandomText();
+			const uint16_t x = rand() % 400, margin = x + 1 + rand() % 400;		// UTFT also clips to the screen width
+			lcd.resetStatistics();
+			TextMeasurer measurer(font.data, margin - x);
+			measurer.print(s.c_str());
+			busWrites += SimDisplay::TakeBusWrites();
+
+			lcd.setTextPos(x, 100, margin);
+			lcd.print(s.c_str());
+			if (lcd.getTextX() - x != measurer.GetWidth())
+			{
+				if (++mismatches <= 3)
+				{
+					printf("%s: \"%s\" with margin %u drawn %u wide, measured %u\n", font.name, s.c_str(), margin - x, lcd.getTextX() - x, measurer.GetWidth());
+				}
+			}
+		}
+		Check(mismatches == 0 && busWrites == 0, "%s: %u measured widths differ from the drawn width, %u bus writes while measuring", font.name, mismatches, busWrites);
+	}
+}
+
+static void TestOrientations()
+{
+	const char *text = "Hello, World! 205.4\xC2\xB0" "C Wij AV";
+	for (const Font& font : fonts)
+	{
+		std::vector<uint16_t> reference;
+		unsigned int failures = 0;
+		for (unsigned int flags = 0; flags < 32; ++flags)
+		{
+			for (int transparent = 0; transparent < 2; ++transparent)
+			{
+				SimDisplay::Init((DisplayOrientation)flags);
+				SimDisplay::Fill(0x0010);
+				lcd.setFont(font.data);
+				lcd.setColor(0xFFE0);
+				lcd.setBackColor(0x0010);
+				lcd.setTransparentBackground(transparent);
+				lcd.print(text, 7, 9, 440);
+				if (flags == Landscape && !transparent)
+				{
+					printf("%s: %u bus writes opaque, ", font.name, SimDisplay::TakeBusWrites());
+				}
+				else if (flags == Landscape)
+				{
+					printf("%u transparent\n", SimDisplay::TakeBusWrites());
+				}
+
+				std::vector<uint16_t> area;
+				for (int y = 0; y < 50; ++y)
+				{
+					for (int x = 0; x < 460; ++x)
+					{
+						area.push_back(SimDisplay::GetPixel(x, y));
+					}
+				}
+				if (reference.empty())
+				{
+					reference = area;
+				}
+				else if (area != reference)
+				{
+					++failures;
+				}
+			}
+		}
+		lcd.setTransparentBackground(false);
+		Check(failures == 0 && SimDisplay::GetErrors() == 0, "%s: text differs in %u orientations", font.name, failures);
+	}
+
+	SimDisplay::Init(Landscape);
+	SimDisplay::Fill(0);
+	lcd.setColor(0xFFFF);
+	lcd.setBackColor(0);
+	for (size_t i = 0; i < sizeof(fonts)/sizeof(fonts[0]); ++i)
+	{
+		lcd.setFont(fonts[i].data);
+		lcd.print(text, 4, 4 + 36 * i, 400);
+	}
+	SimDisplay::CheckImage("Text", 0, 0, 400, 110);
+}
+
+static const DisplayStyle styles[] =
+{
+	{ COLOUR_ROLE(labelTextColour), COLOUR_ROLE(defaultBackColour) },
+	{ COLOUR_ROLE(errorTextColour), COLOUR_ROLE(errorBackColour) }
+};
+
+static MainWindow mgr;
+
+static void Step(const char *name)
+{
+	RefreshCheck::Step(mgr, name);
+}
+
+static void TestFields()
+{
+	SimDisplay::Init(Landscape);
+	DisplayField::SetDefaultFont(glcd19x21);
+	DisplayField::SetStyles(styles);
+	DisplayField::SetColourScheme(colourSchemes[0]);
+	mgr.Init(colourSchemes[0].defaultBackColour);
+
+	FloatField *floats[3];
+	IntegerField *integers[3];
+	for (int i = 0; i < 3; ++i)
+	{
+		mgr.AddField(floats[i] = new FloatField(10 + 30 * i, 10, 150, (TextAlignment)i, 1));
+		floats[i]->SetValue(205.01);
+		mgr.AddField(integers[i] = new IntegerField(120 + 30 * i, 10, 150, (TextAlignment)i, "T ", "C"));
+		integers[i]->SetValue(42);
+	}
+	IntegerField *plain = new IntegerField(220, 10, 150, TextAlignment::Right);
+	mgr.AddField(plain);
+	plain->SetValue(1);
+	StaticTextField *message = new StaticTextField(250, 10, 700, TextAlignment::Centre, "A long message that does not fit in the text buffer of thirty-two bytes");
+	mgr.AddField(message);
+
+	mgr.Refresh(true);
+	printf("%-28s %6u bus writes\n", "full", SimDisplay::TakeBusWrites());
+	for (int i = 0; i < 3; ++i)
+	{
+		floats[i]->SetValue(205.04);
+		integers[i]->SetValue(42);
+	}
+	Step("same text");
+	for (int i = 0; i < 3; ++i)
+	{
+		floats[i]->SetValue(206.5);
+		integers[i]->SetValue(43);
+	}
+	Step("new values");
+	floats[1]->SetStyle(1);
+	Step("restyle");
+	floats[1]->SetValue(206.52);
+	floats[1]->SetStyle(0);
+	Step("value and style");
+	message->SetValue("Short");
+	Step("message");
+
+	// "40189" and "797186" have the same FNV-1a hash
+	plain->SetValue(40189);
+	Step("hash collision, first");
+	plain->SetValue(797186);
+	Step("hash collision, second");
+	mgr.Refresh(false);
+	Check(SimDisplay::TakeBusWrites() == 0, "idle refresh wrote to the display");
+}
+
+int main(int argc, char **argv)
+{
+	TestMeasurement();
+	TestOrientations();
+	TestFields();
+	return HostTest::Result();
+}
+
+// End
@@ -0,0 +1,205 @@
+/*
+ * TouchTest.cpp
+ *
+ * Checks that finding the button that was touched through the window's grid index gives the same result as searching the whole field list,
+ * as the firmware did before it had the index. The page has a grid of 192 buttons with text fields between them, some of the buttons hidden,
+ * and every pixel of the display and a margin beyond it is tried. A touch counts if it is within 8 pixels of a visible button; if several
+ * are that close then the nearest wins, and of those equally near, the first in the list.
+ * The windows share one index. It is allocated once, the first time that it is used, so touches that alternate between two windows must
+ * find the right buttons without allocating memory. A window that gets more buttons than the index was reserved for is searched without it.
+ * With --bench it times both ways of finding the button.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "SimDisplay.hpp"
+#include "Display.hpp"
+
+using HostTest::Check;
+
+extern const uint8_t glcd19x21[];
+
+static MainWindow mgr, other;
+static PixelNumber displayWidth, displayHeight;
+
+// Count the arrays allocated, which is how the index gets its entries
+static unsigned int arrayAllocations = 0;
+
+void *operator new[](size_t size)
+{
+	++arrayAllocations;
+	return malloc(size);
+}
+
+void operator delete[](void *p) noexcept
+{
+	free(p);
+}
+
+// Find the button that was touched by looking at every field
+static ButtonPress FindEventLinear(const Window& w, PixelNumber x, PixelNumber y)
+{
+	const int maxXerror = 8, maxYerror = 8;
+	int bestError = maxXerror + maxYerror;
+	ButtonBase *best = nullptr;
+	for (DisplayField *p = w.GetRoot(); p != nullptr; p = p->next)
+	{
+		if (p->IsVisible() && p->GetEvent() != nullEvent)
+		{
+			const int xError = (x < p->GetMinX()) ? p->GetMinX() - x : (x > p->GetMaxX()) ? x - p->GetMaxX() : 0;
+			const int yError = (y < p->GetMinY()) ? p->GetMinY() - y : (y > p->GetMaxY()) ? y - p->GetMaxY() : 0;
+			if (xError < maxXerror && yError < maxYerror && xError + yError < bestError)
+			{
+				bestError = xError + yError;
+				best = static_cast<ButtonBase*>(p);
+			}
+		}
+	}
+	return (best == nullptr) ? ButtonPress() : ButtonPress(best, best->GetIndexAt(x, y));
+}
+
+static void Benchmark()
+{
+	const int repeats = 4;
+	unsigned long hits = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < repeats; ++i)
+	{
+		for (PixelNumber y = 0; y < displayHeight; ++y)
+		{
+			for (PixelNumber x = 0; x < displayWidth; ++x)
+			{
+				hits += FindEventLinear(mgr, x, y).IsValid();
+			}
+		}
+	}
+	const auto middle = std::chrono::steady_clock::now();
+	for (int i = 0; i < repeats; ++i)
+	{
+		for (PixelNumber y = 0; y < displayHeight; ++y)
+		{
+			for (PixelNumber x = 0; x < displayWidth; ++x)
+			{
+				hits += mgr.FindEvent(x, y).IsValid();
+			}
+		}
+	}
+	const auto end = std::chrono::steady_clock::now();
+	const double lookups = (double)repeats * displayWidth * displayHeight;
+	printf("search field list: %.1f ns per touch\n", std::chrono::duration<double, std::nano>(middle - start).count()/lookups);
+	printf("grid index: %.1f ns per touch (%lu hits)\n", std::chrono::duration<double, std::nano>(end - middle).count()/lookups, hits);
+}
+
+int main(int argc, char **argv)
+{
+	SimDisplay::Init(Landscape);
+	displayWidth = SimDisplay::GetWidth();
+	displayHeight = SimDisplay::GetHeight();
+	DisplayField::SetDefaultFont(glcd19x21);
+	ButtonWithText::SetFont(glcd19x21);
+	mgr.Init(colourSchemes[0].defaultBackColour);
+
+	// 12 rows of 16 buttons of three different heights, alternately offset by 4 pixels, with a text field under each one
+	unsigned int numButtons = 0, numHidden = 0;
+	for (int row = 0; row < 12; ++row)
+	{
+		for (int col = 0; col < 16; ++col)
+		{
+			TextButton *b = new TextButton(row * 40 + 3 + (col & 1) * 4, col * 50 + 2, 44 + (row % 3) * 4, "X", (event_t)(1 + numButtons % 50), numButtons);
+			if (numButtons % 7 == 3)
+			{
+				b->Show(false);
+				++numHidden;
+			}
+			mgr.AddField(b);
+			mgr.AddField(new StaticTextField(row * 40, col * 50, 40, TextAlignment::Left, "t"));
+			++numButtons;
+		}
+	}
+
+	// A second window with a few buttons
+	other.Init(colourSchemes[0].defaultBackColour);
+	for (int i = 0; i < 12; ++i)
+	{
+		other.AddField(new TextButton(100 + (i / 4) * 60, 100 + (i % 4) * 150, 140, "Z", (event_t)(1 + i), i));
+	}
+
+	Window::ReserveFieldIndex(mgr.GetRoot());
+	Window::ReserveFieldIndex(other.GetRoot());
+	const unsigned int allocationsBefore = arrayAllocations;
+
+	if (HostTest::Benchmarking(argc, argv))
+	{
+		Benchmark();
+		return 0;
+	}
+
+	unsigned int touches = 0, hits = 0, mismatches = 0;
+	for (PixelNumber y = 0; y < displayHeight + 20; ++y)
+	{
+		for (PixelNumber x = 0; x < displayWidth + 20; ++x)
+		{
+			const ButtonPress expected = FindEventLinear(mgr, x, y);
+			++touches;
+			if (expected.IsValid())
+			{
+				++hits;
+			}
+			if (mgr.FindEvent(x, y) != expected && ++mismatches <= 3)
+			{
+				printf("touch at (%u, %u) found a different button\n", x, y);
+			}
+		}
+	}
+	printf("%u buttons (%u hidden), %u touches, %u on buttons\n", numButtons, numHidden, touches, hits);
+	Check(mismatches == 0, "%u touches found a different button from searching the field list", mismatches);
+
+	// Alternate between the two windows, as happens when a popup is open and the user touches outside it
+	touches = hits = mismatches = 0;
+	for (PixelNumber y = 0; y < displayHeight; y += 3)
+	{
+		for (PixelNumber x = 0; x < displayWidth; x += 3)
+		{
+			for (Window *w : { (Window *)&mgr, (Window *)&other })
+			{
+				const ButtonPress expected = FindEventLinear(*w, x, y);
+				++touches;
+				hits += expected.IsValid();
+				if (w->FindEvent(x, y) != expected && ++mismatches <= 3)
+				{
+					printf("touch at (%u, %u) in %s window found a different button\n", x, y, (w == &mgr) ? "first" : "second");
+				}
+			}
+		}
+	}
+	printf("two windows: %u touches, %u on buttons\n", touches, hits);
+	Check(mismatches == 0, "two windows: %u touches found a different button from searching the field list", mismatches);
+
+	// Add a row of buttons to the first window, so that it needs more entries than the index has
+	for (int col = 0; col < 16; ++col)
+	{
+		mgr.AddField(new TextButton(displayHeight - 30, col * 50 + 2, 44, "Y", (event_t)(1 + col), col));
+	}
+	touches = hits = mismatches = 0;
+	for (PixelNumber y = 0; y < displayHeight; y += 3)
+	{
+		for (PixelNumber x = 0; x < displayWidth; x += 3)
+		{
+			const ButtonPress expected = FindEventLinear(mgr, x, y);
+			++touches;
+			hits += expected.IsValid();
+			if (mgr.FindEvent(x, y) != expected && ++mismatches <= 3)
+			{
+				printf("touch at (%u, %u) after adding buttons found a different button\n", x, y);
+			}
+		}
+	}
+	printf("after adding 16 buttons: %u touches, %u on buttons\n", touches, hits);
+	Check(mismatches == 0, "after adding buttons: %u touches found a different button from searching the field list", mismatches);
+	printf("allocations of index entries: %u\n", arrayAllocations - allocationsBefore);
+	Check(arrayAllocations - allocationsBefore == 1, "index entries allocated %u times", arrayAllocations - allocationsBefore);
+	return HostTest::Result();
+}
+
+// End
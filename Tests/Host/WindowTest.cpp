@@ -0,0 +1,411 @@
+/*
+ * WindowTest.cpp
+ *
+ * Checks the window and field refresh logic on a page laid out like the PanelDue control page:
+ * - after each change (values, styles, show and hide, popups, changes under a popup, page switches and button presses), refreshing only
+ *   what has changed gives the same frame as redrawing everything
+ * - with a refresh budget, a burst of changes is spread over several passes and a pressed button is drawn in the first pass
+ * - a row of buttons looks and behaves like the same buttons created separately: the same frames when drawn, pressed, released, hidden and
+ *   shown, and the same button and parameter for every touch that hits one of the separate buttons
+ * - switching colour scheme or keyboard layout at run time gives the same frame as creating the fields that way
+ * With --bench it also times an idle refresh.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "SimDisplay.hpp"
+#include "Display.hpp"
+#include "Icons/Icons.hpp"
+#include "RefreshCheck.hpp"
+
+using HostTest::Check;
+
+extern const uint8_t glcd28x32[];
+
+enum Style : style_t { styleLabel = 0, styleInfo, styleButton, styleError, stylePopupText, stylePopupButton, styleTitleBar };
+
+static const DisplayStyle styles[] =
+{
+	{ COLOUR_ROLE(labelTextColour), COLOUR_ROLE(defaultBackColour) },
+	{ COLOUR_ROLE(infoTextColour), COLOUR_ROLE(defaultBackColour) },
+	{ COLOUR_ROLE(buttonTextColour), COLOUR_ROLE(buttonBackColour) },
+	{ COLOUR_ROLE(errorTextColour), COLOUR_ROLE(errorBackColour) },
+	{ COLOUR_ROLE(popupTextColour), COLOUR_ROLE(popupBackColour) },
+	{ COLOUR_ROLE(popupButtonTextColour), COLOUR_ROLE(popupButtonBackColour) },
+	{ COLOUR_ROLE(titleBarTextColour), COLOUR_ROLE(titleBarBackColour) }
+};
+
+const event_t evTab = 1, evTemp = 2, evJog = 3, evKey = 4, evIcon = 5, evPopup = 6;
+const PixelNumber rowHeight = 48, margin = 2;
+
+static const char * const tabNames[] = { "Control", "Print", "Console", "Setup" };
+static const char * const jogText[] = { "-50", "-5", "-0.5", "-0.05", "+0.05", "+0.5", "+5", "+50" };
+static const char * const jogParams[] = { "-50", "-5", "-0.5", "-0.05", "0.05", "0.5", "5", "50" };
+static const int amountParams[] = { 1, 2, 5, 10, 20 };
+static const char * const amountText[] = { "1", "2", "5", "10", "20" };
+static const char * const keysQwerty = "qwertyuiop";
+static const char * const keysAzerty = "azertyuiop";
+
+// The fields of the test page
+struct Page
+{
+	MainWindow mgr;
+	PopupWindow *popup;
+	StaticTextField *title;
+	TextButton *tabs[4];
+	FloatField *current[5];
+	IntegerButton *active[5];
+	StaticTextField *status;
+	TextButtonRow *jog;
+	IconButton *icon;
+	FloatField *printPageField;
+	TextButtonRow *amounts;
+	IntegerButton *popupValue;
+	CharButtonRow *keys;
+	DisplayField *commonRoot, *controlRoot, *printRoot;
+};
+
+static void SetColourScheme(Page& page, const ColourScheme& cs)
+{
+	DisplayField::SetColourScheme(cs);
+	page.mgr.SetBackgroundColour(cs.defaultBackColour);
+	page.popup->SetColours(cs.popupBackColour, cs.popupBorderColour);
+}
+
+static Page *CreatePage(const ColourScheme& cs, const char *keys)
+{
+	Page *page = new Page;
+	MainWindow& mgr = page->mgr;
+	DisplayField::SetColourScheme(cs);
+	mgr.Init(cs.defaultBackColour);
+
+	DisplayField::SetDefaultStyle(styleTitleBar);
+	mgr.AddField(page->title = new StaticTextField(margin, 0, 600, TextAlignment::Centre, "PanelDue"));
+	DisplayField::SetDefaultStyle(styleButton);
+	for (int i = 0; i < 4; ++i)
+	{
+		mgr.AddField(page->tabs[i] = new TextButton(430, margin + 200 * i, 190, tabNames[i], evTab, i));
+	}
+	page->commonRoot = mgr.GetRoot();
+
+	for (int i = 0; i < 5; ++i)
+	{
+		DisplayField::SetDefaultStyle(styleInfo);
+		mgr.AddField(page->current[i] = new FloatField(50 + rowHeight * i, 10, 150, TextAlignment::Right, 1, nullptr, "C"));
+		page->current[i]->SetValue(20.0 + i);
+		DisplayField::SetDefaultStyle(styleButton);
+		mgr.AddField(page->active[i] = new IntegerButton(50 + rowHeight * i, 180, 120));
+		page->active[i]->SetEvent(evTemp, i);
+	}
+	DisplayField::SetDefaultStyle(styleLabel);
+	mgr.AddField(page->status = new StaticTextField(300, 10, 580, TextAlignment::Left, "Idle"));
+	DisplayField::SetDefaultStyle(styleButton);
+	mgr.AddField(page->jog = new TextButtonRow(360, 10, 90, 98, 8, jogText, evJog, jogParams));
+	mgr.AddField(page->icon = new IconButton(50, 400, 80, IconHomeAll, evIcon, 0));
+	page->controlRoot = mgr.GetRoot();
+
+	mgr.SetRoot(page->commonRoot);
+	DisplayField::SetDefaultStyle(styleInfo);
+	mgr.AddField(page->printPageField = new FloatField(100, 100, 300, TextAlignment::Centre, 2, "Z=", nullptr));
+	page->printRoot = mgr.GetRoot();
+
+	page->popup = new PopupWindow(300, 640, cs.popupBackColour, cs.popupBorderColour);
+	DisplayField::SetDefaultStyle(stylePopupText);
+	page->popup->AddField(new StaticTextField(10, 10, 620, TextAlignment::Centre, "Extrude amount (mm)"));
+	DisplayField::SetDefaultStyle(stylePopupButton);
+	page->popup->AddField(page->amounts = new TextButtonRow(60, 10, 110, 124, 5, amountText, evPopup, amountParams));
+	page->popup->AddField(page->popupValue = new IntegerButton(120, 10, 200, "Feed ", " mm/min"));
+	page->popup->AddField(page->keys = new CharButtonRow(180, 10, 56, 62, keys, evKey));
+
+	mgr.SetRoot(page->controlRoot);
+	return page;
+}
+
+static Page *page;
+
+static void Step(const char *name)
+{
+	RefreshCheck::Step(page->mgr, name);
+}
+
+static void TestRefresh()
+{
+	MainWindow& mgr = page->mgr;
+	mgr.Refresh(true);
+	printf("%-36s %7u bus writes\n", "full", SimDisplay::TakeBusWrites());
+	Step("nothing changed");
+
+	for (int i = 0; i < 5; ++i)
+	{
+		page->current[i]->SetValue(180.0 + i * 7.3);
+		page->active[i]->SetValue(200 + i);
+	}
+	Step("temperatures");
+	page->current[2]->SetStyle(styleError);
+	Step("style");
+	page->current[2]->SetStyle(styleInfo);
+	page->status->SetValue("Printing");
+	Step("style and message");
+	mgr.Show(page->icon, false);
+	Step("hide");
+	mgr.Show(page->icon, true);
+	Step("show");
+
+	mgr.SetPopup(page->popup, 80, 60);
+	Step("open popup");
+	page->current[1]->SetValue(99.9);						// under the popup
+	page->current[4]->SetValue(55.5);						// not under it
+	page->popupValue->SetValue(3000);
+	Step("changes under and in popup");
+	mgr.Press(ButtonPress(page->amounts, 3), true);
+	Step("press in popup");
+	mgr.Press(ButtonPress(page->amounts, 3), false);
+	mgr.Show(page->active[1], false);						// hidden under the popup
+	Step("release and hide under popup");
+	mgr.ClearPopup();
+	Step("close popup");
+	mgr.Show(page->active[1], true);
+	Step("show again");
+
+	const ButtonPress jog(page->jog, 5);
+	mgr.Press(jog, true);
+	Step("press jog button");
+	mgr.Press(jog, false);
+	Step("release jog button");
+	mgr.Press(ButtonPress(page->active[3], 0), true);
+	page->active[3]->SetValue(215);
+	Step("adjust pressed button");
+	mgr.Press(ButtonPress(page->active[3], 0), false);
+	Step("release it");
+
+	mgr.SetRoot(page->printRoot);
+	page->current[0]->SetValue(1.0);						// on a page that isn't shown
+	mgr.Refresh(true);
+	SimDisplay::TakeBusWrites();
+	page->printPageField->SetValue(0.3);
+	Step("change on the other page");
+	mgr.SetRoot(page->controlRoot);
+	mgr.Refresh(true);
+	SimDisplay::TakeBusWrites();
+	page->current[1]->SetValue(101.0);
+	Step("change after switching back");
+	Check(page->current[0]->IsVisible(), "field on hidden page");
+
+	mgr.Refresh(true);
+	SimDisplay::CheckImage("Window", 0, 0, 420, 300);
+}
+
+static void TestBudget()
+{
+	MainWindow& mgr = page->mgr;
+	mgr.Refresh(true);
+	SimDisplay::TakeBusWrites();
+	Window::ResetRefreshStatistics();
+	mgr.SetRefreshBudget(2);
+
+	// 40 changes, then a button press
+	for (int n = 0; n < 8; ++n)
+	{
+		for (int i = 0; i < 5; ++i)
+		{
+			page->current[i]->SetValue(30.0 + 10 * n + i);
+		}
+	}
+	for (int i = 0; i < 5; ++i)
+	{
+		page->active[i]->SetValue(150 + i);
+	}
+	page->status->SetValue("Busy");
+	mgr.Press(ButtonPress(page->icon, 0), true);
+
+	unsigned int passes = 0;
+	std::vector<uint16_t> iconAfterFirstPass;
+	for (;;)
+	{
+		mgr.Refresh(false);
+		const uint32_t writes = SimDisplay::TakeBusWrites();
+		if (writes == 0)
+		{
+			break;
+		}
+		++passes;
+		printf("pass %u: %u bus writes\n", passes, writes);
+		if (passes == 1)
+		{
+			for (int y = 50; y < 50 + rowHeight; ++y)
+			{
+				for (int x = 400; x < 480; ++x)
+				{
+					iconAfterFirstPass.push_back(SimDisplay::GetPixel(x, y));
+				}
+			}
+		}
+	}
+	const RefreshStatistics& stats = Window::GetRefreshStatistics();
+	printf("budget 2ms: %u passes, %u fields refreshed, %u overruns, longest %ums\n", passes, stats.fieldsRefreshed, stats.overruns, stats.maxMillis);
+
+	const std::vector<uint16_t> frame = SimDisplay::GetFrame();
+	mgr.Refresh(true);
+	SimDisplay::TakeBusWrites();
+	std::vector<uint16_t> icon;
+	for (int y = 50; y < 50 + rowHeight; ++y)
+	{
+		for (int x = 400; x < 480; ++x)
+		{
+			icon.push_back(SimDisplay::GetPixel(x, y));
+		}
+	}
+	Check(passes > 1, "budget: refresh was not spread over several passes");
+	Check(icon == iconAfterFirstPass, "budget: pressed button was not drawn in the first pass");
+	Check(SimDisplay::GetFrame() == frame, "budget: final frame differs from full redraw");
+
+	mgr.Press(ButtonPress(page->icon, 0), false);
+	mgr.SetRefreshBudget(0);
+	mgr.Refresh(false);
+	SimDisplay::TakeBusWrites();
+}
+
+// Compare a row of buttons with the same buttons created separately
+static void TestButtonRow()
+{
+	const PixelNumber y = 200, x = 20, width = 90, step = 98;
+	MainWindow rowWindow, separateWindow;
+	DisplayField::SetColourScheme(colourSchemes[0]);
+	DisplayField::SetDefaultStyle(styleButton);
+	TextButtonRow *row = new TextButtonRow(y, x, width, step, 8, jogText, evJog, jogParams);
+	rowWindow.AddField(row);
+	TextButton *buttons[8];
+	for (int i = 0; i < 8; ++i)
+	{
+		separateWindow.AddField(buttons[i] = new TextButton(y, x + step * i, width, jogText[i], evJog, jogParams[i]));
+	}
+
+	struct Action { const char *name; int press, release; bool hide; };
+	static const Action actions[] =
+	{
+		{ "draw", -1, -1, false }, { "press 2", 2, -1, false }, { "press 5", 5, 2, false }, { "release 5", -1, 5, false }, { "hide", -1, -1, true }
+	};
+	for (const Action& action : actions)
+	{
+		std::vector<uint16_t> frames[2];
+		for (int w = 0; w < 2; ++w)
+		{
+			MainWindow& window = (w == 0) ? rowWindow : separateWindow;
+			if (action.release >= 0)
+			{
+				window.Press((w == 0) ? ButtonPress(row, action.release) : ButtonPress(buttons[action.release], 0), false);
+			}
+			if (action.press >= 0)
+			{
+				window.Press((w == 0) ? ButtonPress(row, action.press) : ButtonPress(buttons[action.press], 0), true);
+			}
+			if (action.hide)
+			{
+				if (w == 0)
+				{
+					window.Show(row, false);
+				}
+				else
+				{
+					for (TextButton *b : buttons)
+					{
+						window.Show(b, false);
+					}
+				}
+			}
+			SimDisplay::Init(Landscape);
+			window.Refresh(true);
+			frames[w] = SimDisplay::GetFrame();
+		}
+		Check(frames[0] == frames[1], "button row: %s differs from separate buttons", action.name);
+	}
+	rowWindow.Show(row, true);
+	for (TextButton *b : buttons)
+	{
+		separateWindow.Show(b, true);
+	}
+
+	unsigned int touches = 0, mismatches = 0, gaps = 0;
+	for (PixelNumber ty = y - 20; ty < y + 80; ++ty)
+	{
+		for (PixelNumber tx = 0; tx < 800; ++tx)
+		{
+			const ButtonPress r = rowWindow.FindEvent(tx, ty), s = separateWindow.FindEvent(tx, ty);
+			if (s.IsValid())
+			{
+				++touches;
+				if (!r.IsValid() || r.GetEvent() != s.GetEvent() || strcmp(r.GetSParam(), s.GetSParam()) != 0)
+				{
+					++mismatches;
+				}
+			}
+			else if (r.IsValid())
+			{
+				++gaps;
+			}
+		}
+	}
+	printf("button row: %u touches hit a separate button, %u more hit the row between buttons\n", touches, gaps);
+	Check(mismatches == 0, "button row: %u touches select a different button", mismatches);
+}
+
+// Switch colour scheme and keyboard layout, and compare with a page created that way
+static void TestSchemeSwitch()
+{
+	SimDisplay::Init(Landscape);
+	Page *fresh = CreatePage(colourSchemes[1], keysAzerty);
+	fresh->mgr.SetPopup(fresh->popup, 80, 60);
+	fresh->mgr.Refresh(true);
+	const std::vector<uint16_t> expected = SimDisplay::GetFrame();
+
+	SimDisplay::Init(Landscape);
+	Page *switched = CreatePage(colourSchemes[0], keysQwerty);
+	switched->mgr.SetPopup(switched->popup, 80, 60);
+	switched->mgr.Refresh(true);
+	SetColourScheme(*switched, colourSchemes[1]);
+	switched->keys->SetText(keysAzerty);
+	switched->mgr.Refresh(true);
+	Check(SimDisplay::GetFrame() == expected, "switching colour scheme and keyboard differs from starting with them");
+	SetColourScheme(*page, colourSchemes[0]);
+}
+
+static void Benchmark()
+{
+	MainWindow& mgr = page->mgr;
+	mgr.Refresh(true);
+	const int iterations = 1000000;
+	const auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < iterations; ++i)
+	{
+		mgr.Refresh(false);
+	}
+	const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+	printf("idle Refresh(false): %.1f ns\n", ns/iterations);
+}
+
+int main(int argc, char **argv)
+{
+	SimDisplay::Init(Landscape);
+	DisplayField::SetStyles(styles);
+	DisplayField::SetDefaultFont(glcd28x32);
+	ButtonWithText::SetFont(glcd28x32);
+	SingleButton::SetTextMargin(1);
+	SingleButton::SetIconMargin(2);
+	page = CreatePage(colourSchemes[0], keysQwerty);
+
+	if (HostTest::Benchmarking(argc, argv))
+	{
+		Benchmark();
+		return 0;
+	}
+
+	TestRefresh();
+	TestBudget();
+	TestButtonRow();
+	TestSchemeSwitch();
+	return HostTest::Result();
+}
+
+// End
@@ -64,7 +64,9 @@ const ColourScheme colourSchemes[NumColourSchemes] =
 		.resetButtonBackColour = lightRed,
 
 		.progressBarColour = midGreen,
-		.progressBarBackColour = white
+		.progressBarBackColour = white,
+
+		.chartGridColour = UTFT::fromRGB(192, 192, 192)
 	},
 	
 	// Dark colour scheme
@@ -108,7 +110,9 @@ const ColourScheme colourSchemes[NumColourSchemes] =
 		.resetButtonBackColour = lightRed,
 
 		.progressBarColour = midGreen,
-		.progressBarBackColour = black
+		.progressBarBackColour = black,
+
+		.chartGridColour = UTFT::fromRGB(64, 64, 64)
 	}
 };
 
@@ -10,6 +10,7 @@
 #define COLOURSCHEME_H_
 
 #include <cstdint>
+#include <cstddef>
 #include "Hardware/UTFT.hpp"
 
 // Some common colours
@@ -64,8 +65,19 @@ struct ColourScheme
 
 	Colour progressBarColour;
 	Colour progressBarBackColour;
+
+	Colour chartGridColour;
+
+	// Get a colour by its role, which is the offset of the colour within the colour scheme
+	Colour GetColour(uint8_t role) const { return *reinterpret_cast<const Colour*>(reinterpret_cast<const char*>(this) + role); }
 };
 
+// Get the role of a colour in the colour scheme, so that the colour can be looked up in whichever colour scheme is in use
+#define COLOUR_ROLE(_c)	((uint8_t)offsetof(ColourScheme, _c))
+
+static_assert(offsetof(ColourScheme, chartGridColour) + sizeof(Colour) + alignof(ColourScheme) > sizeof(ColourScheme) && offsetof(ColourScheme, chartGridColour) <= UINT8_MAX,
+				"chartGridColour must be the last colour role, and the roles must fit in a uint8_t");
+
 const size_t NumColourSchemes = 2;
 extern const ColourScheme colourSchemes[NumColourSchemes];
 
@@ -7,9 +7,12 @@
 
 #include "Display.hpp"
 #include "ColourSchemes.hpp"
+#include "Library/Misc.hpp"
+#include "Hardware/SysTick.hpp"
 #undef array
 #undef result
 #include <algorithm>
+#include <cstring>
 #define array _ecv_array
 #define result _ecv_result
 
@@ -22,34 +25,21 @@ extern void WriteCommand(char c);
 
 // Static fields of class DisplayField
 LcdFont DisplayField::defaultFont = NULL;
-Colour DisplayField::defaultFcolour = white;
-Colour DisplayField::defaultBcolour = black;
-Colour DisplayField::defaultButtonBorderColour = black;
-Colour DisplayField::defaultGradColour = 0;
-Colour DisplayField::defaultPressedBackColour = black;
-Colour DisplayField::defaultPressedGradColour = 0;
+style_t DisplayField::defaultStyle = 0;
+const DisplayStyle * array DisplayField::styles = nullptr;
+const ColourScheme * DisplayField::colourScheme = &colourSchemes[0];
 
 DisplayField::DisplayField(PixelNumber py, PixelNumber px, PixelNumber pw)
-	: y(py), x(px), width(pw), fcolour(defaultFcolour), bcolour(defaultBcolour),
-		changed(true), visible(true), next(NULL)
+	: y(py), x(px), width(pw), style(defaultStyle),
+		changed(true), visible(true), queued(false), inList(false), queuedPriority(0), valueOnly(false), zOrder(0), owner(nullptr), nextQueued(nullptr), next(NULL)
 {
 }
 
-/*static*/ void DisplayField::SetDefaultColours(Colour pf, Colour pb, Colour pbb, Colour pg, Colour pbp, Colour pgp)
-{
-	defaultFcolour = pf;
-	defaultBcolour = pb;
-	defaultButtonBorderColour = pbb;
-	defaultGradColour = pg;
-	defaultPressedBackColour = pbp;
-	defaultPressedGradColour = pgp;
-}
-
 /*static*/ PixelNumber DisplayField::GetTextWidth(const char* array s, PixelNumber maxWidth)
 {
-	lcd.setTextPos(0, 9999, maxWidth);
-	lcd.print(s);    // dummy print to get text width
-	return lcd.getTextX();
+	TextMeasurer tm(defaultFont, maxWidth);
+	tm.print(s);
+	return tm.GetWidth();
 }
 
 void DisplayField::Show(bool v)
@@ -57,46 +47,38 @@ void DisplayField::Show(bool v)
 	if (visible != v)
 	{
 		visible = changed = v;
-	}
-}
-	
-// Find the best match to a touch event in a list of fields
-ButtonPress DisplayField::FindEvent(PixelNumber x, PixelNumber y, DisplayField * null p)
-{	
-	const int maxXerror = 8, maxYerror = 8;		// set these to how close we need to be
-	int bestError = maxXerror + maxYerror;
-	ButtonPress best;;
-	while (p != NULL)
-	{
-		if (p->visible && p->GetEvent() != nullEvent)
+		if (v)
 		{
-			int xError = (x < p->GetMinX()) ? p->GetMinX() - x
-									: (x > p->GetMaxX()) ? x - p->GetMaxX()
-										: 0;
-			if (xError < maxXerror)
-			{
-				int yError = (y < p->GetMinY()) ? p->GetMinY() - y
-										: (y > p->GetMaxY()) ? y - p->GetMaxY()
-											: 0;
-				if (yError < maxYerror && xError + yError < bestError)
-				{
-					bestError = xError + yError;
-					best = ButtonPress(static_cast<ButtonBase*>(p), 0);
-				}
-			}
+			SetChanged();
 		}
-		p = p->next;
 	}
-	return best;
 }
 
-void DisplayField::SetColours(Colour pf, Colour pb)
+// Flag that the value shown by the field has changed but nothing else about it has, so that the field may be able to redraw just the part that has changed
+void DisplayField::SetValueChanged(RefreshPriority pri)
+{
+	const bool onlyValue = !changed || valueOnly;
+	SetChanged(pri);
+	valueOnly = onlyValue;
+}
+
+// Flag the field as needing to be redrawn and add it to its window's refresh queue, so that the window doesn't have to look at every field to find the ones that have changed
+void DisplayField::SetChanged(RefreshPriority pri)
+{
+	changed = true;
+	valueOnly = false;
+	if (inList && owner != nullptr && (!queued || (uint8_t)pri > queuedPriority))
+	{
+		owner->Enqueue(this, pri);
+	}
+}
+	
+void DisplayField::SetStyle(style_t s)
 {
-	if (fcolour != pf || bcolour != pb)
+	if (style != s)
 	{
-		fcolour = pf;
-		bcolour = pb;
-		changed = true;	
+		style = s;
+		SetChanged();
 	}
 }
 
@@ -128,17 +110,366 @@ const char* array ButtonPress::GetSParam() const
 
 bool ButtonPress::operator==(const ButtonPress& other) const { return button == other.button && index == other.index; }
 
+// DamageRegion class methods
+
+// Add a rectangle to the damaged region, merging it with any existing rectangles that it overlaps or touches
+void DamageRegion::Add(PixelNumber pxmin, PixelNumber pymin, PixelNumber pxmax, PixelNumber pymax)
+{
+	Rect r;
+	r.xmin = pxmin;
+	r.ymin = pymin;
+	r.xmax = pxmax;
+	r.ymax = pymax;
+
+	// Each time we merge a rectangle the result may touch another one, so keep going until nothing more can be merged
+	size_t i = 0;
+	while (i < numRects)
+	{
+		const Rect& other = rects[i];
+		if (other.Overlaps((r.xmin == 0) ? 0 : r.xmin - 1, (r.ymin == 0) ? 0 : r.ymin - 1, r.xmax + 1, r.ymax + 1))
+		{
+			r.xmin = min<PixelNumber>(r.xmin, other.xmin);
+			r.ymin = min<PixelNumber>(r.ymin, other.ymin);
+			r.xmax = max<PixelNumber>(r.xmax, other.xmax);
+			r.ymax = max<PixelNumber>(r.ymax, other.ymax);
+			Remove(i);
+			i = 0;
+		}
+		else
+		{
+			++i;
+		}
+	}
+
+	if (numRects == MaxRects)
+	{
+		// No room for another rectangle, so merge it into the one whose area grows least as a result
+		size_t best = 0;
+		uint32_t bestGrowth = 0xFFFFFFFF;
+		for (size_t j = 0; j < numRects; ++j)
+		{
+			Rect merged;
+			merged.xmin = min<PixelNumber>(r.xmin, rects[j].xmin);
+			merged.ymin = min<PixelNumber>(r.ymin, rects[j].ymin);
+			merged.xmax = max<PixelNumber>(r.xmax, rects[j].xmax);
+			merged.ymax = max<PixelNumber>(r.ymax, rects[j].ymax);
+			const uint32_t growth = merged.Area() - rects[j].Area();
+			if (growth < bestGrowth)
+			{
+				best = j;
+				bestGrowth = growth;
+			}
+		}
+		const Rect other = rects[best];
+		Remove(best);
+		Add(min<PixelNumber>(r.xmin, other.xmin), min<PixelNumber>(r.ymin, other.ymin), max<PixelNumber>(r.xmax, other.xmax), max<PixelNumber>(r.ymax, other.ymax));
+	}
+	else
+	{
+		rects[numRects++] = r;
+	}
+}
+
+// Remove any rectangles that lie entirely within the specified area, e.g. because that area is about to be painted over
+void DamageRegion::RemoveInside(PixelNumber pxmin, PixelNumber pymin, PixelNumber pxmax, PixelNumber pymax)
+{
+	size_t i = 0;
+	while (i < numRects)
+	{
+		if (rects[i].IsInside(pxmin, pymin, pxmax, pymax))
+		{
+			Remove(i);
+		}
+		else
+		{
+			++i;
+		}
+	}
+}
+
+void DamageRegion::Remove(size_t index)
+{
+	--numRects;
+	rects[index] = rects[numRects];
+}
+
+// FieldIndex class methods
+
+// Get the number of the cell that contains a point. Points beyond the last row or column belong to it.
+size_t FieldIndex::CellNumber(PixelNumber x, PixelNumber y) const
+{
+	const size_t col = x >> xShift, row = y >> yShift;
+	return ((row < GridSize) ? row : GridSize - 1) * GridSize + ((col < GridSize) ? col : GridSize - 1);
+}
+
+// Get the first and last cells that contain points within touch range of a field
+void FieldIndex::GetCellRange(const DisplayField *p, size_t& first, size_t& last) const
+{
+	first = CellNumber((p->GetMinX() >= maxXerror) ? p->GetMinX() - (maxXerror - 1) : 0, (p->GetMinY() >= maxYerror) ? p->GetMinY() - (maxYerror - 1) : 0);
+	last = CellNumber(p->GetMaxX() + (maxXerror - 1), p->GetMaxY() + (maxYerror - 1));
+}
+
+// Choose the cell size for a list of fields, count the buttons that each cell needs to hold and return the total
+size_t FieldIndex::Layout(DisplayField * null root, uint16_t cellCount[])
+{
+	// Choose the cell size so that the buttons are spread across the whole grid
+	PixelNumber maxX = 0, maxY = 0;
+	for (DisplayField * null p = root; p != nullptr; p = p->next)
+	{
+		if (p->IsButton())
+		{
+			maxX = max<PixelNumber>(maxX, p->GetMaxX());
+			maxY = max<PixelNumber>(maxY, p->GetMaxY());
+		}
+	}
+	xShift = yShift = 0;
+	while ((size_t)(maxX >> xShift) >= GridSize)
+	{
+		++xShift;
+	}
+	while ((size_t)(maxY >> yShift) >= GridSize)
+	{
+		++yShift;
+	}
+
+	// Each button goes in every cell that contains a point within touch range of it
+	std::fill(cellCount, cellCount + GridSize * GridSize, 0);
+	size_t total = 0;
+	for (DisplayField * null p = root; p != nullptr; p = p->next)
+	{
+		if (p->IsButton())
+		{
+			size_t first, last;
+			GetCellRange(p, first, last);
+			for (size_t row = first - first % GridSize; row <= last; row += GridSize)
+			{
+				for (size_t cell = row + first % GridSize; cell <= row + last % GridSize; ++cell)
+				{
+					++cellCount[cell];
+					++total;
+				}
+			}
+		}
+	}
+	return total;
+}
+
+// Make sure that the index will be big enough for a list of fields. This only has an effect until the index is first used.
+void FieldIndex::Reserve(DisplayField * null root)
+{
+	if (entries == nullptr)
+	{
+		uint16_t cellCount[GridSize * GridSize];
+		capacity = max<size_t>(capacity, Layout(root, cellCount));
+		valid = false;							// we changed the cell size
+	}
+}
+
+// Build the index for a list of fields
+void FieldIndex::Build(DisplayField * null root)
+{
+	uint16_t nextEntry[GridSize * GridSize];
+	const size_t total = Layout(root, nextEntry);
+	indexedRoot = root;
+	valid = true;
+
+	if (entries == nullptr)
+	{
+		capacity = max<size_t>(capacity, total);
+		entries = new DisplayField*[capacity];
+	}
+	indexed = (total <= capacity);
+	if (!indexed)
+	{
+		return;
+	}
+
+	size_t start = 0;
+	for (size_t cell = 0; cell < GridSize * GridSize; ++cell)
+	{
+		cellStart[cell] = start;
+		start += nextEntry[cell];
+		nextEntry[cell] = cellStart[cell];
+	}
+	cellStart[GridSize * GridSize] = start;
+
+	// Fill in the cells, keeping the buttons in each cell in display list order so that ties are resolved as before
+	for (DisplayField * null p = root; p != nullptr; p = p->next)
+	{
+		if (p->IsButton())
+		{
+			size_t first, last;
+			GetCellRange(p, first, last);
+			for (size_t row = first - first % GridSize; row <= last; row += GridSize)
+			{
+				for (size_t cell = row + first % GridSize; cell <= row + last % GridSize; ++cell)
+				{
+					entries[nextEntry[cell]++] = p;
+				}
+			}
+		}
+	}
+}
+
+// If a field is a button that is nearer to a touch than the best one so far, make it the best
+void FieldIndex::Consider(DisplayField *p, PixelNumber x, PixelNumber y, int& bestError, ButtonBase * null & best)
+{
+	if (p->IsVisible() && p->GetEvent() != nullEvent)
+	{
+		int xError = (x < p->GetMinX()) ? p->GetMinX() - x
+								: (x > p->GetMaxX()) ? x - p->GetMaxX()
+									: 0;
+		if (xError < maxXerror)
+		{
+			int yError = (y < p->GetMinY()) ? p->GetMinY() - y
+									: (y > p->GetMaxY()) ? y - p->GetMaxY()
+										: 0;
+			if (yError < maxYerror && xError + yError < bestError)
+			{
+				bestError = xError + yError;
+				best = static_cast<ButtonBase*>(p);
+			}
+		}
+	}
+}
+
+// Find the best match to a touch event in a list of fields, rebuilding the index first if the list has changed
+ButtonPress FieldIndex::FindEvent(PixelNumber x, PixelNumber y, DisplayField * null root)
+{
+	if (!valid || root != indexedRoot)
+	{
+		Build(root);
+	}
+
+	int bestError = maxXerror + maxYerror;
+	ButtonBase * null best = nullptr;
+	if (indexed)
+	{
+		const size_t cell = CellNumber(x, y);
+		for (size_t i = cellStart[cell]; i < cellStart[cell + 1]; ++i)
+		{
+			Consider(entries[i], x, y, bestError, best);
+		}
+	}
+	else
+	{
+		for (DisplayField * null p = root; p != nullptr; p = p->next)
+		{
+			Consider(p, x, y, bestError, best);
+		}
+	}
+	return (best == nullptr) ? ButtonPress() : ButtonPress(best, best->GetIndexAt(x, y));
+}
+
 // Window class methods
+FieldIndex Window::fieldIndex;
+DamageRegion Window::damage;
+RefreshStatistics Window::refreshStats;
+
 Window::Window(Colour pb)
-	: root(nullptr), next(nullptr), backgroundColour(pb)
+	: root(nullptr), next(nullptr), queue(nullptr), backgroundColour(pb)
 {
 }
 
 // Append a field to the list of displayed fields
 void Window::AddField(DisplayField *d)
 {
+	static uint16_t lastZOrder = 0;
+
 	d->next = root;
 	root = d;
+	d->owner = this;
+	d->inList = true;
+	d->zOrder = ++lastZOrder;
+	if (d->changed)
+	{
+		Enqueue(d, RefreshPriority::normal);
+	}
+	fieldIndex.Invalidate();
+}
+
+// Add a field to the refresh queue, or move it up the queue if it is already there with a lower priority.
+// The queue is kept in priority order, and fields of equal priority are kept in display list order.
+void Window::Enqueue(DisplayField *f, RefreshPriority pri)
+{
+	DisplayField * null * pp;
+	if (f->queued)
+	{
+		pp = &queue;
+		while (*pp != f)
+		{
+			pp = &(*pp)->nextQueued;
+		}
+		*pp = f->nextQueued;
+	}
+
+	f->queuedPriority = (uint8_t)pri;
+	pp = &queue;
+	while (*pp != nullptr && ((*pp)->queuedPriority > f->queuedPriority || ((*pp)->queuedPriority == f->queuedPriority && (*pp)->zOrder > f->zOrder)))
+	{
+		pp = &(*pp)->nextQueued;
+	}
+	f->nextQueued = *pp;
+	*pp = f;
+	f->queued = true;
+}
+
+// Empty the refresh queue, e.g. because we are about to redraw everything
+void Window::ClearQueue()
+{
+	while (queue != nullptr)
+	{
+		queue->queued = false;
+		queue = queue->nextQueued;
+	}
+}
+
+// Refresh the queued fields that have the specified priority in this window and any popups on top of it.
+// Fields that are hidden by a popup window stay in the queue until the popup has gone.
+// If the budget is not zero then we stop when that many milliseconds have passed since startTime, after redrawing at least one field. Return false if we ran out of time.
+bool Window::RefreshQueued(RefreshPriority pri, uint32_t startTime, uint32_t budget)
+{
+	DisplayField * null * pp = &queue;
+	while (*pp != nullptr && (*pp)->queuedPriority >= (uint8_t)pri)
+	{
+		DisplayField * const p = *pp;
+		if (p->queuedPriority != (uint8_t)pri || (p->IsVisible() && ObscuredByPopup(p)))
+		{
+			pp = &p->nextQueued;
+		}
+		else
+		{
+			*pp = p->nextQueued;
+			p->queued = false;
+			if (p->IsVisible())
+			{
+				ListField::StopHardwareScroll(p, p->GetMinY() + Ypos(), p->GetMaxY() + Ypos(), nullptr);
+				p->Refresh(false, Xpos(), Ypos());
+				++refreshStats.fieldsRefreshed;
+				if (budget != 0 && SystemTick::GetTickCount() - startTime >= budget)
+				{
+					return false;
+				}
+			}
+		}
+	}
+	return next == nullptr || next->RefreshQueued(pri, startTime, budget);
+}
+
+// Forget the saved pixels under any popups on top of this window, because something underneath has changed that won't be redrawn when the popups are removed
+void Window::DiscardPopupBackgrounds()
+{
+#ifdef UTFT_READBACK
+	for (PopupWindow * null w = next; w != nullptr; w = w->next)
+	{
+		w->DiscardBackground();
+	}
+#endif
+}
+
+/*static*/ void Window::ResetRefreshStatistics()
+{
+	refreshStats.fieldsRefreshed = refreshStats.overruns = refreshStats.maxMillis = 0;
 }
 
 bool Window::ObscuredByPopup(const DisplayField *p) const
@@ -161,7 +492,7 @@ ButtonPress Window::FindEvent(PixelNumber x, PixelNumber y)
 {
 	return (x < Xpos() || y < Ypos()) ? ButtonPress()
 			: (next != nullptr) ? next->FindEvent(x, y) 
-				: DisplayField::FindEvent(x - Xpos(), y - Ypos(), root);
+				: fieldIndex.FindEvent(x - Xpos(), y - Ypos(), root);
 }
 
 // Get the field that has been touched, but search only outside the popup
@@ -169,18 +500,22 @@ ButtonPress Window::FindEventOutsidePopup(PixelNumber x, PixelNumber y)
 {
 	if (next == nullptr) return ButtonPress();
 	
-	ButtonPress f = DisplayField::FindEvent(x, y, root);
+	ButtonPress f = fieldIndex.FindEvent(x, y, root);
 	return (f.IsValid() && Visible(f.GetButton())) ? f : ButtonPress();
 }
 
 void Window::SetPopup(PopupWindow * p, PixelNumber px, PixelNumber py, bool redraw)
 {
+	ListField::StopHardwareScroll(nullptr);
 	p->SetPos(px, py);
 	Window *pw = this;
 	while (pw->next != nullptr)
 	{
 		if (pw->next == p)
 		{
+#ifdef UTFT_READBACK
+			p->DiscardBackground();			// the popup may have moved
+#endif
 			if (redraw)
 			{
 				p->Refresh(true);
@@ -190,6 +525,25 @@ void Window::SetPopup(PopupWindow * p, PixelNumber px, PixelNumber py, bool redr
 		pw = pw->next;
 	}
 	p->next = nullptr;			// ensure no nested popup
+	if (redraw)
+	{
+#ifdef UTFT_READBACK
+		// Repaint all the damaged areas and then save the pixels that the popup will cover, so that we can put them back when the popup is removed
+		RepaintDamage();
+		p->SaveBackground(pw == this);
+#else
+		// Any damaged areas that the new popup covers completely don't need to be repainted.
+		// Repaint the rest now, so that we don't paint over the popup later.
+		damage.RemoveInside(px, py, px + p->GetWidth() - 1, py + p->GetHeight() - 1);
+		RepaintDamage();
+#endif
+	}
+#ifdef UTFT_READBACK
+	else
+	{
+		p->DiscardBackground();
+	}
+#endif
 	pw->next = p;
 	if (redraw)
 	{
@@ -197,6 +551,8 @@ void Window::SetPopup(PopupWindow * p, PixelNumber px, PixelNumber py, bool redr
 	}
 }
 
+// Remove the last popup window. If 'redraw' is true then the area it occupied is marked as damaged, to be repainted on the next call to Refresh.
+// If 'redraw' is false then the caller is responsible for redrawing the screen.
 void Window::ClearPopup(bool redraw, PopupWindow *whichOne)
 {
 	if (next != nullptr)
@@ -210,53 +566,99 @@ void Window::ClearPopup(bool redraw, PopupWindow *whichOne)
 		
 		if (whichOne == nullptr || whichOne == pw->next)
 		{
-			const PixelNumber xmin = pw->next->Xpos(), xmax = xmin + pw->next->GetWidth() - 1, ymin = pw->next->Ypos(), ymax = ymin + pw->next->GetHeight() - 1;
-			bool popupWasContained = pw->Contains(xmin, ymin, xmax, ymax);
-			if (popupWasContained)
-			{
-				// Clear the area that was occupied by the last window to the background colour of the penultimate window
-				lcd.setColor(pw->backgroundColour);
-				lcd.fillRoundRect(xmin, ymin, xmax, ymax);
-			}
+			PopupWindow * const popup = pw->next;
+			const PixelNumber xmin = popup->Xpos(), xmax = xmin + popup->GetWidth() - 1, ymin = popup->Ypos(), ymax = ymin + popup->GetHeight() - 1;
 
 			// Detach the last window
+			ListField::StopHardwareScroll(popup);
 			pw->next = nullptr;
 
 			if (redraw)
 			{
-				if (popupWasContained)
-				{
-					// Re-display the fields of the penultimate window that were obscured
-					for (DisplayField * null pp = pw->root; pp != nullptr; pp = pp->next)
-					{
-						if (pp->IsVisible())
-						{
-							pp->Refresh(true, pw->Xpos(), pw->Ypos());
-						}
-					}
-				}
-				else
+#ifdef UTFT_READBACK
+				// If we saved the pixels under the popup then put them back, which is just as fast as clearing the area. Else repaint the area.
+				if (!popup->RestoreBackground())
+#endif
 				{
-					Refresh(true);		// redraw everything
+					damage.Add(xmin, ymin, xmax, ymax);
 				}
 			}
+#ifdef UTFT_READBACK
+			else
+			{
+				popup->ReleaseBackground();
+			}
+#endif
+		}
+	}
+}
+
+// Repaint all damaged areas of the display. This must only be called on the main window.
+void Window::RepaintDamage()
+{
+	for (size_t i = 0; i < damage.Size(); ++i)
+	{
+		// Find the topmost window that contains the whole of this damaged area, and repaint the area starting from that window
+		const Rect& r = damage[i];
+		Window *owner = this;
+		for (Window *w = next; w != nullptr; w = w->next)
+		{
+			if (w->Contains(r.xmin, r.ymin, r.xmax, r.ymax))
+			{
+				owner = w;
+			}
+		}
+		owner->RepaintArea(r);
+	}
+	damage.Clear();
+}
+
+// Repaint an area of the screen that lies entirely within this window, followed by any popup windows that overlap it
+void Window::RepaintArea(const Rect& r)
+{
+	ListField::StopHardwareScroll(nullptr, r.ymin, r.ymax, nullptr);
+	lcd.setColor(backgroundColour);
+	lcd.fillRect(r.xmin, r.ymin, r.xmax, r.ymax);
+
+	for (DisplayField * null p = root; p != nullptr; p = p->next)
+	{
+		if (Visible(p) && r.Overlaps(p->GetMinX() + Xpos(), p->GetMinY() + Ypos(), p->GetMaxX() + Xpos(), p->GetMaxY() + Ypos()))
+		{
+			p->Refresh(true, Xpos(), Ypos());
+		}
+	}
+
+	for (PopupWindow * null w = next; w != nullptr; w = w->next)
+	{
+		if (r.Overlaps(w->Xpos(), w->Ypos(), w->Xpos() + w->GetWidth() - 1, w->Ypos() + w->GetHeight() - 1))
+		{
+			w->Refresh(true);		// this also redraws any popups on top of it
+			break;
 		}
 	}
 }
 
-// Redraw the specified field
-void Window::Redraw(DisplayField *f)
+// Redraw the specified field. If 'full' is false then only the parts of it that have changed are redrawn.
+void Window::Redraw(DisplayField *f, bool full)
 {
 	for (DisplayField * null p = root; p != nullptr; p = p->next)
 	{
 		if (p == f)
 		{
 			// The field belongs to this window
-			if (!ObscuredByPopup(p))
+			if (ObscuredByPopup(p))
+			{
+				if (!p->IsVisible())
+				{
+					DiscardPopupBackgrounds();		// the saved pixels under the popup include the field, so they are out of date
+				}
+			}
+			else
 			{
+				ListField::StopHardwareScroll(p, p->GetMinY() + Ypos(), p->GetMaxY() + Ypos(), nullptr);
 				if (p->IsVisible())
 				{
-					p->Refresh(true, Xpos(), Ypos());
+					p->Refresh(full, Xpos(), Ypos());
 				}
 				else
 				{
@@ -271,7 +673,7 @@ void Window::Redraw(DisplayField *f)
 	// Else we didn't find the field in our window, so look in nested windows
 	if (next != nullptr)
 	{
-		next->Redraw(f);
+		next->Redraw(f, full);
 	}
 }
 
@@ -281,23 +683,22 @@ void Window::Show(DisplayField *f, bool v)
 	{
 		f->Show(v);
 
-		// Check whether the field is currently in the display list, if so then show or hide it
+		// Check whether the field is currently in the display list. If so then a field that is being shown will be drawn on the next refresh
+		// because it is flagged as changed, and the area of a field that is being hidden needs to be repainted.
 		for (DisplayField *p = root; p != NULL; p = p->next)
 		{
 			if (p == f)
 			{
-				if (ObscuredByPopup(f))
-				{
-					// nothing to do		
-				}
-				else if (v)
-				{
-					f->Refresh(true, Xpos(), Ypos());
-				}
-				else
+				if (!v)
 				{
-					lcd.setColor(backgroundColour);
-					lcd.fillRect(f->GetMinX(), f->GetMinY(), f->GetMaxX(), f->GetMaxY());
+					if (!ObscuredByPopup(f))
+					{
+						damage.Add(f->GetMinX() + Xpos(), f->GetMinY() + Ypos(), f->GetMaxX() + Xpos(), f->GetMaxY() + Ypos());
+					}
+					else
+					{
+						DiscardPopupBackgrounds();
+					}
 				}
 				return;
 			}
@@ -319,12 +720,12 @@ void Window::Press(ButtonPress bp, bool v)
 		bp.GetButton()->Press(v, bp.GetIndex());
 		if (bp.GetButton()->IsVisible())		// need to check this in case we are releasing the button and it has gone invisible since we pressed it
 		{
-			Redraw(bp.GetButton());
+			Redraw(bp.GetButton(), false);		// a button row only needs to redraw the buttons whose state has changed
 		}
 	}
 }
 
-MainWindow::MainWindow() : Window(black)
+MainWindow::MainWindow() : Window(black), refreshBudget(0)
 {
 }
 
@@ -339,24 +740,44 @@ void MainWindow::ClearAll()
 	lcd.fillScr(backgroundColour);
 }
 
-// Refresh all fields. If 'full' is true then we rewrite them all, else we just rewrite those that have changed.
+// Refresh all fields. If 'full' is true then we rewrite them all, else we repaint the damaged areas and rewrite the fields that have changed.
 void MainWindow::Refresh(bool full)
 {
 	if (full)
 	{
+		ListField::StopHardwareScroll(this);
 		ClearAll();
-	}
-
-	for (DisplayField * null pp = root; pp != NULL; pp = pp->next)
-	{
-		if (Visible(pp))
+		damage.Clear();
+		ClearQueue();
+		DiscardPopupBackgrounds();				// we are about to repaint what is under the popups, e.g. in a new colour scheme
+		for (DisplayField * null pp = root; pp != NULL; pp = pp->next)
+		{
+			if (Visible(pp))
+			{
+				pp->Refresh(true, 0, 0);
+			}
+		}
+		if (next != nullptr)
 		{
-			pp->Refresh(full, 0, 0);
+			next->Refresh(true);
 		}
 	}
-	if (next != nullptr)
+	else
 	{
-		next->Refresh(full);
+		RepaintDamage();
+
+		// Redraw the changed fields in this window and the popups, highest priority first, until we run out of time. Any that are left get redrawn next time.
+		const uint32_t startTime = SystemTick::GetTickCount();
+		bool finished = true;
+		for (int pri = (int)RefreshPriority::pressed; finished && pri >= (int)RefreshPriority::normal; --pri)
+		{
+			finished = RefreshQueued((RefreshPriority)pri, startTime, refreshBudget);
+		}
+		if (!finished)
+		{
+			++refreshStats.overruns;
+		}
+		refreshStats.maxMillis = max<uint32_t>(refreshStats.maxMillis, SystemTick::GetTickCount() - startTime);
 	}
 }
 
@@ -365,16 +786,39 @@ bool MainWindow::Contains(PixelNumber xmin, PixelNumber ymin, PixelNumber xmax,
 	return true;
 }
 
-void MainWindow::ClearAllPopups()
+// Change the list of fields displayed. Fields that are not in the current list are not queued for refresh when they change.
+void MainWindow::SetRoot(DisplayField * null r)
 {
-	while (next != nullptr)
+	DiscardPopupBackgrounds();
+	ClearQueue();
+	for (DisplayField * null p = root; p != nullptr; p = p->next)
 	{
-		ClearPopup(true);
+		p->inList = false;
 	}
-}
-
-PopupWindow::PopupWindow(PixelNumber ph, PixelNumber pw, Colour pb, Colour pBorder)
+	root = r;
+	for (DisplayField * null p = root; p != nullptr; p = p->next)
+	{
+		p->inList = true;
+		if (p->changed && p->IsVisible())
+		{
+			Enqueue(p, RefreshPriority::normal);
+		}
+	}
+}
+
+void MainWindow::ClearAllPopups()
+{
+	while (next != nullptr)
+	{
+		ClearPopup(true);
+	}
+}
+
+PopupWindow::PopupWindow(PixelNumber ph, PixelNumber pw, Colour pb, Colour pBorder)
 	: Window(pb), height(ph), width(pw), borderColour(pBorder)
+#ifdef UTFT_READBACK
+	  , savedStart(0), savedLength(0)
+#endif
 {
 }
 
@@ -382,6 +826,8 @@ void PopupWindow::Refresh(bool full)
 {
 	if (full)
 	{
+		ListField::StopHardwareScroll(nullptr, yPos, yPos + height - 1, this);
+
 		// Draw a rectangle inside the border
 		lcd.setColor(backgroundColour);
 		lcd.fillRoundRect(xPos + 1, yPos + 2, xPos + width - 2, yPos + height - 3);
@@ -390,46 +836,171 @@ void PopupWindow::Refresh(bool full)
 		lcd.setColor(borderColour);
 		lcd.drawRoundRect(xPos, yPos, xPos + width - 1, yPos + height - 1);
 		lcd.drawRoundRect(xPos + 1, yPos + 1, xPos + width - 2, yPos + height - 2);
+
+		ClearQueue();
+		for (DisplayField * null p = root; p != NULL; p = p->next)
+		{
+			if (p->IsVisible())
+			{
+				p->Refresh(true, xPos, yPos);
+			}
+		}
+		if (next != nullptr)
+		{
+			next->Refresh(true);
+		}
 	}
-	
-	for (DisplayField * null p = root; p != NULL; p = p->next)
+	else
 	{
-		if (p->IsVisible() && (full || !ObscuredByPopup(p)))
+		for (int pri = (int)RefreshPriority::pressed; pri >= (int)RefreshPriority::normal; --pri)
 		{
-			p->Refresh(full, xPos, yPos);
+			RefreshQueued((RefreshPriority)pri, 0, 0);
 		}
 	}
-	
-	if (next != nullptr)
+}
+
+#ifdef UTFT_READBACK
+
+uint16_t PopupWindow::backingStore[BackingStoreSize];
+size_t PopupWindow::backingStoreUsed = 0;
+
+// Save the pixels that this popup is about to cover. The backing store is used as a stack, because popups are removed in the reverse order to which they were displayed.
+void PopupWindow::SaveBackground(bool isFirstPopup)
+{
+	if (isFirstPopup)
+	{
+		backingStoreUsed = 0;			// recover any space left behind by popups that were discarded without being removed
+	}
+	savedStart = backingStoreUsed;
+	savedLength = lcd.readCompressedBitmap(xPos, yPos, width, height, backingStore + savedStart, BackingStoreSize - savedStart);
+	backingStoreUsed += savedLength;
+}
+
+// Put back the pixels that this popup covered, returning true if we were able to
+bool PopupWindow::RestoreBackground()
+{
+	if (savedLength == 0)
+	{
+		return false;
+	}
+	lcd.drawCompressedBitmap(xPos, yPos, width, height, backingStore + savedStart);
+	ReleaseBackground();
+	return true;
+}
+
+// Free the space used to save the pixels that this popup covered
+void PopupWindow::ReleaseBackground()
+{
+	if (savedLength != 0)
 	{
-		next->Refresh(full);
+		backingStoreUsed = savedStart;
+		savedLength = 0;
 	}
 }
 
+#endif
+
 bool PopupWindow::Contains(PixelNumber xmin, PixelNumber ymin, PixelNumber xmax, PixelNumber ymax) const
 {
 	return xPos + 2 <= xmin && yPos + 2 <= ymin && xPos + width >= xmax + 3 && yPos + height >= ymax + 3;
 }
 
+// Print device that keeps a copy of the text printed to it if it fits. Fields print their text into one of these first, so that they only
+// format it once per refresh and can tell whether it has changed since they last drew it.
+class TextBuffer : public Print
+{
+public:
+	TextBuffer() : length(0) { }
+
+	size_t write(uint8_t c) override
+	{
+		if (length < MaxLength)
+		{
+			buffer[length] = c;
+		}
+		++length;
+		return 1;
+	}
+
+	using Print::write;
+
+	bool Overflowed() const { return length > MaxLength; }
+	void PrintTo(Print& dev) const { dev.write(buffer, length); }
+
+	// Return true if this holds the same text as was saved by Save
+	bool Matches(const char * array saved, size_t savedSize) const
+	{
+		return length <= savedSize && memcmp(buffer, saved, length) == 0 && (length == savedSize || saved[length] == 0);
+	}
+
+	// Save the text padded with nulls if it fits in 'savedSize' characters, else save just 'noText'
+	void Save(char * array saved, size_t savedSize, char noText) const
+	{
+		if (length > savedSize)
+		{
+			saved[0] = noText;
+		}
+		else
+		{
+			memcpy(saved, buffer, length);
+			memset(saved + length, 0, savedSize - length);
+		}
+	}
+
+private:
+	static const size_t MaxLength = 32;			// long enough for all the numeric fields
+
+	size_t length;
+	uint8_t buffer[MaxLength];
+};
+
+// Print the text that we saved, or format it again if it didn't fit in the buffer
+void FieldWithText::PrintTextFrom(const TextBuffer& text, Print& dev) const
+{
+	if (text.Overflowed())
+	{
+		PrintText(dev);
+	}
+	else
+	{
+		text.PrintTo(dev);
+	}
+}
+
 void FieldWithText::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
 {
 	if (full || changed)
 	{
+		TextBuffer text;
+		PrintText(text);
+		const bool sameText = MatchesSavedText(text);
+		if (!full && valueOnly && sameText)
+		{
+			// Only the value has changed and it looks the same as before, e.g. a temperature that has changed by less than the last displayed digit
+			changed = valueOnly = false;
+			return;
+		}
+
 		lcd.setFont(font);
-		lcd.setColor(fcolour);
-		lcd.setBackColor(bcolour);
+		lcd.setColor(GetFcolour());
+		lcd.setBackColor(GetBcolour());
 		lcd.setTextPos(x + xOffset, y + yOffset, x + xOffset + width);
 		if (align == TextAlignment::Left)
 		{
-			PrintText();
+			PrintTextFrom(text, lcd);
 			lcd.clearToMargin();
 		}
 		else
 		{
 			lcd.clearToMargin();
-			lcd.setTextPos(0, 9999, width);
-			PrintText();    // dummy print to get text width
-			PixelNumber spare = width - lcd.getTextX();
+			if (!sameText)
+			{
+				// The text has changed since we last measured it
+				TextMeasurer tm(font, width);
+				PrintTextFrom(text, tm);
+				textWidth = tm.GetWidth();
+			}
+			PixelNumber spare = width - textWidth;
 			if (align == TextAlignment::Centre)
 			{
 				lcd.setTextPos(x + xOffset + spare/2, y + yOffset, x + xOffset + width);	
@@ -447,76 +1018,86 @@ void FieldWithText::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
 				}
 				lcd.setTextPos(x + xOffset + spare, y + yOffset, x + xOffset + width);
 			}
-			PrintText();
+			PrintTextFrom(text, lcd);
 		}
-		changed = false;
+		SaveText(text);
+		changed = valueOnly = false;
 	}
 }
 
-void TextField::PrintText() const
+void TextField::PrintText(Print& dev) const
 {
 	if (label != NULL)
 	{
-		lcd.print(label);
+		dev.print(label);
 	}
 	if (text != NULL)
 	{
-		lcd.print(text);
+		dev.print(text);
 	}
 }
 
-void FloatField::PrintText() const
+bool NumericField::MatchesSavedText(const TextBuffer& text) const
+{
+	return text.Matches(savedText, savedTextLength);
+}
+
+void NumericField::SaveText(const TextBuffer& text)
+{
+	text.Save(savedText, savedTextLength, noSavedText);
+}
+
+void FloatField::PrintText(Print& dev) const
 {
 	if (label != NULL)
 	{
-		lcd.print(label);
+		dev.print(label);
 	}
-	lcd.print(val, numDecimals);
+	dev.print(val, numDecimals);
 	if (units != NULL)
 	{
-		lcd.print(units);
+		dev.print(units);
 	}
 }
 
-void IntegerField::PrintText() const
+void IntegerField::PrintText(Print& dev) const
 {
 	if (label != NULL)
 	{
-		lcd.print(label);
+		dev.print(label);
 	}
-	lcd.print(val);
+	dev.print(val);
 	if (units != NULL)
 	{
-		lcd.print(units);
+		dev.print(units);
 	}
 }
 
-void StaticTextField::PrintText() const
+void StaticTextField::PrintText(Print& dev) const
 {
 	if (text != nullptr)
 	{
-		lcd.print(text);
+		dev.print(text);
 	}
 }
 
 ButtonBase::ButtonBase(PixelNumber py, PixelNumber px, PixelNumber pw)
-	: DisplayField(py, px, pw),
-	  borderColour(defaultButtonBorderColour), gradColour(defaultGradColour),
-	  pressedBackColour(defaultPressedBackColour), pressedGradColour(defaultPressedGradColour), evt(nullEvent), pressed(false)
+	: DisplayField(py, px, pw), evt(nullEvent), pressed(false)
 {	
 }
 
 PixelNumber ButtonBase::textMargin = 1;
 PixelNumber ButtonBase::iconMargin = 1;
 
-void ButtonBase::DrawOutline(PixelNumber xOffset, PixelNumber yOffset, bool isPressed) const
+void ButtonBase::DrawOutline(PixelNumber xOffset, PixelNumber yOffset, PixelNumber pw, bool isPressed) const
 {
-	lcd.setColor((isPressed) ? pressedBackColour : bcolour);
+	lcd.setColor((isPressed) ? colourScheme->buttonPressedBackColour : GetBcolour());
 	// Note that we draw the filled rounded rectangle with the full width but 2 pixels less height than the border.
 	// This means that we start with the requested colour inside the border.
-	lcd.fillRoundRect(x + xOffset, y + yOffset + 1, x + xOffset + width - 1, y + yOffset + GetHeight() - 2, (isPressed) ? pressedGradColour : gradColour, buttonGradStep);
-	lcd.setColor(borderColour);
-	lcd.drawRoundRect(x + xOffset, y + yOffset, x + xOffset + width - 1, y + yOffset + GetHeight() - 1);
+	lcd.fillRoundRect(x + xOffset, y + yOffset + 1, x + xOffset + pw - 1, y + yOffset + GetHeight() - 2,
+						(isPressed) ? colourScheme->buttonPressedGradColour : colourScheme->buttonGradColour, buttonGradStep);
+	lcd.setColor(colourScheme->buttonBorderColour);
+	lcd.drawRoundRect(x + xOffset, y + yOffset, x + xOffset + pw - 1, y + yOffset + GetHeight() - 1);
 }
 
 SingleButton::SingleButton(PixelNumber py, PixelNumber px, PixelNumber pw)
@@ -527,7 +1108,7 @@ SingleButton::SingleButton(PixelNumber py, PixelNumber px, PixelNumber pw)
 
 void SingleButton::DrawOutline(PixelNumber xOffset, PixelNumber yOffset) const
 {
-	ButtonBase::DrawOutline(xOffset, yOffset, pressed);
+	ButtonBase::DrawOutline(xOffset, yOffset, width, pressed);
 }
 
 /*static*/ LcdFont ButtonWithText::font;
@@ -538,13 +1119,13 @@ void ButtonWithText::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset
 	{
 		DrawOutline(xOffset, yOffset);
 		lcd.setTransparentBackground(true);
-		lcd.setColor(fcolour);
+		lcd.setColor(GetFcolour());
 		lcd.setFont(font);
-		lcd.setTextPos(0, 9999, width - 6);
-		PrintText();							// dummy print to get text width
-		PixelNumber spare = width - 6 - lcd.getTextX();
+		TextMeasurer tm(font, width - 6);
+		PrintText(tm);
+		PixelNumber spare = width - 6 - tm.GetWidth();
 		lcd.setTextPos(x + xOffset + 3 + spare/2, y + yOffset + textMargin + 1, x + xOffset + width - 3);	// text is always centre-aligned
-		PrintText();
+		PrintText(lcd);
 		lcd.setTransparentBackground(false);
 		changed = false;
 	}
@@ -556,9 +1137,9 @@ CharButton::CharButton(PixelNumber py, PixelNumber px, PixelNumber pw, char pc,
 	SetEvent(e, (int)pc);
 }
 
-void CharButton::PrintText() const
+void CharButton::PrintText(Print& dev) const
 {
-	lcd.write((char)GetIParam(0));
+	dev.print((char)GetIParam(0));
 }
 
 TextButton::TextButton(PixelNumber py, PixelNumber px, PixelNumber pw, const char * array null pt, event_t e, int param)
@@ -573,11 +1154,11 @@ TextButton::TextButton(PixelNumber py, PixelNumber px, PixelNumber pw, const cha
 	SetEvent(e, param);
 }
 
-void TextButton::PrintText() const
+void TextButton::PrintText(Print& dev) const
 {
 	if (text != nullptr)
 	{
-		lcd.print(text);
+		dev.print(text);
 	}
 }
 
@@ -600,78 +1181,131 @@ void IconButton::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
 		DrawOutline(xOffset, yOffset);
 		const uint16_t sx = GetIconWidth(icon), sy = GetIconHeight(icon);
 		lcd.setTransparentBackground(true);
-		lcd.drawBitmap(xOffset + x + (width - sx)/2, yOffset + y + iconMargin + 1, sx, sy, GetIconData(icon));
+		lcd.drawPalettedBitmap(xOffset + x + (width - sx)/2, yOffset + y + iconMargin + 1, sx, sy, GetIconData(icon));
 		lcd.setTransparentBackground(false);
 		changed = false;
 	}
 }
 
-void IntegerButton::PrintText() const
+void IntegerButton::PrintText(Print& dev) const
 {
 	if (label != NULL)
 	{
-		lcd.print(label);
+		dev.print(label);
 	}
-	lcd.print(val);
+	dev.print(val);
 	if (units != NULL)
 	{
-		lcd.print(units);
+		dev.print(units);
 	}
 }
 
-void FloatButton::PrintText() const
+void FloatButton::PrintText(Print& dev) const
 {
-	lcd.print(val, numDecimals);
+	dev.print(val, numDecimals);
 	if (units != NULL)
 	{
-		lcd.print(units);
+		dev.print(units);
 	}
 }
 
-#if 0	// not used yet
 ButtonRow::ButtonRow(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ps, unsigned int nb, event_t e)
-	: ButtonBase(py, px, pw), numButtons(nb), whichPressed(-1), step(ps)
+	: ButtonBase(py, px, (nb - 1) * ps + pw), step(ps), buttonWidth(pw), numButtons(nb), whichPressed(-1), drawnPressed(-1)
 {
 	evt = e;
 }
 
-ButtonRowWithText::ButtonRowWithText(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ps, unsigned int nb, event_t e)
-	: ButtonRow(py, px, pw, ps, nb, e)
-{
-}
-
-void ButtonRowWithText::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
+void ButtonRow::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
 {
 	if (full || changed)
 	{
-		for (unsigned int i = 0; i < numButtons; ++i)
+		if (full || !valueOnly)
 		{
-			const PixelNumber buttonXoffset = xOffset + i * step;
-			DrawOutline(buttonXoffset, yOffset, (int)i == whichPressed);
-			lcd.setTransparentBackground(true);
-			lcd.setColor(fcolour);
-			lcd.setFont(font);
-			lcd.setTextPos(0, 9999, width - 6);
-			PrintText(i);							// dummy print to get text width
-			PixelNumber spare = width - 6 - lcd.getTextX();
-			lcd.setTextPos(x + buttonXoffset + 3 + spare/2, y + yOffset + textMargin + 1, x + xOffset + width - 3);	// text is always centre-aligned
-			PrintText(i);
-			lcd.setTransparentBackground(false);
-			changed = false;
+			for (unsigned int i = 0; i < numButtons; ++i)
+			{
+				DrawButton(i, xOffset, yOffset);
+			}
+		}
+		else if (drawnPressed != whichPressed)
+		{
+			// Only the pressed button has changed, so just redraw the buttons that were and are pressed
+			if (drawnPressed >= 0)
+			{
+				DrawButton(drawnPressed, xOffset, yOffset);
+			}
+			if (whichPressed >= 0)
+			{
+				DrawButton(whichPressed, xOffset, yOffset);
+			}
 		}
+		drawnPressed = whichPressed;
+		changed = valueOnly = false;
+	}
+}
+
+void ButtonRow::Press(bool p, int index)
+{
+	const int newPressed = (p) ? index : (index == whichPressed) ? -1 : whichPressed;
+	if (newPressed != whichPressed)
+	{
+		whichPressed = newPressed;
+		SetValueChanged(RefreshPriority::pressed);
+	}
+}
+
+// Return the button nearest to the touch. Touches in the gap between two buttons go to the nearer one.
+unsigned int ButtonRow::GetIndexAt(PixelNumber px, PixelNumber py) const
+{
+	if (px <= x)
+	{
+		return 0;
 	}
+	const unsigned int n = (px - x + (step - buttonWidth)/2)/step;
+	return (n < numButtons) ? n : numButtons - 1;
 }
 
-void CharButtonRow::PrintText(unsigned int n) const
+void ButtonRowWithText::DrawButton(unsigned int n, PixelNumber xOffset, PixelNumber yOffset) const
 {
-	lcd.write(text[n]);
+	const LcdFont font = ButtonWithText::GetFont();
+	const PixelNumber buttonXoffset = xOffset + n * step;
+	DrawOutline(buttonXoffset, yOffset, buttonWidth, (int)n == whichPressed);
+	lcd.setTransparentBackground(true);
+	lcd.setColor(GetFcolour());
+	lcd.setFont(font);
+	TextMeasurer tm(font, buttonWidth - 6);
+	PrintText(tm, n);
+	PixelNumber spare = buttonWidth - 6 - tm.GetWidth();
+	lcd.setTextPos(x + buttonXoffset + 3 + spare/2, y + yOffset + textMargin + 1, x + buttonXoffset + buttonWidth - 3);	// text is always centre-aligned
+	PrintText(lcd, n);
+	lcd.setTransparentBackground(false);
 }
 
 CharButtonRow::CharButtonRow(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ps, const char * array s, event_t e)
 	: ButtonRowWithText(py, px, pw, ps, strlen(s), e), text(s)
 {
 }
-#endif
+
+void CharButtonRow::PrintText(Print& dev, unsigned int n) const
+{
+	dev.print(text[n]);
+}
+
+TextButtonRow::TextButtonRow(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ps, unsigned int nb, const char * array const pt[], event_t e, const char * array const pp[])
+	: ButtonRowWithText(py, px, pw, ps, nb, e), text(pt)
+{
+	params.sParams = pp;
+}
+
+TextButtonRow::TextButtonRow(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ps, unsigned int nb, const char * array const pt[], event_t e, const int pp[])
+	: ButtonRowWithText(py, px, pw, ps, nb, e), text(pt)
+{
+	params.iParams = pp;
+}
+
+void TextButtonRow::PrintText(Print& dev, unsigned int n) const
+{
+	dev.print(text[n]);
+}
 
 void ProgressBar::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
 {
@@ -680,7 +1314,7 @@ void ProgressBar::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
 		PixelNumber pixelsSet = ((width - 2) * percent)/100;
 		if (full)
 		{
-			lcd.setColor(fcolour);
+			lcd.setColor(GetFcolour());
 			lcd.drawLine(x + xOffset, y, x + xOffset + width - 1, y + yOffset);
 			lcd.drawLine(x + xOffset, y + yOffset + height - 1, x + xOffset + width - 1, y + yOffset + height - 1);
 			lcd.drawLine(x + xOffset + width - 1, y + yOffset + 1, x + xOffset + width - 1, y + yOffset + height - 2);
@@ -688,18 +1322,18 @@ void ProgressBar::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
 			lcd.fillRect(x + xOffset, y + yOffset + 1, x + xOffset + pixelsSet, y + yOffset + height - 2);
 			if (pixelsSet < width - 2)
 			{
-				lcd.setColor(bcolour);
+				lcd.setColor(GetBcolour());
 				lcd.fillRect(x + xOffset + pixelsSet + 1, y + yOffset + 1, x + xOffset + width - 2, y + yOffset + height - 2);
 			}
 		}
 		else if (pixelsSet > lastNumPixelsSet)
 		{
-			lcd.setColor(fcolour);
+			lcd.setColor(GetFcolour());
 			lcd.fillRect(x + xOffset + lastNumPixelsSet, y + yOffset + 1, x + xOffset + pixelsSet, y + yOffset + height - 2);
 		}
 		else if (pixelsSet < lastNumPixelsSet)
 		{
-			lcd.setColor(bcolour);
+			lcd.setColor(GetBcolour());
 			lcd.fillRect(x + xOffset + pixelsSet + 1, y + yOffset + 1, x + xOffset + lastNumPixelsSet, y + yOffset + height - 2);	
 		}
 		changed = false;
@@ -707,4 +1341,520 @@ void ProgressBar::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
 	}
 }
 
+ChartField::ChartField(PixelNumber py, PixelNumber px, PixelNumber ph, unsigned int ns, PixelNumber pps, unsigned int nSeries, uint8_t * array buf,
+						const Colour * array colours, const char * array const * array names, uint16_t fs, uint16_t gi)
+	: DisplayField(py, px, ns * pps), font(DisplayField::defaultFont), samples(buf), seriesColours(colours), seriesNames(names), height(ph),
+	  numSamples(ns), nextSample(0), numUndrawn(0), seriesUsed(0), fullScale(fs), gridInterval(gi), numSeries(nSeries), pixelsPerSample(pps)
+{
+	memset(samples, NoSample, numSamples * numSeries * 2);
+}
+
+// Convert a value to a sample. Values at or below zero map to the bottom of the chart and values above full scale to the top.
+uint8_t ChartField::ToSample(float val) const
+{
+	const float scaled = (val * 254)/fullScale;
+	return (scaled <= 0) ? 1 : (scaled >= 254) ? 255 : (uint8_t)(scaled + 0.5f) + 1;
+}
+
+void ChartField::SetValue(unsigned int series, float val)
+{
+	GetSample(nextSample)[2 * series] = ToSample(val);
+	if ((seriesUsed & (1u << series)) == 0)
+	{
+		seriesUsed |= (1u << series);
+		SetChanged();							// the legend needs to be redrawn
+	}
+}
+
+void ChartField::SetTarget(unsigned int series, float target)
+{
+	GetSample(nextSample)[2 * series + 1] = ToSample(target);
+}
+
+void ChartField::AddSample()
+{
+	nextSample = (nextSample + 1) % numSamples;
+	memset(GetSample(nextSample), NoSample, numSeries * 2);		// discard the oldest sample
+	if (numUndrawn < numSamples)
+	{
+		++numUndrawn;
+	}
+	SetValueChanged();
+}
+
+// Draw the horizontal grid lines between screen x coordinates xmin and xmax inclusive
+void ChartField::DrawGrid(PixelNumber xmin, PixelNumber xmax, PixelNumber yOffset) const
+{
+	lcd.setColor(GetFcolour());
+	for (unsigned int val = 0; val <= fullScale; val += gridInterval)
+	{
+		const PixelNumber ypos = GetYpos(val) + yOffset;
+		lcd.fillRect(xmin, ypos, xmax, ypos);
+	}
+}
+
+// Draw one sample over the background. If 'join' is true then join the values to the ones in the previous sample.
+void ChartField::DrawSample(unsigned int n, bool join, PixelNumber xOffset, PixelNumber yOffset) const
+{
+	const PixelNumber xmin = x + xOffset + n * pixelsPerSample, xmax = xmin + pixelsPerSample - 1;
+	const uint8_t * const sample = GetSample(n);
+	const uint8_t * const prevSample = GetSample((n == 0) ? numSamples - 1 : n - 1);
+	for (unsigned int i = 0; i < numSeries; ++i)
+	{
+		lcd.setColor(seriesColours[i]);
+		const uint8_t val = sample[2 * i];
+		if (val != NoSample)
+		{
+			const PixelNumber ypos = SampleY(val) + yOffset;
+			const uint8_t prevVal = prevSample[2 * i];
+			if (join && prevVal != NoSample && prevVal != val)
+			{
+				lcd.fillRect(xmin, SampleY(prevVal) + yOffset, xmin, ypos);
+			}
+			lcd.fillRect(xmin, ypos, xmax, ypos);
+		}
+		const uint8_t target = sample[2 * i + 1];
+		if (target != NoSample && (n & 1) == 0)
+		{
+			lcd.drawPixel(xmin, SampleY(target) + yOffset);
+		}
+	}
+}
+
+// Clear the column of one sample and draw it again
+void ChartField::RedrawSample(unsigned int n, bool join, PixelNumber xOffset, PixelNumber yOffset) const
+{
+	const PixelNumber xmin = x + xOffset + n * pixelsPerSample, xmax = xmin + pixelsPerSample - 1;
+	lcd.setColor(GetBcolour());
+	lcd.fillRect(xmin, y + yOffset, xmax, y + yOffset + PlotHeight() - 1);
+	DrawGrid(xmin, xmax, yOffset);
+	DrawSample(n, join, xOffset, yOffset);
+}
+
+// Clear the entry that we are collecting the next sample in and draw the cursor in it
+void ChartField::DrawGap(PixelNumber xOffset, PixelNumber yOffset) const
+{
+	const PixelNumber xmin = x + xOffset + nextSample * pixelsPerSample, xmax = xmin + pixelsPerSample - 1;
+	lcd.setColor(GetBcolour());
+	lcd.fillRect(xmin, y + yOffset, xmax, y + yOffset + PlotHeight() - 1);
+	lcd.setColor(GetFcolour());
+	lcd.fillRect(xmin, y + yOffset, xmin, y + yOffset + PlotHeight() - 1);
+}
+
+void ChartField::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
+{
+	if (full || changed)
+	{
+		if (full || !valueOnly || numUndrawn + 1 >= numSamples)
+		{
+			// Draw the background, grid, legend and all the samples
+			lcd.setColor(GetBcolour());
+			lcd.fillRect(x + xOffset, y + yOffset, x + xOffset + width - 1, y + yOffset + height - 1);
+			DrawGrid(x + xOffset, x + xOffset + width - 1, yOffset);
+
+			lcd.setFont(font);
+			lcd.setBackColor(GetBcolour());
+			lcd.setTextPos(x + xOffset, y + yOffset + height - UTFT::GetFontHeight(font), x + xOffset + width);
+			for (unsigned int i = 0; i < numSeries; ++i)
+			{
+				if ((seriesUsed & (1u << i)) != 0)
+				{
+					lcd.setColor(seriesColours[i]);
+					lcd.print(seriesNames[i]);
+					lcd.print("  ");
+				}
+			}
+
+			// Draw the samples from the oldest to the newest
+			for (unsigned int i = 1; i < numSamples; ++i)
+			{
+				DrawSample((nextSample + i) % numSamples, i != 1, xOffset, yOffset);
+			}
+		}
+		else
+		{
+			// Draw just the samples that have been added since we last drew the chart, along with the grid behind them
+			for (unsigned int i = numUndrawn; i != 0; --i)
+			{
+				RedrawSample((nextSample + numSamples - i) % numSamples, true, xOffset, yOffset);
+			}
+
+			// The oldest sample was joined to the one that we have just discarded, so draw it again without the join
+			RedrawSample((nextSample + 1) % numSamples, false, xOffset, yOffset);
+		}
+		DrawGap(xOffset, yOffset);
+		numUndrawn = 0;
+		changed = valueOnly = false;
+	}
+}
+
+// ListField class members
+
+// Constants that control how the list responds to being dragged
+const int dragThreshold = 8;					// how many pixels a touch must move before we treat it as a drag instead of a tap
+const int32_t maxVelocity = 3000;				// the fastest we let the list move after a drag, in pixels per second
+const int32_t minVelocity = 30;					// the list stops moving when it slows down to this speed
+const int32_t momentumTimeConstant = 350;		// the time in milliseconds for the speed of the list to fall by about 63%
+const uint32_t maxAnimateInterval = 100;		// the longest time step we use when moving the list, so that a slow redraw doesn't make it jump
+const uint32_t maxStationaryTime = 100;			// if the touch stayed still for this long in milliseconds before it ended, the list doesn't keep moving
+
+/*static*/ ListField * null ListField::scrollingList = nullptr;
+
+// Return a modulo b, always in the range 0 to b-1
+static inline int Mod(int a, int b)
+{
+	const int r = a % b;
+	return (r < 0) ? r + b : r;
+}
+
+// Fill a rectangle with the current colour, clipped to the display rows clipTop to clipBottom inclusive
+static void FillClipped(int x1, int y1, int x2, int y2, int clipTop, int clipBottom)
+{
+	y1 = max<int>(y1, clipTop);
+	y2 = min<int>(y2, clipBottom);
+	if (x1 <= x2 && y1 <= y2)
+	{
+		lcd.fillRect(x1, y1, x2, y2);
+	}
+}
+
+ListField::ListField(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ph, unsigned int nc, PixelNumber columnSpacing, PixelNumber prs, event_t e)
+	: ButtonBase(py, px, pw), items(nullptr), height(ph), columnStep((pw + columnSpacing)/nc), cellWidth((pw + columnSpacing)/nc - columnSpacing),
+	  rowSpacing(prs), numItems(0), numColumns(nc), pressedItem(-1), drawnPressed(-1), scrollPos(0), drawnPos(0), ringBase(0),
+	  dragStartPos(0), dragStartY(0), lastDragY(0), isTap(false), lastMoveTime(0), velocity(0), moveRemainder(0)
+{
+	evt = e;
+}
+
+void ListField::SetItems(const char * array const * array null pi, unsigned int ni)
+{
+	items = pi;
+	numItems = (pi == nullptr) ? 0 : ni;
+	pressedItem = -1;
+	velocity = 0;
+	ClearHardwareScroll();						// the list is about to be redrawn completely, and it may be hidden first
+	ScrollTo(scrollPos);
+	SetChanged();
+}
+
+int ListField::MaxScrollPos() const
+{
+	const unsigned int numRows = (numItems + numColumns - 1)/numColumns;
+	const int contentHeight = (int)(numRows * RowStep()) - (int)rowSpacing;
+	return (contentHeight > (int)height) ? contentHeight - height : 0;
+}
+
+bool ListField::ScrollTo(int pos)
+{
+	const int newPos = constrain<int>(pos, 0, MaxScrollPos());
+	if (newPos != scrollPos)
+	{
+		scrollPos = newPos;
+		SetValueChanged(RefreshPriority::adjusting);
+	}
+	return newPos == pos;
+}
+
+void ListField::StartDrag(PixelNumber py, uint32_t now)
+{
+	isTap = (velocity == 0);					// a touch that stops the list moving doesn't select anything
+	velocity = 0;
+	dragStartPos = scrollPos;
+	dragStartY = lastDragY = py;
+	lastMoveTime = now;
+}
+
+void ListField::Drag(PixelNumber py, uint32_t now)
+{
+	if (isTap)
+	{
+		if (abs((int)py - (int)dragStartY) < dragThreshold)
+		{
+			return;
+		}
+		isTap = false;
+	}
+
+	// Keep a running average of the speed of the touch, so that we know how fast to keep the list moving when the touch ends
+	const uint32_t interval = now - lastMoveTime;
+	if (interval != 0)
+	{
+		velocity = (velocity + (((int32_t)lastDragY - (int32_t)py) * 1000)/(int32_t)interval)/2;
+		lastDragY = py;
+		lastMoveTime = now;
+	}
+	ScrollTo(dragStartPos + (int)dragStartY - (int)py);
+}
+
+bool ListField::EndDrag(uint32_t now)
+{
+	if (isTap || now - lastMoveTime > maxStationaryTime)
+	{
+		velocity = 0;							// it was a tap, or the touch stopped moving before it ended
+	}
+	else
+	{
+		velocity = constrain<int32_t>(velocity, -maxVelocity, maxVelocity);
+		if (abs(velocity) < minVelocity)
+		{
+			velocity = 0;
+		}
+		lastMoveTime = now;
+		moveRemainder = 0;
+	}
+	return isTap;
+}
+
+// Keep the list moving after a drag, slowing down until it stops or reaches one end
+void ListField::Animate(uint32_t now)
+{
+	if (velocity != 0)
+	{
+		const uint32_t interval = min<uint32_t>(now - lastMoveTime, maxAnimateInterval);
+		lastMoveTime = now;
+		const int32_t distance = velocity * (int32_t)interval + moveRemainder;		// in thousandths of a pixel
+		moveRemainder = distance % 1000;
+		if (!ScrollTo(scrollPos + distance/1000))
+		{
+			velocity = 0;						// we reached the end of the list
+		}
+		else
+		{
+			velocity -= (velocity * (int32_t)interval)/momentumTimeConstant;
+			if (abs(velocity) < minVelocity)
+			{
+				velocity = 0;
+			}
+		}
+	}
+}
+
+void ListField::Press(bool p, int index)
+{
+	const int newPressed = (p && index < (int)numItems) ? index : (index == pressedItem) ? -1 : pressedItem;
+	if (newPressed != pressedItem)
+	{
+		pressedItem = newPressed;
+		SetValueChanged(RefreshPriority::pressed);
+	}
+}
+
+// Return the item nearest to a touch. Touches in the gap between two columns go to the nearer one.
+unsigned int ListField::GetIndexAt(PixelNumber px, PixelNumber py) const
+{
+	const unsigned int row = ((py > y) ? py - y + scrollPos : scrollPos)/RowStep();
+	const unsigned int col = (px > x) ? min<unsigned int>((px - x + (columnStep - cellWidth)/2)/columnStep, numColumns - 1) : 0;
+	return row * numColumns + col;
+}
+
+void ListField::Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset)
+{
+	if (full || changed)
+	{
+		if (full || !valueOnly)
+		{
+			ClearHardwareScroll();
+			drawnPos = scrollPos;
+			DrawContent(drawnPos, drawnPos + height, xOffset, yOffset);
+		}
+		else
+		{
+			if (drawnPos != scrollPos)
+			{
+				ScrollDisplay(xOffset, yOffset);
+			}
+			if (drawnPressed != pressedItem)
+			{
+				RedrawItem(drawnPressed, xOffset, yOffset);
+				RedrawItem(pressedItem, xOffset, yOffset);
+			}
+		}
+		drawnPressed = pressedItem;
+		changed = valueOnly = false;
+	}
+}
+
+// Move the list on the display from drawnPos to scrollPos
+void ListField::ScrollDisplay(PixelNumber xOffset, PixelNumber yOffset)
+{
+	const PixelNumber top = y + yOffset;
+	if (scrollingList != this && lcd.canScroll())
+	{
+		// Start scrolling in hardware. The rows of the list are already in the right place for an offset of zero.
+		StopHardwareScroll(nullptr);
+		scrollingList = this;
+		ringBase = drawnPos;
+	}
+
+	const int oldPos = drawnPos;
+	drawnPos = scrollPos;
+	if (scrollingList == this)
+	{
+		// Scroll the rows that are still visible in hardware, then draw the ones that have come into view over the ones that have gone
+		lcd.setScroll(top, top + height - 1, Mod(drawnPos - ringBase, height));
+		if (drawnPos > oldPos && drawnPos - oldPos < height)
+		{
+			DrawContent(oldPos + height, drawnPos + height, xOffset, yOffset);
+		}
+		else if (drawnPos < oldPos && oldPos - drawnPos < height)
+		{
+			DrawContent(drawnPos, oldPos, xOffset, yOffset);
+		}
+		else
+		{
+			DrawContent(drawnPos, drawnPos + height, xOffset, yOffset);
+		}
+	}
+	else
+	{
+		DrawContent(drawnPos, drawnPos + height, xOffset, yOffset);
+	}
+}
+
+// Return the display to normal if this list is scrolling it in hardware. The rows of the list are left where they are in the frame memory.
+void ListField::ClearHardwareScroll()
+{
+	if (scrollingList == this)
+	{
+		scrollingList = nullptr;
+		if (owner != nullptr)
+		{
+			const PixelNumber top = y + owner->Ypos();
+			lcd.setScroll(top, top + height - 1, 0);
+		}
+	}
+}
+
+/*static*/ void ListField::StopHardwareScroll(const Window * null redrawing)
+{
+	ListField * const list = scrollingList;
+	if (list != nullptr)
+	{
+		list->ClearHardwareScroll();
+
+		// Unless the hardware offset happened to be zero or the list has been hidden, the rows of the list are now in the wrong places
+		if (list->owner != nullptr && list->IsVisible() && Mod(list->drawnPos - list->ringBase, list->height) != 0)
+		{
+			for (const Window * null w = redrawing; w != nullptr; w = w->GetPopup())
+			{
+				if (w == list->owner)
+				{
+					return;
+				}
+			}
+			list->DrawContent(list->drawnPos, list->drawnPos + list->height, list->owner->Xpos(), list->owner->Ypos());
+		}
+	}
+}
+
+/*static*/ void ListField::StopHardwareScroll(const DisplayField * null f, PixelNumber ymin, PixelNumber ymax, const Window * null redrawing)
+{
+	const ListField * const list = scrollingList;
+	if (list != nullptr && f != list && list->owner != nullptr)
+	{
+		const PixelNumber top = list->y + list->owner->Ypos();
+		if (ymin < top + list->height && ymax >= top)
+		{
+			StopHardwareScroll(redrawing);
+		}
+	}
+}
+
+// Draw the pixel rows of the list from 'start' up to but not including 'end', which must be visible on the display
+void ListField::DrawContent(int start, int end, PixelNumber xOffset, PixelNumber yOffset) const
+{
+	const int top = y + yOffset;
+	if (scrollingList == this)
+	{
+		// When scrolling in hardware, pixel row n of the list is in display row top + (n - ringBase) mod height, so we may need to draw it in two parts
+		while (start < end)
+		{
+			const int displayRow = Mod(start - ringBase, height);
+			const int num = min<int>(end - start, height - displayRow);
+			DrawLines(start, start + num, top + displayRow, xOffset);
+			start += num;
+		}
+	}
+	else
+	{
+		DrawLines(start, end, top + start - drawnPos, xOffset);
+	}
+}
+
+// Draw the pixel rows of the list from 'start' up to but not including 'end' starting at display row ypos
+void ListField::DrawLines(int start, int end, int ypos, PixelNumber xOffset) const
+{
+	const int clipTop = ypos, clipBottom = ypos + end - start - 1;
+	const int rowStep = RowStep();
+	const int left = x + xOffset, right = left + width - 1;
+	lcd.setFont(ButtonWithText::GetFont());
+	lcd.setTransparentBackground(false);
+	lcd.setTextClip(clipTop, clipBottom);
+	for (int row = start/rowStep; row * rowStep < end; ++row)
+	{
+		const int rowTop = ypos + row * rowStep - start;
+		for (unsigned int col = 0; col < numColumns; ++col)
+		{
+			DrawCell(row * numColumns + col, left + col * columnStep, rowTop, clipTop, clipBottom);
+		}
+
+		// Fill the gaps between the columns and under the row
+		lcd.setColor(owner->GetBackgroundColour());
+		for (unsigned int col = 0; col < numColumns; ++col)
+		{
+			const int gapRight = (col + 1 < numColumns) ? left + (col + 1) * columnStep - 1 : right;
+			FillClipped(left + col * columnStep + cellWidth, rowTop, gapRight, rowTop + rowStep - rowSpacing - 1, clipTop, clipBottom);
+		}
+		FillClipped(left, rowTop + rowStep - rowSpacing, right, rowTop + rowStep - 1, clipTop, clipBottom);
+	}
+	lcd.clearTextClip();
+}
+
+// Draw the part of the cell for item n that is between display rows clipTop and clipBottom, given that the cell starts at xpos, ypos
+void ListField::DrawCell(unsigned int n, int xpos, int ypos, int clipTop, int clipBottom) const
+{
+	const int cellRight = xpos + cellWidth - 1, cellBottom = ypos + RowHeight() - 1;
+	if (n >= numItems)
+	{
+		lcd.setColor(owner->GetBackgroundColour());
+		FillClipped(xpos, ypos, cellRight, cellBottom, clipTop, clipBottom);
+		return;
+	}
+
+	// We draw the cells square and without a gradient, so that we can draw any part of one and draw the text on a plain background
+	lcd.setColor(colourScheme->buttonBorderColour);
+	FillClipped(xpos, ypos, cellRight, ypos, clipTop, clipBottom);
+	FillClipped(xpos, cellBottom, cellRight, cellBottom, clipTop, clipBottom);
+	FillClipped(xpos, ypos + 1, xpos, cellBottom - 1, clipTop, clipBottom);
+	FillClipped(cellRight, ypos + 1, cellRight, cellBottom - 1, clipTop, clipBottom);
+
+	const Colour backColour = ((int)n == pressedItem) ? colourScheme->buttonPressedBackColour : GetBcolour();
+	const int textTop = ypos + textMargin + 1, textBottom = textTop + UTFT::GetFontHeight(ButtonWithText::GetFont()) - 1;
+	lcd.setColor(backColour);
+	FillClipped(xpos + 1, ypos + 1, cellRight - 1, textTop - 1, clipTop, clipBottom);
+	FillClipped(xpos + 1, textBottom + 1, cellRight - 1, cellBottom - 1, clipTop, clipBottom);
+	FillClipped(xpos + 1, textTop, xpos + 2, textBottom, clipTop, clipBottom);
+	if (textTop <= clipBottom && textBottom >= clipTop)
+	{
+		lcd.setColor(GetFcolour());
+		lcd.setBackColor(backColour);
+		lcd.print(items[n], xpos + 3, textTop, cellRight);
+		lcd.clearToMargin();
+	}
+}
+
+// Redraw the row that holds item n, if it is visible
+void ListField::RedrawItem(int n, PixelNumber xOffset, PixelNumber yOffset) const
+{
+	if (n >= 0)
+	{
+		const int rowTop = (n/numColumns) * RowStep();
+		const int start = max<int>(rowTop, drawnPos), end = min<int>(rowTop + RowHeight(), drawnPos + height);
+		if (start < end)
+		{
+			DrawContent(start, end, xOffset, yOffset);
+		}
+	}
+}
+
 // End
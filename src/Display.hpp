@@ -11,13 +11,14 @@
 
 #include "ecv.h"
 #include "Hardware/UTFT.hpp"
+#include "ColourSchemes.hpp"
 
 // Fonts are held as arrays of 8-bit data in flash.
 typedef const uint8_t * array LcdFont;
 
-// An icon is stored an array of uint16_t data normally held in flash memory. The first value is the width in pixels, the second is the height in pixels.
-// After that comes the icon data, 16 bits per pixel, one row at a time.
-typedef const uint16_t * array Icon;
+// An icon is stored an array of uint8_t data normally held in flash memory. The first value is the width in pixels, the second is the height in pixels.
+// After that comes the icon data, as a palette and run-length encoded palette indices in the format generated by Icons/iconcompress.py.
+typedef const uint8_t * array Icon;
 
 // Unicode strings for special characters in our font
 #define DECIMAL_POINT	"\xC2\xB7"		// Unicode middle-dot
@@ -30,9 +31,22 @@ typedef uint16_t PixelNumber;
 typedef uint8_t event_t;
 const event_t nullEvent = 0;
 
+// Fields refer to their colours by a style number, which indexes a table of styles provided by the application
+typedef uint8_t style_t;
+
+// The colours of a style are given as roles in the colour scheme, so that the colour scheme can be changed without changing the fields
+struct DisplayStyle
+{
+	uint8_t fcolour, bcolour;					// COLOUR_ROLE of the foreground and background colours
+};
+
 enum class TextAlignment : uint8_t { Left, Centre, Right };
 	
 class ButtonBase;
+class Window;
+
+// Order in which changed fields are redrawn when there isn't time to redraw them all in one go
+enum class RefreshPriority : uint8_t { normal = 0, adjusting = 1, pressed = 2 };
 
 // Small by-value class to identify what button has been pressed
 class ButtonPress
@@ -63,28 +77,43 @@ class DisplayField
 protected:
 	PixelNumber y, x;							// Coordinates of top left pixel, counting from the top left corner
 	PixelNumber width;							// number of pixels occupied in each direction
-	Colour fcolour, bcolour;					// foreground and background colours
-	bool changed;
-	bool visible;
+	style_t style;								// index into the style table, which gives the foreground and background colours
+	bool changed : 1;
+	bool visible : 1;
+	bool queued : 1;							// true if this field is in its window's queue of fields to refresh
+	bool inList : 1;							// true if this field is in its window's current list of fields
+	uint8_t queuedPriority : 2;					// the RefreshPriority that the field was queued with
+	bool valueOnly : 1;							// true if the only change since the field was drawn is to the value it shows, e.g. which of its buttons is pressed
+	uint16_t zOrder;							// fields with higher values are nearer the start of the display list, so they are drawn first
+	Window * null owner;						// the window that the field was added to
+	DisplayField * null nextQueued;				// link to next field in the owning window's refresh queue
 	
 	static LcdFont defaultFont;
-	static Colour defaultFcolour, defaultBcolour;
-	static Colour defaultButtonBorderColour, defaultGradColour, defaultPressedBackColour, defaultPressedGradColour;
+	static style_t defaultStyle;
+	static const DisplayStyle * array styles;
+	static const ColourScheme * colourScheme;
 	
 protected:
 	DisplayField(PixelNumber py, PixelNumber px, PixelNumber pw);
+
+	Colour GetFcolour() const { return colourScheme->GetColour(styles[style].fcolour); }
+	Colour GetBcolour() const { return colourScheme->GetColour(styles[style].bcolour); }
+	void SetValueChanged(RefreshPriority pri = RefreshPriority::normal);
 	
 	virtual PixelNumber GetHeight() const { return 1; }		// would like to make this pure virtual but then we get 50K of library that we don't want
 
 public:
 	DisplayField * null next;					// link to next field in list
 
+	friend class Window;
+	friend class MainWindow;
+
 	virtual bool IsButton() const { return false; }
 	bool IsVisible() const { return visible; }
 	void Show(bool v);
 	virtual void Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset) { }		// would like to make this pure virtual but then we get 50K of library that we don't want
-	void SetColours(Colour pf, Colour pb);
-	void SetChanged() { changed = true; }
+	void SetStyle(style_t s);
+	void SetChanged(RefreshPriority pri = RefreshPriority::normal);
 	PixelNumber GetMinX() const { return x; }
 	PixelNumber GetMaxX() const { return x + width - 1; }
 	PixelNumber GetMinY() const { return y; }
@@ -92,38 +121,134 @@ public:
 		
 	virtual event_t GetEvent() const { return nullEvent; }
 
-	static void SetDefaultColours(Colour pf, Colour pb) { defaultFcolour = pf; defaultBcolour = pb; }
-	static void SetDefaultColours(Colour pf, Colour pb, Colour pbb, Colour pg, Colour pbp, Colour pgp);
+	static void SetDefaultStyle(style_t s) { defaultStyle = s; }
+	static void SetStyles(const DisplayStyle * array s) { styles = s; }
+	static void SetColourScheme(const ColourScheme& cs) { colourScheme = &cs; }
+	static const ColourScheme& GetColourScheme() { return *colourScheme; }
 	static void SetDefaultFont(LcdFont pf) { defaultFont = pf; }
-	static ButtonPress FindEvent(PixelNumber x, PixelNumber y, DisplayField * null p);
 	
 	// Icon management
 	static PixelNumber GetIconWidth(Icon ic) { return ic[0]; }
 	static PixelNumber GetIconHeight(Icon ic) { return ic[1]; }
-	static const uint16_t * array GetIconData(Icon ic) { return ic + 2; }
+	static const uint8_t * array GetIconData(Icon ic) { return ic + 2; }
 		
-	static PixelNumber GetTextWidth(const char* array s, PixelNumber maxWidth);		// find out how much width we need to print this text
+	static PixelNumber GetTextWidth(const char* array s, PixelNumber maxWidth);		// find out how much width we need to print this text in the default font
+};
+
+// Rectangle in screen coordinates. The max coordinates are inclusive.
+struct Rect
+{
+	PixelNumber xmin, ymin, xmax, ymax;
+
+	bool Overlaps(PixelNumber pxmin, PixelNumber pymin, PixelNumber pxmax, PixelNumber pymax) const
+	{
+		return xmin <= pxmax && pxmin <= xmax && ymin <= pymax && pymin <= ymax;
+	}
+
+	bool IsInside(PixelNumber pxmin, PixelNumber pymin, PixelNumber pxmax, PixelNumber pymax) const
+	{
+		return pxmin <= xmin && pymin <= ymin && xmax <= pxmax && ymax <= pymax;
+	}
+
+	uint32_t Area() const { return (uint32_t)(xmax - xmin + 1) * (uint32_t)(ymax - ymin + 1); }
+};
+
+// Set of areas of the display that need to be repainted. Rectangles that overlap or touch are merged as they are added,
+// so that each area of the screen gets repainted only once.
+class DamageRegion
+{
+public:
+	static const size_t MaxRects = 8;
+
+	DamageRegion() : numRects(0) { }
+	void Add(PixelNumber pxmin, PixelNumber pymin, PixelNumber pxmax, PixelNumber pymax);
+	void RemoveInside(PixelNumber pxmin, PixelNumber pymin, PixelNumber pxmax, PixelNumber pymax);
+	bool IsEmpty() const { return numRects == 0; }
+	size_t Size() const { return numRects; }
+	const Rect& operator[](size_t index) const pre(index < numRects) { return rects[index]; }
+	void Clear() { numRects = 0; }
+
+private:
+	void Remove(size_t index) pre(index < numRects);
+
+	Rect rects[MaxRects];
+	size_t numRects;
+};
+
+// Coarse grid over the buttons in a list of fields, so that finding the button that has been touched only needs to test the buttons near the touch.
+// Each cell lists, in display list order, the buttons that are within touch range of some point in the cell. Visibility and event numbers are checked
+// when we search, because they may change without the owning window being told.
+// There is one index, for the list of fields that was searched last. Memory can't be freed, so the entries are allocated once, big enough for the
+// largest list passed to Reserve. A list that needs more entries than that is searched without the index.
+class FieldIndex
+{
+public:
+	static const size_t GridSize = 8;			// number of cells in each direction
+	static const int maxXerror = 8, maxYerror = 8;	// a touch must be closer than this to a button to select it
+
+	FieldIndex() : indexedRoot(nullptr), entries(nullptr), capacity(0), xShift(0), yShift(0), valid(false), indexed(false) { }
+	void Reserve(DisplayField * null root);
+	void Invalidate() { valid = false; }
+	ButtonPress FindEvent(PixelNumber x, PixelNumber y, DisplayField * null root);
+
+private:
+	size_t Layout(DisplayField * null root, uint16_t cellCount[]);
+	void Build(DisplayField * null root);
+	size_t CellNumber(PixelNumber x, PixelNumber y) const;
+	void GetCellRange(const DisplayField *p, size_t& first, size_t& last) const;
+	static void Consider(DisplayField *p, PixelNumber x, PixelNumber y, int& bestError, ButtonBase * null & best);
+
+	DisplayField * null indexedRoot;			// the list of fields that the index was built from
+	DisplayField ** array null entries;			// the buttons in each cell, stored cell by cell
+	size_t capacity;							// number of entries allocated, or to allocate if entries is null
+	uint16_t cellStart[GridSize * GridSize + 1];	// index into entries of the first button in each cell
+	uint8_t xShift, yShift;						// log2 of the cell width and height in pixels
+	bool valid;									// true if the index is up to date for indexedRoot
+	bool indexed;								// true if the buttons of indexedRoot fitted in the entries
 };
 
 class PopupWindow;
 
+// Counters to show how well the refresh budget is working
+struct RefreshStatistics
+{
+	uint32_t fieldsRefreshed;					// number of queued fields that have been redrawn
+	uint32_t overruns;							// number of refreshes that ran out of time and left fields to be redrawn next time
+	uint32_t maxMillis;							// longest time spent redrawing queued fields in one refresh
+};
+
 class Window
 {
 protected:
 	DisplayField * null root;
 	PopupWindow * null next;
+	DisplayField * null queue;					// fields that have changed and not been redrawn yet, in display list order
 	Colour backgroundColour;
+
+	static FieldIndex fieldIndex;				// index of the buttons of the window that was touched last
+	static DamageRegion damage;				// areas of the display that have been invalidated and not yet repainted
+	static RefreshStatistics refreshStats;
+
+	void RepaintDamage();
+	void RepaintArea(const Rect& r);
+	bool RefreshQueued(RefreshPriority pri, uint32_t startTime, uint32_t budget);
+	void ClearQueue();
+	void DiscardPopupBackgrounds();
 	
 public:
 	Window(Colour pb);
 	virtual PixelNumber Xpos() const { return 0; }
 	virtual PixelNumber Ypos() const { return 0; }
 	void AddField(DisplayField *p);
+	void Enqueue(DisplayField *f, RefreshPriority pri);
 	ButtonPress FindEvent(PixelNumber x, PixelNumber y);
 	ButtonPress FindEventOutsidePopup(PixelNumber x, PixelNumber y);
+	static void ReserveFieldIndex(DisplayField * null r) { fieldIndex.Reserve(r); }
 	DisplayField * null GetRoot() const { return root; }
+	void SetBackgroundColour(Colour pb) { backgroundColour = pb; }
+	Colour GetBackgroundColour() const { return backgroundColour; }
 	virtual void Refresh(bool full) = 0;
-	void Redraw(DisplayField *f);
+	void Redraw(DisplayField *f, bool full = true);
 	void Show(DisplayField *f, bool v);
 	void Press(ButtonPress bp, bool v);
 	void SetPopup(PopupWindow * p, PixelNumber px = 0, PixelNumber py = 0, bool redraw = true);
@@ -132,18 +257,24 @@ public:
 	bool ObscuredByPopup(const DisplayField *p) const;
 	bool Visible(const DisplayField *p) const;
 	virtual bool Contains(PixelNumber xmin, PixelNumber ymin, PixelNumber xmax, PixelNumber ymax) const = 0;
+
+	static const RefreshStatistics& GetRefreshStatistics() { return refreshStats; }
+	static void ResetRefreshStatistics();
 };
 
 class MainWindow : public Window
 {
+	uint32_t refreshBudget;						// how many milliseconds Refresh(false) may spend redrawing changed fields, or 0 for no limit
+
 public:
 	MainWindow();
 	void Init(Colour pb);
 	void ClearAll();
 	void Refresh(bool full) override;
-	void SetRoot(DisplayField * null r) { root = r; }
+	void SetRoot(DisplayField * null r);
 	bool Contains(PixelNumber xmin, PixelNumber ymin, PixelNumber xmax, PixelNumber ymax) const override;
 	void ClearAllPopups();
+	void SetRefreshBudget(uint32_t millis) { refreshBudget = millis; }
 };
 
 class PopupWindow : public Window
@@ -151,6 +282,13 @@ class PopupWindow : public Window
 private:
 	PixelNumber height, width, xPos, yPos;
 	Colour borderColour;
+#ifdef UTFT_READBACK
+	size_t savedStart, savedLength;				// where the pixels that this popup covers are saved in the backing store, if they were saved
+
+	static const size_t BackingStoreSize = 6144;	// number of 16-bit words of RAM we use to save the pixels under popup windows
+	static uint16_t backingStore[BackingStoreSize];
+	static size_t backingStoreUsed;
+#endif
 	
 public:
 	PopupWindow(PixelNumber ph, PixelNumber pw, Colour pb, Colour pBorder);
@@ -161,28 +299,63 @@ public:
 	PixelNumber Ypos() const override { return yPos; }
 	void Refresh(bool full) override;
 	void SetPos(PixelNumber px, PixelNumber py) { xPos = px; yPos = py; }
+	void SetColours(Colour pb, Colour pBorder) { backgroundColour = pb; borderColour = pBorder; }
 	bool Contains(PixelNumber xmin, PixelNumber ymin, PixelNumber xmax, PixelNumber ymax) const override;
+#ifdef UTFT_READBACK
+	void SaveBackground(bool isFirstPopup);
+	bool RestoreBackground();
+	void ReleaseBackground();
+	void DiscardBackground() { savedLength = 0; }
+#endif
 };
 
 // Base class for fields displaying text
+class TextBuffer;
+
 class FieldWithText : public DisplayField
 {
 	LcdFont font;
 	TextAlignment align;
-	
+	PixelNumber textWidth;						// width of the text when we last drew it
+
+	void PrintTextFrom(const TextBuffer& text, Print& dev) const;
+
 protected:
 	PixelNumber GetHeight() const override { return UTFT::GetFontHeight(font); }
 	
-	virtual void PrintText() const {}		// would ideally be pure virtual
+	virtual void PrintText(Print& dev) const {}		// would ideally be pure virtual
+
+	// Fields whose text changes often keep a copy of the text they last drew, so that they can skip redrawing it if it hasn't changed
+	virtual bool MatchesSavedText(const TextBuffer& text) const { return false; }
+	virtual void SaveText(const TextBuffer& text) {}
 
 	FieldWithText(PixelNumber py, PixelNumber px, PixelNumber pw, TextAlignment pa)
-		: DisplayField(py, px, pw), font(DisplayField::defaultFont), align(pa)
+		: DisplayField(py, px, pw), font(DisplayField::defaultFont), align(pa), textWidth(0)
 	{
 	}
 		
 public:
 	void Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset) override final;
 };
+
+// Base class for the numeric fields, which are the ones that change often
+class NumericField : public FieldWithText
+{
+	static const size_t savedTextLength = 12;	// long enough for the numeric fields
+	static const char noSavedText = '\xFF';		// never the first byte of UTF-8 text
+
+	char savedText[savedTextLength];			// the text when we last drew it padded with nulls, or noSavedText if it didn't fit
+
+protected:
+	bool MatchesSavedText(const TextBuffer& text) const override;
+	void SaveText(const TextBuffer& text) override;
+
+	NumericField(PixelNumber py, PixelNumber px, PixelNumber pw, TextAlignment pa)
+		: FieldWithText(py, px, pw, pa)
+	{
+		savedText[0] = noSavedText;
+	}
+};
 	
 class TextField : public FieldWithText
 {
@@ -190,7 +363,7 @@ class TextField : public FieldWithText
 	const char* array null text;
 	
 protected:
-	void PrintText() const override;
+	void PrintText(Print& dev) const override;
 
 public:
 	TextField(PixelNumber py, PixelNumber px, PixelNumber pw, TextAlignment pa, const char * array null pl, const char* array null pt = nullptr)
@@ -201,17 +374,17 @@ public:
 	void SetValue(const char* array s)
 	{
 		text = s;
-		changed = true;
+		SetValueChanged();
 	}
 
 	void SetLabel(const char* array s)
 	{
 		label = s;
-		changed = true;
+		SetValueChanged();
 	}
 };
 
-class FloatField : public FieldWithText
+class FloatField : public NumericField
 {
 	const char* array null label;
 	const char* array null units;
@@ -219,40 +392,42 @@ class FloatField : public FieldWithText
 	uint8_t numDecimals;
 
 protected:
-	void PrintText() const override;
+	void PrintText(Print& dev) const override;
 
 public:
 	FloatField(PixelNumber py, PixelNumber px, PixelNumber pw, TextAlignment pa, uint8_t pd, const char * array pl = NULL, const char * array null pu = NULL)
-		: FieldWithText(py, px, pw, pa), label(pl), units(pu), val(0.0), numDecimals(pd)
+		: NumericField(py, px, pw, pa), label(pl), units(pu), val(0.0), numDecimals(pd)
 	{
 	}
 
 	void SetValue(float v)
 	{
 		val = v;
-		changed = true;
+		SetValueChanged();
 	}
+
+	float GetValue() const { return val; }
 };
 
-class IntegerField : public FieldWithText
+class IntegerField : public NumericField
 {
 	const char* array null label;
 	const char* array null units;
 	int val;
 
 protected:
-	void PrintText() const override;
+	void PrintText(Print& dev) const override;
 
 public:
 	IntegerField(PixelNumber py, PixelNumber px, PixelNumber pw, TextAlignment pa, const char *pl = NULL, const char *pu = NULL)
-		: FieldWithText(py, px, pw, pa), label(pl), units(pu), val(0)
+		: NumericField(py, px, pw, pa), label(pl), units(pu), val(0)
 	{
 	}
 
 	void SetValue(int v)
 	{
 		val = v;
-		changed = true;
+		SetValueChanged();
 	}
 };
 
@@ -261,7 +436,7 @@ class StaticTextField : public FieldWithText
 	const char * array null text;
 
 protected:
-	void PrintText() const override;
+	void PrintText(Print& dev) const override;
 
 public:
 	StaticTextField(PixelNumber py, PixelNumber px, PixelNumber pw, TextAlignment pa, const char * array null pt)
@@ -270,30 +445,31 @@ public:
 	void SetValue(const char* array null pt)
 	{
 		text = pt;
-		changed = true;
+		SetValueChanged();
 	}
 };
 
 class ButtonBase : public DisplayField
 {
 protected:
-	Colour borderColour, gradColour, pressedBackColour, pressedGradColour;
 	event_t evt;								// event number that is triggered by touching this field
 	bool pressed;								// putting this here instead of in SingleButton saves 4 byes per button
 
 	
 	ButtonBase(PixelNumber py, PixelNumber px, PixelNumber pw);
 
-	void DrawOutline(PixelNumber xOffset, PixelNumber yOffset, bool isPressed) const;
+	void DrawOutline(PixelNumber xOffset, PixelNumber yOffset, PixelNumber pw, bool isPressed) const;
 	
 	static PixelNumber textMargin;
 	static PixelNumber iconMargin;
 
 public:
+	bool IsButton() const override final { return true; }
 	event_t GetEvent() const override { return evt; }
 	virtual const char* null GetSParam(unsigned int index) const { return nullptr; }
 	virtual int GetIParam(unsigned int index) const { return 0; }
 	virtual void Press(bool p, int index) { }
+	virtual unsigned int GetIndexAt(PixelNumber px, PixelNumber py) const { return 0; }	// get the index of the button nearest to a touch at window coordinates px, py
 };
 
 class SingleButton : public ButtonBase
@@ -311,8 +487,6 @@ protected:
 	void DrawOutline(PixelNumber xOffset, PixelNumber yOffset) const;
 	
 public:
-	bool IsButton() const override final { return true; }
-
 	void SetEvent(event_t e, const char* null sp ) { evt = e; param.sParam = sp; }
 	void SetEvent(event_t e, int ip ) { evt = e; param.iParam = ip; }
 	//void SetEvent(event_t e, float fp ) { evt = e; param.fParam = fp; }
@@ -326,7 +500,7 @@ public:
 		if (p != pressed)
 		{
 			pressed = p;
-			changed = true;
+			SetChanged(RefreshPriority::pressed);
 		}
 	}
 	
@@ -341,7 +515,7 @@ class ButtonWithText : public SingleButton
 protected:
 	PixelNumber GetHeight() const override { return UTFT::GetFontHeight(font) + 2 * textMargin + 2; }
 
-	virtual void PrintText() const {}		// ideally would be pure virtual
+	virtual void PrintText(Print& dev) const {}		// ideally would be pure virtual
 
 public:
 	ButtonWithText(PixelNumber py, PixelNumber px, PixelNumber pw)
@@ -350,61 +524,101 @@ public:
 	void Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset) override final;
 	
 	static void SetFont(LcdFont f) { font = f; }
+	static LcdFont GetFont() { return font; }
 };
 
 // Character button. The character on the button is the same as the integer event parameter.
 class CharButton : public ButtonWithText
 {
 protected:
-	void PrintText() const override;
+	void PrintText(Print& dev) const override;
 
 public:
 	CharButton(PixelNumber py, PixelNumber px, PixelNumber pw, char pc, event_t e);
 };
 
-#if 0	// not used yet
+// A row of equally-spaced buttons that share one field, one event and one set of colours. The text and parameter of each button are
+// held in arrays in flash memory, so a row uses much less RAM than the same number of separate buttons. The index in the ButtonPress says
+// which button in the row was touched.
 class ButtonRow : public ButtonBase
 {
 protected:
-	unsigned int numButtons;
-	int whichPressed;
-	PixelNumber step;
-	
-public:
+	PixelNumber step;							// distance between the left edges of adjacent buttons
+	PixelNumber buttonWidth;
+	uint8_t numButtons;
+	int8_t whichPressed;						// the button that is shown as pressed, or -1 if none is
+	int8_t drawnPressed;						// the button that was shown as pressed when we last drew the row
+
 	ButtonRow(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ps, unsigned int nb, event_t e);
+
+	virtual void DrawButton(unsigned int n, PixelNumber xOffset, PixelNumber yOffset) const { }	// ideally would be pure virtual
+
+public:
+	void Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset) override final;
+	void Press(bool p, int index) override;
+	unsigned int GetIndexAt(PixelNumber px, PixelNumber py) const override;
 };
 
 class ButtonRowWithText : public ButtonRow
 {
-	LcdFont font;
-
 protected:
-	virtual void PrintText(unsigned int n) const { }
+	PixelNumber GetHeight() const override { return UTFT::GetFontHeight(ButtonWithText::GetFont()) + 2 * textMargin + 2; }
 
-public:
-	ButtonRowWithText(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ps, unsigned int nb, event_t e);
+	virtual void PrintText(Print& dev, unsigned int n) const { }		// ideally would be pure virtual
+	void DrawButton(unsigned int n, PixelNumber xOffset, PixelNumber yOffset) const override;
 
-	void Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset) override final;
+public:
+	ButtonRowWithText(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ps, unsigned int nb, event_t e)
+		: ButtonRow(py, px, pw, ps, nb, e) {}
 };
 
+// Row of character buttons. The character on each button is also its integer parameter.
 class CharButtonRow : public ButtonRowWithText
 {
 	const char * array text;
 
 protected:
-	void PrintText(unsigned int n) const override;
+	void PrintText(Print& dev, unsigned int n) const override;
 
 public:
 	CharButtonRow(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ps, const char * array s, event_t e);
+
+	void SetText(const char * array s) pre(strlen(s) == numButtons)
+	{
+		text = s;
+		SetChanged();
+	}
+
+	int GetIParam(unsigned int index) const override { return text[index]; }
+};
+
+// Row of text buttons with either string or integer parameters
+class TextButtonRow : public ButtonRowWithText
+{
+	const char * array const * array text;
+	union
+	{
+		const char * array const * array sParams;
+		const int * array iParams;
+	} params;
+
+protected:
+	void PrintText(Print& dev, unsigned int n) const override;
+
+public:
+	TextButtonRow(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ps, unsigned int nb, const char * array const pt[], event_t e, const char * array const pp[]);
+	TextButtonRow(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ps, unsigned int nb, const char * array const pt[], event_t e, const int pp[]);
+
+	const char* null GetSParam(unsigned int index) const override { return params.sParams[index]; }
+	int GetIParam(unsigned int index) const override { return params.iParams[index]; }
 };
-#endif
 
 class TextButton : public ButtonWithText
 {
 	const char * array null text;
 	
 protected:
-	void PrintText() const override;
+	void PrintText(Print& dev) const override;
 
 public:
 	TextButton(PixelNumber py, PixelNumber px, PixelNumber pw, const char * array null pt, event_t e, int param = 0);
@@ -413,7 +627,7 @@ public:
 	void SetText(const char* array null pt)
 	{
 		text = pt;
-		changed = true;
+		SetChanged();
 	}
 };
 
@@ -438,7 +652,7 @@ class IntegerButton : public ButtonWithText
 	int val;
 
 protected:
-	void PrintText() const override;
+	void PrintText(Print& dev) const override;
 
 public:
 	IntegerButton(PixelNumber py, PixelNumber px, PixelNumber pw, const char * array pl = nullptr, const char * array pt = nullptr)
@@ -448,14 +662,17 @@ public:
 
 	void SetValue(int pv)
 	{
-		val = pv;
-		changed = true;
+		if (pv != val)
+		{
+			val = pv;
+			SetChanged((pressed) ? RefreshPriority::adjusting : RefreshPriority::normal);
+		}
 	}
 
 	void Increment(int amount)
 	{
 		val += amount;
-		changed = true;
+		SetChanged((pressed) ? RefreshPriority::adjusting : RefreshPriority::normal);
 	}
 };
 
@@ -466,7 +683,7 @@ class FloatButton : public ButtonWithText
 	uint8_t numDecimals;
 
 protected:
-	void PrintText() const override;
+	void PrintText(Print& dev) const override;
 
 public:
 	FloatButton(PixelNumber py, PixelNumber px, PixelNumber pw, uint8_t pd, const char * array pt = nullptr)
@@ -476,14 +693,17 @@ public:
 
 	void SetValue(float pv)
 	{
-		val = pv;
-		changed = true;
+		if (pv != val)
+		{
+			val = pv;
+			SetChanged((pressed) ? RefreshPriority::adjusting : RefreshPriority::normal);
+		}
 	}
 
 	void Increment(int amount)
 	{
 		val += amount;
-		changed = true;
+		SetChanged((pressed) ? RefreshPriority::adjusting : RefreshPriority::normal);
 	}
 };
 
@@ -505,8 +725,132 @@ public:
 	void SetPercent(uint8_t pc)
 	{
 		percent = pc;
-		changed = true;
+		SetChanged();
 	}
 };
 
+// Field that plots the recent history of a number of values as a strip chart, with a legend underneath. Each series has a value, drawn as a solid line,
+// and optionally a target for that value, drawn as a dotted line. The samples are kept in a ring buffer of 8-bit values supplied by the caller.
+// Each new sample is drawn in the next column along, overwriting the oldest one, so that adding a sample costs the same however wide the chart is.
+class ChartField : public DisplayField
+{
+public:
+	ChartField(PixelNumber py, PixelNumber px, PixelNumber ph, unsigned int ns, PixelNumber pps, unsigned int nSeries, uint8_t * array buf,
+				const Colour * array colours, const char * array const * array names, uint16_t fullScale, uint16_t gridInterval)
+		pre(ns >= 2; nSeries <= 16; buf.lim >= ns * nSeries * 2; colours.lim >= nSeries; names.lim >= nSeries; gridInterval != 0);
+
+	void Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset) override;
+
+	PixelNumber GetHeight() const override { return height; }
+
+	// Set the value and the target of a series for the sample that is being collected. Series that are not set have no data in that sample.
+	void SetValue(unsigned int series, float val) pre(series < numSeries);
+	void SetTarget(unsigned int series, float target) pre(series < numSeries);
+
+	// Finish collecting the current sample and start a new one
+	void AddSample();
+
+	// Get the window y coordinate at which a value is plotted
+	PixelNumber GetYpos(float val) const { return SampleY(ToSample(val)); }
+
+private:
+	static const uint8_t NoSample = 0;			// sample value meaning that we have no data
+
+	uint8_t ToSample(float val) const;
+	PixelNumber SampleY(uint8_t sample) const { return y + PlotHeight() - 1 - ((sample - 1) * (PlotHeight() - 1))/254; }
+	PixelNumber PlotHeight() const { return height - UTFT::GetFontHeight(font) - UTFT::GetFontHeight(font)/4; }
+	uint8_t * array GetSample(unsigned int n) const { return samples + n * numSeries * 2; }
+	void DrawGrid(PixelNumber xmin, PixelNumber xmax, PixelNumber yOffset) const;
+	void DrawSample(unsigned int n, bool join, PixelNumber xOffset, PixelNumber yOffset) const;
+	void RedrawSample(unsigned int n, bool join, PixelNumber xOffset, PixelNumber yOffset) const;
+	void DrawGap(PixelNumber xOffset, PixelNumber yOffset) const;
+
+	LcdFont font;
+	uint8_t * array samples;					// numSamples entries, each holding the value and then the target of each series
+	const Colour * array seriesColours;
+	const char * array const * array seriesNames;
+	PixelNumber height;
+	uint16_t numSamples;
+	uint16_t nextSample;						// the entry that the sample we are collecting goes in. It is shown as a gap on the chart.
+	uint16_t numUndrawn;						// how many samples have been added since we last drew the chart
+	uint16_t seriesUsed;						// bitmap of the series that have had any values, so that we only show those in the legend
+	uint16_t fullScale;							// the value plotted at the top of the chart
+	uint16_t gridInterval;						// the interval between horizontal grid lines
+	uint8_t numSeries;
+	uint8_t pixelsPerSample;
+};
+
+// Scrolling list of text items laid out in rows of one or more columns, e.g. a list of filenames. The caller keeps the items in an array of strings
+// and the list only draws the rows that are visible, so it needs no RAM per item. The list scrolls by single pixels, either when told to or when it is
+// dragged, and it keeps moving for a while after a drag. Where the display controller can scroll in hardware, scrolling the list only draws the rows
+// that come into view. The index in a ButtonPress is the index of the item that was touched.
+class ListField : public ButtonBase
+{
+public:
+	ListField(PixelNumber py, PixelNumber px, PixelNumber pw, PixelNumber ph, unsigned int nc, PixelNumber columnSpacing, PixelNumber prs, event_t e)
+		pre(nc != 0);
+
+	void Refresh(bool full, PixelNumber xOffset, PixelNumber yOffset) override;
+	PixelNumber GetHeight() const override { return height; }
+
+	void SetEvent(event_t e) { evt = e; }
+	void SetItems(const char * array const * array null pi, unsigned int ni);	// change the items, keeping the scroll position if possible
+	bool ScrollTo(int pos);							// scroll so that pixel row 'pos' of the list is at the top, returning false if we had to limit it
+	void ScrollRows(int numRows) { ScrollTo(scrollPos + numRows * (int)RowStep()); }
+	bool CanScroll() const { return MaxScrollPos() != 0; }
+
+	// Touch handling. Call StartDrag when the list is touched and Drag with each new position of the touch. When the touch ends, EndDrag returns true
+	// if it was a tap on an item rather than a drag. Call Animate regularly to keep the list moving after a drag.
+	void StartDrag(PixelNumber py, uint32_t now);
+	void Drag(PixelNumber py, uint32_t now);
+	bool EndDrag(uint32_t now);
+	void Animate(uint32_t now);
+
+	const char* null GetSParam(unsigned int index) const override { return (index < numItems) ? items[index] : nullptr; }
+	void Press(bool p, int index) override;
+	unsigned int GetIndexAt(PixelNumber px, PixelNumber py) const override;
+
+	// Stop any hardware scrolling, because something other than the list is about to be drawn over it. The list is redrawn in the normal way
+	// unless it belongs to window 'redrawing' or a popup on top of it, which are about to be removed or redrawn anyway.
+	static void StopHardwareScroll(const Window * null redrawing);
+
+	// Stop any hardware scrolling if display rows ymin to ymax overlap the scrolling area, because field 'f' (or something else if it is null)
+	// is about to be drawn there. The scrolling area is whole panel lines, so this includes fields beside the list as well as over it.
+	static void StopHardwareScroll(const DisplayField * null f, PixelNumber ymin, PixelNumber ymax, const Window * null redrawing);
+
+private:
+	PixelNumber RowHeight() const { return UTFT::GetFontHeight(ButtonWithText::GetFont()) + 2 * textMargin + 2; }
+	PixelNumber RowStep() const { return RowHeight() + rowSpacing; }
+	int MaxScrollPos() const;
+	void ClearHardwareScroll();
+	void ScrollDisplay(PixelNumber xOffset, PixelNumber yOffset);
+	void DrawContent(int start, int end, PixelNumber xOffset, PixelNumber yOffset) const;
+	void DrawLines(int start, int end, int ypos, PixelNumber xOffset) const;
+	void DrawCell(unsigned int n, int xpos, int ypos, int clipTop, int clipBottom) const;
+	void RedrawItem(int n, PixelNumber xOffset, PixelNumber yOffset) const;
+
+	const char * array const * array null items;
+	PixelNumber height;
+	PixelNumber columnStep;						// distance between the left edges of adjacent columns
+	PixelNumber cellWidth;
+	PixelNumber rowSpacing;
+	uint16_t numItems;
+	uint8_t numColumns;
+	int16_t pressedItem;						// the item that is shown as pressed, or -1 if none is
+	int16_t drawnPressed;						// the item that was shown as pressed when we last drew the list
+	int scrollPos;								// the pixel row of the list that we want at the top of the field
+	int drawnPos;								// the pixel row of the list that is at the top of the field on the display
+	int ringBase;								// when scrolling in hardware, the pixel row of the list that is held in the first display row of the field
+
+	// Touch handling
+	int dragStartPos;
+	PixelNumber dragStartY, lastDragY;
+	bool isTap;									// true if the current touch hasn't moved far enough to be a drag
+	uint32_t lastMoveTime;
+	int32_t velocity;							// scrolling speed in pixels per second
+	int32_t moveRemainder;						// fraction of a pixel of movement not yet applied, in thousandths of a pixel
+
+	static ListField * null scrollingList;		// the list that is using hardware scrolling, if any
+};
+
 #endif /* DISPLAY_H_ */
\ No newline at end of file
@@ -22,7 +22,8 @@ ProgressBar *printProgressBar;
 SingleButton *tabControl, *tabPrint, *tabFiles, *tabMsg, *tabSetup;
 SingleButton *moveButton, *extrudeButton, *macroButton;
 
-TextButton *filenameButtons[numDisplayedFiles], *languageButton, *coloursButton;
+TextButton *languageButton, *coloursButton;
+ListField *filenameList;
 SingleButton *scrollFilesLeftButton, *scrollFilesRightButton, *filesUpButton, *changeCardButton;
 SingleButton *homeButtons[MAX_AXES], *homeAllButton, *bedCompButton;
 SingleButton *heaterStates[maxHeaters];
@@ -39,7 +40,8 @@ ButtonPress fieldBeingAdjusted;
 ButtonPress currentButton;
 PopupWindow *setTempPopup, *movePopup, *extrudePopup, *fileListPopup, *filePopup, *baudPopup, *volumePopup, *areYouSurePopup, *keyboardPopup, *languagePopup, *coloursPopup, *brightnessPopup;
 TextField *zProbe, *fpNameField, *fpGeneratedByField, *userCommandField;
-PopupWindow *alertPopup;
+PopupWindow *alertPopup, *temperatureChartPopup;
+ChartField *temperatureChart;
 StaticTextField *moveAxisRows[MAX_AXES];
 
 String<machineNameLength> machineName;
@@ -54,23 +56,71 @@ extern const char* const longLanguageNames[] = { "Keyboard EN", "Tastatur DE", "
 static_assert(sizeof(longLanguageNames)/sizeof(longLanguageNames[0]) == numLanguages, "Wrong number of long languages");
 
 const char* array settingsNotSavedText = "Some settings are not saved!";
-const char*array  restartNeededText = "Touch Save & Restart to use new colour scheme";
 const char* array const axisNames[] = { "X", "Y", "Z", "U", "V", "W" };
 
+// Keyboard layouts. The rows of each layout must have the same number of keys in every language, so that we can change the language in place.
+const size_t numKeyboardRows = 4;
+static const char* array const keysGB[numKeyboardRows] = { "1234567890-+", "QWERTYUIOP", "ASDFGHJKL:", "ZXCVBNM./" };
+static const char* array const keysDE[numKeyboardRows] = { "1234567890-+", "QWERTZUIOP", "ASDFGHJKL:", "YXCVBNM./" };
+static const char* array const keysFR[numKeyboardRows] = { "1234567890-+", "AZERTWUIOP", "QSDFGHJKLM", "YXCVBN.:/" };
+static const char* array const * const keyboards[numLanguages] = { keysGB, keysDE, keysFR };
+static CharButtonRow *keyboardRows[numKeyboardRows];
+
 
 #if DISPLAY_X == 800
 const Icon heaterIcons[maxHeaters] = { IconBed, IconNozzle1, IconNozzle2, IconNozzle3, IconNozzle4, IconNozzle5, IconNozzle6 };
+static const char* array const heaterNames[maxHeaters] = { "Bed", "1", "2", "3", "4", "5", "6" };
 #else
 const Icon heaterIcons[maxHeaters] = { IconBed, IconNozzle1, IconNozzle2, IconNozzle3, IconNozzle4 };
+static const char* array const heaterNames[maxHeaters] = { "Bed", "1", "2", "3", "4" };
 #endif
 
+// Temperature chart. The line colours are the same in all colour schemes, so they must show up on both light and dark backgrounds.
+static const Colour heaterColours[] =
+{
+	UTFT::fromRGB(255, 0, 0), UTFT::fromRGB(0, 128, 255), UTFT::fromRGB(0, 160, 0), UTFT::fromRGB(192, 0, 192),
+	UTFT::fromRGB(255, 128, 0), UTFT::fromRGB(0, 160, 160), UTFT::fromRGB(160, 128, 0)
+};
+static_assert(sizeof(heaterColours)/sizeof(heaterColours[0]) >= maxHeaters, "Not enough heater colours");
+static const char* array const chartLabels[] = { "0", "100", "200", "300" };
+static_assert(sizeof(chartLabels)/sizeof(chartLabels[0]) == chartFullScale/chartLabelInterval + 1, "Wrong number of chart labels");
+static uint8_t temperatureHistory[chartSamples * maxHeaters * 2];		// the value and target of each heater in each sample
+
+// The colours of each display style, as roles in the colour scheme. These must be in the same order as the Style enumeration.
+static const DisplayStyle displayStyles[] =
+{
+	{ COLOUR_ROLE(labelTextColour), COLOUR_ROLE(defaultBackColour) },				// styleLabel
+	{ COLOUR_ROLE(infoTextColour), COLOUR_ROLE(defaultBackColour) },				// styleInfo
+	{ COLOUR_ROLE(infoTextColour), COLOUR_ROLE(infoBackColour) },					// styleInfoBox
+	{ COLOUR_ROLE(errorTextColour), COLOUR_ROLE(errorBackColour) },					// styleError
+	{ COLOUR_ROLE(titleBarTextColour), COLOUR_ROLE(titleBarBackColour) },			// styleTitleBar
+	{ COLOUR_ROLE(progressBarColour), COLOUR_ROLE(progressBarBackColour) },			// styleProgressBar
+	{ COLOUR_ROLE(buttonTextColour), COLOUR_ROLE(buttonBackColour) },				// styleButton
+	{ COLOUR_ROLE(buttonTextColour), COLOUR_ROLE(homedButtonBackColour) },			// styleHomedButton
+	{ COLOUR_ROLE(buttonTextColour), COLOUR_ROLE(notHomedButtonBackColour) },		// styleNotHomedButton
+	{ COLOUR_ROLE(buttonTextColour), COLOUR_ROLE(pauseButtonBackColour) },			// stylePauseButton
+	{ COLOUR_ROLE(buttonTextColour), COLOUR_ROLE(resumeButtonBackColour) },			// styleResumeButton
+	{ COLOUR_ROLE(buttonTextColour), COLOUR_ROLE(resetButtonBackColour) },			// styleResetButton
+	{ COLOUR_ROLE(infoTextColour), COLOUR_ROLE(activeBackColour) },					// styleHeaterActive
+	{ COLOUR_ROLE(infoTextColour), COLOUR_ROLE(standbyBackColour) },				// styleHeaterStandby
+	{ COLOUR_ROLE(infoTextColour), COLOUR_ROLE(tuningBackColour) },					// styleHeaterTuning
+	{ COLOUR_ROLE(popupTextColour), COLOUR_ROLE(popupBackColour) },					// stylePopupText
+	{ COLOUR_ROLE(popupButtonTextColour), COLOUR_ROLE(popupBackColour) },			// stylePopupButtonText
+	{ COLOUR_ROLE(popupInfoTextColour), COLOUR_ROLE(popupBackColour) },				// stylePopupInfoText
+	{ COLOUR_ROLE(popupButtonTextColour), COLOUR_ROLE(popupButtonBackColour) },		// stylePopupButton
+	{ COLOUR_ROLE(popupInfoTextColour), COLOUR_ROLE(popupInfoBackColour) },			// stylePopupInfo
+	{ COLOUR_ROLE(alertPopupTextColour), COLOUR_ROLE(alertPopupBackColour) },		// styleAlert
+	{ COLOUR_ROLE(chartGridColour), COLOUR_ROLE(popupInfoBackColour) }				// styleChart
+};
+static_assert(sizeof(displayStyles)/sizeof(displayStyles[0]) == numStyles, "Wrong number of display styles");
+
 namespace Fields
 {
 	// Create a standard popup window with a title and a close button at the top right
-	PopupWindow *CreatePopupWindow(PixelNumber ph, PixelNumber pw, Colour pb, Colour pBorder, Colour textColour, const char * null title, PixelNumber topMargin = popupTopMargin)
+	PopupWindow *CreatePopupWindow(PixelNumber ph, PixelNumber pw, Colour pb, Colour pBorder, Style textStyle, const char * null title, PixelNumber topMargin = popupTopMargin)
 	{
 		PopupWindow *window = new PopupWindow(ph, pw, pb, pBorder);
-		DisplayField::SetDefaultColours(textColour, pb);
+		DisplayField::SetDefaultStyle(textStyle);
 		if (title != nullptr)
 		{
 			window->AddField(new StaticTextField(topMargin + labelRowAdjust, popupSideMargin + closeButtonWidth + popupFieldSpacing, pw - 2 * (popupSideMargin + closeButtonWidth + popupFieldSpacing), TextAlignment::Centre, title));
@@ -111,49 +161,29 @@ namespace Fields
 		return f;
 	}
 
-	// Create a row of test buttons.
+	// Create a row of text buttons. The text and parameter arrays must be static because the row refers to them.
 	// Optionally, set one to 'pressed' and return that one.
 	ButtonPress CreateStringButtonRow(Window * pf, PixelNumber top, PixelNumber left, PixelNumber totalWidth, PixelNumber spacing, unsigned int numButtons,
 								const char* array const text[], const char* array const params[], Event evt, int selected = -1)
 	{
 		const PixelNumber step = (totalWidth + spacing)/numButtons;
-		ButtonPress bp;
-		for (unsigned int i = 0; i < numButtons; ++i)
-		{
-			TextButton *tp = new TextButton(top, left + i * step, step - spacing, text[i], evt, params[i]);
-			pf->AddField(tp);
-			if ((int)i == selected)
-			{
-				tp->Press(true, 0);
-				bp = ButtonPress(tp, 0);
-			}
-		}
-		return bp;
-	}
-
-	// Create a popup bar with string parameters
-	PopupWindow *CreateStringPopupBar(const ColourScheme& colours, PixelNumber width, unsigned int numEntries, const char* const text[], const char* const params[], Event ev)
-	{
-		PopupWindow *pf = new PopupWindow(popupBarHeight, width, colours.popupBackColour, colours.popupBorderColour);
-		DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
-		PixelNumber step = (width - 2 * popupSideMargin + popupFieldSpacing)/numEntries;
-		for (unsigned int i = 0; i < numEntries; ++i)
+		TextButtonRow *row = new TextButtonRow(top, left, step - spacing, step, numButtons, text, evt, params);
+		pf->AddField(row);
+		if (selected >= 0)
 		{
-			pf->AddField(new TextButton(popupTopMargin, popupSideMargin + i * step, step - popupFieldSpacing, text[i], ev, params[i]));
+			row->Press(true, selected);
+			return ButtonPress(row, selected);
 		}
-		return pf;
+		return ButtonPress();
 	}
 
-	// Create a popup bar with integer parameters
-	PopupWindow *CreateIntPopupBar(const ColourScheme& colours, PixelNumber width, unsigned int numEntries, const char* const text[], const int params[], Event ev, Event zeroEv)
+	// Create a popup bar with integer parameters. The text and parameter arrays must be static because the bar refers to them.
+	PopupWindow *CreateIntPopupBar(const ColourScheme& colours, PixelNumber width, unsigned int numEntries, const char* const text[], const int params[], Event ev)
 	{
 		PopupWindow *pf = new PopupWindow(popupBarHeight, width, colours.popupBackColour, colours.popupBorderColour);
-		DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
+		DisplayField::SetDefaultStyle(stylePopupButton);
 		PixelNumber step = (width - 2 * popupSideMargin + popupFieldSpacing)/numEntries;
-		for (unsigned int i = 0; i < numEntries; ++i)
-		{
-			pf->AddField(new TextButton(popupSideMargin, popupSideMargin + i * step, step - popupFieldSpacing, text[i], (params[i] == 0) ? zeroEv : ev, params[i]));
-		}
+		pf->AddField(new TextButtonRow(popupSideMargin, popupSideMargin, step - popupFieldSpacing, step, numEntries, text, ev, params));
 		return pf;
 	}
 
@@ -161,11 +191,14 @@ namespace Fields
 	void CreateTemperatureGrid(const ColourScheme& colours)
 	{
 		// Add the labels
-		DisplayField::SetDefaultColours(colours.labelTextColour, colours.defaultBackColour);
+		DisplayField::SetDefaultStyle(styleLabel);
 		mgr.AddField(debugField = new StaticTextField(row2 + labelRowAdjust, margin, bedColumn - fieldSpacing - margin, TextAlignment::Left, "debug"));
-		mgr.AddField(new StaticTextField(row3 + labelRowAdjust, margin, bedColumn - fieldSpacing - margin, TextAlignment::Right, "Current" THIN_SPACE DEGREE_SYMBOL "C"));
 		mgr.AddField(new StaticTextField(row4 + labelRowAdjust, margin, bedColumn - fieldSpacing - margin, TextAlignment::Right, "Active" THIN_SPACE DEGREE_SYMBOL "C"));
 		mgr.AddField(new StaticTextField(row5 + labelRowAdjust, margin, bedColumn - fieldSpacing - margin, TextAlignment::Right, "Standby" THIN_SPACE DEGREE_SYMBOL "C"));
+
+		// The label for the current temperatures is a button that shows their history
+		DisplayField::SetDefaultStyle(styleButton);
+		mgr.AddField(new TextButton(row3, margin, bedColumn - fieldSpacing - margin, "Current" THIN_SPACE DEGREE_SYMBOL "C", evTemperatureChart));
 	
 		// Add the grid
 		for (unsigned int i = 0; i < maxHeaters; ++i)
@@ -177,14 +210,14 @@ namespace Fields
 			mgr.AddField(b);
 		
 			// Add the current temperature field
-			DisplayField::SetDefaultColours(colours.infoTextColour, colours.defaultBackColour);
+			DisplayField::SetDefaultStyle(styleInfo);
 			FloatField *f = new FloatField(row3 + labelRowAdjust, column, tempButtonWidth, TextAlignment::Centre, 1);
 			f->SetValue(0.0);
 			currentTemps[i] = f;
 			mgr.AddField(f);
 		
 			// Add the active temperature button
-			DisplayField::SetDefaultColours(colours.buttonTextColour, colours.buttonBackColour);
+			DisplayField::SetDefaultStyle(styleButton);
 			IntegerButton *ib = new IntegerButton(row4, column, tempButtonWidth);
 			ib->SetEvent(evAdjustActiveTemp, i);
 			ib->SetValue(0);
@@ -205,7 +238,7 @@ namespace Fields
 	{
 		mgr.SetRoot(commonRoot);
 
-		DisplayField::SetDefaultColours(colours.infoTextColour, colours.infoBackColour);
+		DisplayField::SetDefaultStyle(styleInfoBox);
 		PixelNumber column = margin;
 		PixelNumber xyFieldWidth = (DISPLAY_X - (2 * margin) - (MAX_AXES * fieldSpacing))/(MAX_AXES + 1);
 		for (size_t i = 0; i < MAX_AXES; ++i)
@@ -220,7 +253,7 @@ namespace Fields
 		zprobeBuf[0] = 0;
 		mgr.AddField(zProbe = new TextField(row6p3 + labelRowAdjust, column, DISPLAY_X - column - margin, TextAlignment::Left, "Pr", zprobeBuf.c_str()));
 
-		DisplayField::SetDefaultColours(colours.buttonTextColour, colours.notHomedButtonBackColour);
+		DisplayField::SetDefaultStyle(styleNotHomedButton);
 		homeAllButton = AddIconButton(row7p7, 0, MAX_AXES + 2, IconHomeAll, evSendCommand, "G28");
 		homeButtons[0] = AddIconButton(row7p7, 1, MAX_AXES + 2, IconHomeX, evSendCommand, "G28 X0");
 		homeButtons[1] = AddIconButton(row7p7, 2, MAX_AXES + 2, IconHomeY, evSendCommand, "G28 Y0");
@@ -237,7 +270,7 @@ namespace Fields
 		homeButtons[5] = AddIconButton(row7p7, 6, MAX_AXES + 2, IconHomeW, evSendCommand, "G28 U0");
 		homeButtons[5]->Show(false);
 #endif
-		DisplayField::SetDefaultColours(colours.buttonTextColour, colours.buttonBackColour);
+		DisplayField::SetDefaultStyle(styleButton);
 		bedCompButton = AddIconButton(row7p7, MAX_AXES + 1, MAX_AXES + 2, IconBedComp, evSendCommand, "G32");
 
 		filesButton = AddIconButton(row8p7, 0, 4, IconFiles, evListFiles, nullptr);
@@ -254,13 +287,13 @@ namespace Fields
 		mgr.SetRoot(commonRoot);
 			
 		// Labels
-		DisplayField::SetDefaultColours(colours.labelTextColour, colours.defaultBackColour);
+		DisplayField::SetDefaultStyle(styleLabel);
 		mgr.AddField(new StaticTextField(row6 + labelRowAdjust, margin, bedColumn - fieldSpacing, TextAlignment::Right, "Extruder" THIN_SPACE "%"));
 		//		mgr.AddField(new StaticTextField(row7 + labelRowAdjust, margin, bedColumn - fieldSpacing, TextAlignment::Right, "% speed"));
 		//		mgr.AddField(new StaticTextField(row7 + labelRowAdjust, ((tempButtonWidth + fieldSpacing) * 1) + bedColumn, tempButtonWidth, TextAlignment::Right, "fan"));
 			
 		// Extrusion factor buttons
-		DisplayField::SetDefaultColours(colours.buttonTextColour, colours.buttonBackColour);
+		DisplayField::SetDefaultStyle(styleButton);
 		for (unsigned int i = 1; i < maxHeaters; ++i)
 		{
 			PixelNumber column = ((tempButtonWidth + fieldSpacing) * i) + bedColumn;
@@ -281,26 +314,26 @@ namespace Fields
 		mgr.AddField(fanSpeed = new IntegerButton(row7, fanColumn, pauseColumn - fanColumn - fieldSpacing, "Fan ", "%"));
 		fanSpeed->SetEvent(evAdjustFan, 0);
 			
-		DisplayField::SetDefaultColours(colours.buttonTextColour, colours.pauseButtonBackColour);
+		DisplayField::SetDefaultStyle(stylePauseButton);
 		pauseButton = new TextButton(row7, pauseColumn, DisplayX - pauseColumn - margin, "Pause print", evPausePrint, "M25");
 		mgr.AddField(pauseButton);
 
-		DisplayField::SetDefaultColours(colours.buttonTextColour, colours.resumeButtonBackColour);
+		DisplayField::SetDefaultStyle(styleResumeButton);
 		resumeButton = new TextButton(row7, resumeColumn, cancelColumn - resumeColumn - fieldSpacing, "Resume", evResumePrint, "M24");
 		mgr.AddField(resumeButton);
 
-		DisplayField::SetDefaultColours(colours.buttonTextColour, colours.resetButtonBackColour);
+		DisplayField::SetDefaultStyle(styleResetButton);
 		resetButton = new TextButton(row7, cancelColumn, DisplayX - cancelColumn - margin, "Cancel", evReset, "M0");
 		mgr.AddField(resetButton);
 
-//		DisplayField::SetDefaultColours(labelTextColour, defaultBackColour);
+//		DisplayField::SetDefaultStyle(styleLabel);
 //		mgr.AddField(printingField = new TextField(row8, margin, DisplayX, TextAlignment::Left, "printing ", printingFile.c_str()));
 			
-		DisplayField::SetDefaultColours(colours.progressBarColour,colours. progressBarBackColour);
+		DisplayField::SetDefaultStyle(styleProgressBar);
 		mgr.AddField(printProgressBar = new ProgressBar(row8 + (rowHeight - progressBarHeight)/2, margin, progressBarHeight, DisplayX - 2 * margin));
 		mgr.Show(printProgressBar, false);
 			
-		DisplayField::SetDefaultColours(colours.labelTextColour, colours.defaultBackColour);
+		DisplayField::SetDefaultStyle(styleLabel);
 		mgr.AddField(timeLeftField = new TextField(row9, margin, DisplayX - 2 * margin, TextAlignment::Left, "time left: "));
 		mgr.Show(timeLeftField, false);
 
@@ -311,9 +344,9 @@ namespace Fields
 	void CreateMessageTabFields(const ColourScheme& colours)
 	{
 		mgr.SetRoot(baseRoot);
-		DisplayField::SetDefaultColours(colours.buttonTextColour, colours.buttonBackColour);
+		DisplayField::SetDefaultStyle(styleButton);
 		mgr.AddField(new IconButton(margin,  DisplayX - margin - keyboardButtonWidth, keyboardButtonWidth, IconKeyboard, evKeyboard));
-		DisplayField::SetDefaultColours(colours.labelTextColour, colours.defaultBackColour);
+		DisplayField::SetDefaultStyle(styleLabel);
 		mgr.AddField(new StaticTextField(margin + labelRowAdjust, margin, DisplayX - 2 * margin - keyboardButtonWidth, TextAlignment::Centre, "Messages"));
 		PixelNumber row = firstMessageRow;
 		for (unsigned int r = 0; r < numMessageRows; ++r)
@@ -333,18 +366,18 @@ namespace Fields
 	void CreateSetupTabFields(uint32_t language, const ColourScheme& colours)
 	{
 		mgr.SetRoot(baseRoot);
-		DisplayField::SetDefaultColours(colours.labelTextColour, colours.defaultBackColour);
+		DisplayField::SetDefaultStyle(styleLabel);
 		// The firmware version field doubles up as an area for displaying debug messages, so make it the full width of the display
 		mgr.AddField(fwVersionField = new StaticTextField(row1, margin, DisplayX, TextAlignment::Left, "Panel Due firmware version " VERSION_TEXT));
 		mgr.AddField(freeMem = new IntegerField(row2, margin, DisplayX/2 - margin, TextAlignment::Left, "Free RAM: "));
 		mgr.AddField(touchX = new IntegerField(row2, DisplayX/2, DisplayX/4, TextAlignment::Left, "Touch: ", ","));
 		mgr.AddField(touchY = new IntegerField(row2, (DisplayX * 3)/4, DisplayX/4, TextAlignment::Left));
 			
-		DisplayField::SetDefaultColours(colours.errorTextColour, colours.errorBackColour);
+		DisplayField::SetDefaultStyle(styleError);
 		mgr.AddField(settingsNotSavedField = new StaticTextField(row3, margin, DisplayX - 2 * margin, TextAlignment::Left, settingsNotSavedText));
 		settingsNotSavedField->Show(false);
 
-		DisplayField::SetDefaultColours(colours.buttonTextColour, colours.buttonBackColour);
+		DisplayField::SetDefaultStyle(styleButton);
 		baudRateButton = AddIntegerButton(row4, 0, 3, nullptr, " baud", evSetBaudRate);
 		volumeButton = AddIntegerButton(row4, 1, 3, "Volume ", nullptr, evSetVolume);
 		languageButton = AddTextButton(row4, 2, 3, longLanguageNames[language], evSetLanguage, nullptr);
@@ -358,7 +391,7 @@ namespace Fields
 		AddTextButton(row7, 1, 3, "Clear settings", evFactoryReset, nullptr);
 		AddTextButton(row7, 2, 3, "Save & restart", evRestart, nullptr);
 			
-		DisplayField::SetDefaultColours(colours.labelTextColour, colours.defaultBackColour);
+		DisplayField::SetDefaultStyle(styleLabel);
 		setupRoot = mgr.GetRoot();
 			
 		mgr.SetRoot(NULL);
@@ -369,9 +402,16 @@ namespace Fields
 	void CreateIntegerAdjustPopup(const ColourScheme& colours)
 	{
 		// Create the popup window used to adjust temperatures, fan speed, extrusion factor etc.
+		// The Set button has a different event from the others, so it can't be part of a button row.
 		static const char* const tempPopupText[] = {"-5", "-1", "Set", "+1", "+5"};
 		static const int tempPopupParams[] = { -5, -1, 0, 1, 5 };
-		setTempPopup = CreateIntPopupBar(colours, tempPopupBarWidth, 5, tempPopupText, tempPopupParams, evAdjustInt, evSetInt);
+		setTempPopup = new PopupWindow(popupBarHeight, tempPopupBarWidth, colours.popupBackColour, colours.popupBorderColour);
+		DisplayField::SetDefaultStyle(stylePopupButton);
+		const PixelNumber step = (tempPopupBarWidth - 2 * popupSideMargin + popupFieldSpacing)/5;
+		for (unsigned int i = 0; i < 5; ++i)
+		{
+			setTempPopup->AddField(new TextButton(popupSideMargin, popupSideMargin + i * step, step - popupFieldSpacing, tempPopupText[i], (tempPopupParams[i] == 0) ? evSetInt : evAdjustInt, tempPopupParams[i]));
+		}
 	}
 
 	// Create the movement popup window
@@ -380,18 +420,18 @@ namespace Fields
 		static const char * array const xyJogValues[] = { "-100", "-10", "-1", "-0.1", "0.1",  "1", "10", "100" };
 		static const char * array const zJogValues[] = { "-50", "-5", "-0.5", "-0.05", "0.05",  "0.5", "5", "50" };
 
-		movePopup = CreatePopupWindow(movePopupHeight, movePopupWidth, colours.popupBackColour, colours.popupBorderColour, colours.popupTextColour, "Move head");
+		movePopup = CreatePopupWindow(movePopupHeight, movePopupWidth, colours.popupBackColour, colours.popupBorderColour, stylePopupText, "Move head");
 		PixelNumber ypos = popupTopMargin + buttonHeight + moveButtonRowSpacing;
 		const PixelNumber xpos = popupSideMargin + axisLabelWidth;
 		Event e = evMoveX;
 		for (size_t i = 0; i < MAX_AXES; ++i)
 		{
-			DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
+			DisplayField::SetDefaultStyle(stylePopupButton);
 			const char * array const * array values = (axisNames[i][0] == 'Z') ? zJogValues : xyJogValues;
 			CreateStringButtonRow(movePopup, ypos, xpos, movePopupWidth - xpos - popupSideMargin, fieldSpacing, 8, values, values, e);
 
-			// We create the label after the button row, so that the buttons follow it in the field order, which makes it easier to hide them
-			DisplayField::SetDefaultColours(colours.popupTextColour, colours.popupBackColour);
+			// We create the label after the button row, so that the row follows it in the field order, which makes it easier to hide them
+			DisplayField::SetDefaultStyle(stylePopupText);
 			StaticTextField * const tf = new StaticTextField(ypos + labelRowAdjust, popupSideMargin, axisLabelWidth, TextAlignment::Left, axisNames[i]);
 			movePopup->AddField(tf);
 			moveAxisRows[i] = tf;
@@ -409,15 +449,15 @@ namespace Fields
 		static const char * array extrudeSpeedValues[] = { "50", "40", "20", "10", "5" };
 		static const char * array extrudeSpeedParams[] = { "3000", "2400", "1200", "600", "300" };
 
-		extrudePopup = CreatePopupWindow(extrudePopupHeight, extrudePopupWidth, colours.popupBackColour, colours.popupBorderColour, colours.popupButtonTextColour, "Extrusion amount (mm)");
+		extrudePopup = CreatePopupWindow(extrudePopupHeight, extrudePopupWidth, colours.popupBackColour, colours.popupBorderColour, stylePopupButtonText, "Extrusion amount (mm)");
 		PixelNumber ypos = popupTopMargin + buttonHeight + extrudeButtonRowSpacing;
-		DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
+		DisplayField::SetDefaultStyle(stylePopupButton);
 		currentExtrudeAmountPress = CreateStringButtonRow(extrudePopup, ypos, popupSideMargin, extrudePopupWidth - 2 * popupSideMargin, fieldSpacing, 6, extrudeAmountValues, extrudeAmountValues, evExtrudeAmount, 3);
 		ypos += buttonHeight + extrudeButtonRowSpacing;
-		DisplayField::SetDefaultColours(colours.popupTextColour, colours.popupBackColour);
+		DisplayField::SetDefaultStyle(stylePopupText);
 		extrudePopup->AddField(new StaticTextField(ypos + labelRowAdjust, popupSideMargin, extrudePopupWidth - 2 * popupSideMargin, TextAlignment::Centre, "Speed (mm/sec)"));
 		ypos += buttonHeight + extrudeButtonRowSpacing;
-		DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
+		DisplayField::SetDefaultStyle(stylePopupButton);
 		currentExtrudeRatePress = CreateStringButtonRow(extrudePopup, ypos, popupSideMargin, extrudePopupWidth - 2 * popupSideMargin, fieldSpacing, 5, extrudeSpeedValues, extrudeSpeedParams, evExtrudeRate, 4);
 		ypos += buttonHeight + extrudeButtonRowSpacing;
 		extrudePopup->AddField(new TextButton(ypos, popupSideMargin, extrudePopupWidth/3 - 2 * popupSideMargin, "Extrude", evExtrude));
@@ -427,7 +467,7 @@ namespace Fields
 	// Create the popup used to list files and macros
 	void CreateFileListPopup(const ColourScheme& colours)
 	{
-		fileListPopup = CreatePopupWindow(fileListPopupHeight, fileListPopupWidth, colours.popupBackColour, colours.popupBorderColour, colours.popupTextColour, nullptr);
+		fileListPopup = CreatePopupWindow(fileListPopupHeight, fileListPopupWidth, colours.popupBackColour, colours.popupBorderColour, stylePopupText, nullptr);
 		const PixelNumber closeButtonPos = fileListPopupWidth - closeButtonWidth - popupSideMargin;
 		const PixelNumber navButtonWidth = (closeButtonPos - popupSideMargin)/7;
 		const PixelNumber upButtonPos = closeButtonPos - navButtonWidth - fieldSpacing;
@@ -436,11 +476,11 @@ namespace Fields
 		const PixelNumber textPos = popupSideMargin + navButtonWidth;
 		const PixelNumber changeButtonPos = rightButtonPos - navButtonWidth - fieldSpacing;
 
-		DisplayField::SetDefaultColours(colours.popupTextColour, colours.popupBackColour);
+		DisplayField::SetDefaultStyle(stylePopupText);
 		fileListPopup->AddField(filePopupTitleField = new IntegerField(popupTopMargin + labelRowAdjust, textPos, changeButtonPos - textPos, TextAlignment::Centre, "Files on card ", nullptr));
 		fileListPopup->AddField(macroPopupTitleField = new StaticTextField(popupTopMargin + labelRowAdjust, textPos, rightButtonPos - textPos, TextAlignment::Centre, "Macros"));
 
-		DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
+		DisplayField::SetDefaultStyle(stylePopupButton);
 		fileListPopup->AddField(scrollFilesLeftButton = new TextButton(popupTopMargin, leftButtonPos, navButtonWidth, "<", evScrollFiles, -numFileRows));
 		scrollFilesLeftButton->Show(false);
 		fileListPopup->AddField(scrollFilesRightButton = new TextButton(popupTopMargin, rightButtonPos, navButtonWidth, ">", evScrollFiles, numFileRows));
@@ -449,21 +489,12 @@ namespace Fields
 		filesUpButton->Show(false);
 		fileListPopup->AddField(changeCardButton = new TextButton(popupTopMargin, changeButtonPos, navButtonWidth, "<->", evChangeCard, 0));
 		
-		const PixelNumber fileFieldWidth = (fileListPopupWidth + fieldSpacing - (2 * popupSideMargin))/numFileColumns;
-		unsigned int fileNum = 0;
-		for (unsigned int c = 0; c < numFileColumns; ++c)
-		{
-			PixelNumber row = popupTopMargin;
-			for (unsigned int r = 0; r < numFileRows; ++r)
-			{
-				row += buttonHeight + fileButtonRowSpacing;
-				TextButton *t = new TextButton(row, (fileFieldWidth * c) + popupSideMargin, fileFieldWidth - fieldSpacing, nullptr, evNull);
-				t->Show(false);
-				fileListPopup->AddField(t);
-				filenameButtons[fileNum] = t;
-				++fileNum;
-			}
-		}
+		// The list of files is sized to show numFileRows rows when it is scrolled to a whole number of rows
+		const PixelNumber fileListTop = popupTopMargin + buttonHeight + fileButtonRowSpacing;
+		filenameList = new ListField(fileListTop, popupSideMargin, fileListPopupWidth - (2 * popupSideMargin), fileListPopupHeight - popupTopMargin - fileListTop,
+										numFileColumns, fieldSpacing, fileButtonRowSpacing, evNull);
+		filenameList->Show(false);
+		fileListPopup->AddField(filenameList);
 		
 		fileListErrorField = new IntegerField(popupTopMargin + 2 * (buttonHeight + fileButtonRowSpacing), popupSideMargin, fileListPopupWidth - (2 * popupSideMargin),
 								TextAlignment::Centre, "Error ", " accessing SD card");
@@ -474,7 +505,7 @@ namespace Fields
 	// Create the popup window used to display the file dialog
 	void CreateFileActionPopup(const ColourScheme& colours)
 	{
-		filePopup = CreatePopupWindow(fileInfoPopupHeight, fileInfoPopupWidth, colours.popupBackColour, colours.popupBorderColour, colours.popupTextColour, "File information");
+		filePopup = CreatePopupWindow(fileInfoPopupHeight, fileInfoPopupWidth, colours.popupBackColour, colours.popupBorderColour, stylePopupText, "File information");
 		PixelNumber ypos = popupTopMargin + (3 * rowTextHeight)/2;
 		fpNameField = new TextField(ypos, popupSideMargin, fileInfoPopupWidth - 2 * popupSideMargin, TextAlignment::Left, "Filename: ");
 		ypos += rowTextHeight;
@@ -495,7 +526,7 @@ namespace Fields
 		filePopup->AddField(fpGeneratedByField);
 
 		// Add the buttons
-		DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
+		DisplayField::SetDefaultStyle(stylePopupButton);
 		filePopup->AddField(new TextButton(popupTopMargin + 8 * rowTextHeight, popupSideMargin, fileInfoPopupWidth/3 - 2 * popupSideMargin, "Print", evPrint));
 		filePopup->AddField(new IconButton(popupTopMargin + 8 * rowTextHeight, (2 * fileInfoPopupWidth)/3 + popupSideMargin, fileInfoPopupWidth/3 - 2 * popupSideMargin, IconTrash, evDeleteFile));
 	}
@@ -504,11 +535,11 @@ namespace Fields
 	void CreateAreYouSurePopup(const ColourScheme& colours)
 	{
 		areYouSurePopup = new PopupWindow(areYouSurePopupHeight, areYouSurePopupWidth, colours.popupBackColour, colours.popupBorderColour);
-		DisplayField::SetDefaultColours(colours.popupTextColour, colours.popupBackColour);
+		DisplayField::SetDefaultStyle(stylePopupText);
 		areYouSurePopup->AddField(areYouSureTextField = new StaticTextField(popupSideMargin, margin, areYouSurePopupWidth - 2 * margin, TextAlignment::Centre, nullptr));
 		areYouSurePopup->AddField(areYouSureQueryField = new StaticTextField(popupTopMargin + rowHeight, margin, areYouSurePopupWidth - 2 * margin, TextAlignment::Centre, nullptr));
 
-		DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
+		DisplayField::SetDefaultStyle(stylePopupButton);
 		areYouSurePopup->AddField(new IconButton(popupTopMargin + 2 * rowHeight, popupSideMargin, areYouSurePopupWidth/2 - 2 * popupSideMargin, IconOk, evYes));
 		areYouSurePopup->AddField(new IconButton(popupTopMargin + 2 * rowHeight, areYouSurePopupWidth/2 + 10, areYouSurePopupWidth/2 - 2 * popupSideMargin, IconCancel, evCancel));
 	}
@@ -518,7 +549,7 @@ namespace Fields
 	{
 		static const char* const baudPopupText[] = { "9600", "19200", "38400", "57600", "115200" };
 		static const int baudPopupParams[] = { 9600, 19200, 38400, 57600, 115200 };
-		baudPopup = CreateIntPopupBar(colours, fullPopupWidth, 5, baudPopupText, baudPopupParams, evAdjustBaudRate, evAdjustBaudRate);
+		baudPopup = CreateIntPopupBar(colours, fullPopupWidth, 5, baudPopupText, baudPopupParams, evAdjustBaudRate);
 	}
 
 	// Create the volume adjustment popup
@@ -527,41 +558,36 @@ namespace Fields
 		static_assert(Buzzer::MaxVolume == 5, "MaxVolume assumed to be 5 here");
 		static const char* const volumePopupText[Buzzer::MaxVolume + 1] = { "Off", "1", "2", "3", "4", "5" };
 		static const int volumePopupParams[Buzzer::MaxVolume + 1] = { 0, 1, 2, 3, 4, 5 };
-		volumePopup = CreateIntPopupBar(colours, fullPopupWidth, Buzzer::MaxVolume + 1, volumePopupText, volumePopupParams, evAdjustVolume, evAdjustVolume);
+		volumePopup = CreateIntPopupBar(colours, fullPopupWidth, Buzzer::MaxVolume + 1, volumePopupText, volumePopupParams, evAdjustVolume);
 	}
 
 	// Create the volume adjustment popup
 	void CreateColoursPopup(const ColourScheme& colours)
 	{
 		static_assert(NumColourSchemes == 2, "Code assumes exactly 2 colour schemes");
-		const char* coloursPopupText[NumColourSchemes];
+		static const char* coloursPopupText[NumColourSchemes];
 		for (size_t i = 0; i < NumColourSchemes; ++i)
 		{
 			coloursPopupText[i] = colourSchemes[i].name;
 		}
 		static const int coloursPopupParams[NumColourSchemes] = { 0, 1 };
-		coloursPopup = CreateIntPopupBar(colours, fullPopupWidth, NumColourSchemes, coloursPopupText, coloursPopupParams, evAdjustColours, evAdjustColours);
+		coloursPopup = CreateIntPopupBar(colours, fullPopupWidth, NumColourSchemes, coloursPopupText, coloursPopupParams, evAdjustColours);
 	}
 
 	// Create the language popup (currently only affects the keyboard layout)
 	void CreateLanguagePopup(const ColourScheme& colours)
 	{
 		static const int languagePopupParams[numLanguages] = { 0, 1, 2 };
-		languagePopup = CreateIntPopupBar(colours, fullPopupWidth, numLanguages, languageNames, languagePopupParams, evAdjustLanguage, evAdjustLanguage);
+		languagePopup = CreateIntPopupBar(colours, fullPopupWidth, numLanguages, languageNames, languagePopupParams, evAdjustLanguage);
 	}
 	
 	// Create the pop-up keyboard
 	void CreateKeyboardPopup(uint32_t language, ColourScheme colours)
 	{
-		static const char* array const keysGB[4] = { "1234567890-+", "QWERTYUIOP", "ASDFGHJKL:", "ZXCVBNM./" };
-		static const char* array const keysDE[4] = { "1234567890-+", "QWERTZUIOP", "ASDFGHJKL:", "YXCVBNM./" };
-		static const char* array const keysFR[4] = { "1234567890-+", "AZERTWUIOP", "QSDFGHJKLM", "YXCVBN.:/" };
-		static const char* array const * const keyboards[numLanguages] = { keysGB, keysDE, keysFR };
-
-		keyboardPopup = CreatePopupWindow(keyboardPopupHeight, keyboardPopupWidth, colours.popupBackColour, colours.popupBorderColour, colours.popupInfoTextColour, nullptr, keyboardTopMargin);
+		keyboardPopup = CreatePopupWindow(keyboardPopupHeight, keyboardPopupWidth, colours.popupBackColour, colours.popupBorderColour, stylePopupInfoText, nullptr, keyboardTopMargin);
 		
 		// Add the text area in which the command is built
-		DisplayField::SetDefaultColours(colours.popupInfoTextColour, colours.popupInfoBackColour);		// need a different background colour
+		DisplayField::SetDefaultStyle(stylePopupInfo);		// need a different background colour
 		userCommandField = new TextField(keyboardTopMargin + labelRowAdjust, popupSideMargin, keyboardPopupWidth - 2 * popupSideMargin - closeButtonWidth - popupFieldSpacing, TextAlignment::Left, nullptr, "_");
 		keyboardPopup->AddField(userCommandField);
 
@@ -570,18 +596,12 @@ namespace Fields
 			language = 0;
 		}
 		const char* array const * array const keys = keyboards[language];
-		DisplayField::SetDefaultColours(colours.popupButtonTextColour, colours.popupButtonBackColour);
+		DisplayField::SetDefaultStyle(stylePopupButton);
 		PixelNumber row = keyboardTopMargin + keyButtonVStep;
-		for (size_t i = 0; i < 4; ++i)
+		for (size_t i = 0; i < numKeyboardRows; ++i)
 		{
-			PixelNumber column = popupSideMargin + (i * keyButtonHStep)/3;
-			const char * s = keys[i];
-			while (*s != 0)
-			{
-				keyboardPopup->AddField(new CharButton(row, column, keyButtonWidth, *s, evKey));
-				++s;
-				column += keyButtonHStep;
-			}
+			keyboardRows[i] = new CharButtonRow(row, popupSideMargin + (i * keyButtonHStep)/3, keyButtonWidth, keyButtonHStep, keys[i], evKey);
+			keyboardPopup->AddField(keyboardRows[i]);
 			switch (i)
 			{
 			case 1:
@@ -612,22 +632,42 @@ namespace Fields
 	// Create the message popup window
 	void CreateMessagePopup(const ColourScheme& colours)
 	{
-		alertPopup = CreatePopupWindow(alertPopupHeight, alertPopupWidth, colours.alertPopupBackColour, colours.popupBorderColour, colours.alertPopupTextColour, "Message");
+		alertPopup = CreatePopupWindow(alertPopupHeight, alertPopupWidth, colours.alertPopupBackColour, colours.popupBorderColour, styleAlert, "Message");
 		alertPopup->AddField(new StaticTextField(popupTopMargin + 2 * rowTextHeight, popupSideMargin, alertPopupWidth - 2 * popupSideMargin, TextAlignment::Centre,
 								 alertText.c_str()));
 	}
 
+	// Create the popup that shows the recent history of the heater temperatures
+	void CreateTemperatureChartPopup(const ColourScheme& colours)
+	{
+		temperatureChartPopup = CreatePopupWindow(fullPopupHeight, fullPopupWidth, colours.popupBackColour, colours.popupBorderColour, stylePopupText, "Temperature history");
+		DisplayField::SetDefaultStyle(styleChart);
+		temperatureChart = new ChartField(chartY, chartX, chartHeight, chartSamples, chartPixelsPerSample, maxHeaters, temperatureHistory, heaterColours, heaterNames,
+											chartFullScale, chartGridInterval);
+		temperatureChartPopup->AddField(temperatureChart);
+
+		// Label the grid lines
+		DisplayField::SetDefaultStyle(stylePopupText);
+		for (unsigned int i = 0; i < sizeof(chartLabels)/sizeof(chartLabels[0]); ++i)
+		{
+			const PixelNumber ypos = temperatureChart->GetYpos(i * chartLabelInterval) - rowTextHeight/2;
+			temperatureChartPopup->AddField(new StaticTextField(ypos, popupSideMargin, chartLabelWidth, TextAlignment::Right, chartLabels[i]));
+		}
+	}
+
 	// Create all the fields we ever display
 	void CreateFields(uint32_t language, const ColourScheme& colours)
 	{
 		mgr.Init(colours.defaultBackColour);
+		DisplayField::SetStyles(displayStyles);
+		DisplayField::SetColourScheme(colours);
 		DisplayField::SetDefaultFont(DEFAULT_FONT);
 		ButtonWithText::SetFont(DEFAULT_FONT);
 		SingleButton::SetTextMargin(textButtonMargin);
 		SingleButton::SetIconMargin(iconButtonMargin);
 	
 		// Create the fields that are displayed on all pages
-		DisplayField::SetDefaultColours(colours.buttonTextColour, colours.buttonBackColour, colours.buttonBorderColour, colours.buttonGradColour, colours.buttonPressedBackColour, colours.buttonPressedGradColour);
+		DisplayField::SetDefaultStyle(styleButton);
 		tabControl = AddTextButton(rowTabs, 0, 4, "Control", evTabControl, nullptr);
 		tabPrint = AddTextButton(rowTabs, 1, 4, "Print", evTabPrint, nullptr);
 		tabMsg = AddTextButton(rowTabs, 2, 4, "Console", evTabMsg, nullptr);
@@ -635,7 +675,7 @@ namespace Fields
 		baseRoot = mgr.GetRoot();		// save the root of fields that we usually display
 
 		// Create the fields that are common to the Control and Print pages
-		DisplayField::SetDefaultColours(colours.titleBarTextColour, colours.titleBarBackColour);
+		DisplayField::SetDefaultStyle(styleTitleBar);
 		mgr.AddField(nameField = new StaticTextField(row1, 0, DisplayX - statusFieldWidth, TextAlignment::Centre, machineName.c_str()));
 		mgr.AddField(statusField = new StaticTextField(row1, DisplayX - statusFieldWidth, statusFieldWidth, TextAlignment::Right, nullptr));
 		CreateTemperatureGrid(colours);
@@ -660,31 +700,55 @@ namespace Fields
 		CreateKeyboardPopup(language, colours);
 		CreateLanguagePopup(colours);
 		CreateMessagePopup(colours);
+		CreateTemperatureChartPopup(colours);
+
+		// Make the touch index big enough for every page and popup, so that it is only allocated once
+		DisplayField * const pageRoots[] = { controlRoot, printRoot, messageRoot, setupRoot };
+		for (DisplayField *r : pageRoots)
+		{
+			Window::ReserveFieldIndex(r);
+		}
+		PopupWindow * const popups[] = { setTempPopup, movePopup, extrudePopup, fileListPopup, filePopup, baudPopup, volumePopup, areYouSurePopup, keyboardPopup, languagePopup, coloursPopup, alertPopup, temperatureChartPopup };
+		for (PopupWindow *p : popups)
+		{
+			Window::ReserveFieldIndex(p->GetRoot());
+		}
 
 		// Set initial values. We already did the temperature fields when we created them.
 		fanSpeed->SetValue(0);
 		spd->SetValue(100);
 	}
 	
-	// Show or hide the field that warns about unsaved settings
-	void SettingsAreSaved(bool areSaved, bool needRestart)
-	pre(needRestart => !areSaved)
+	// Change the colours of all the fields and windows in place. The caller must redraw the display afterwards.
+	void SetColourScheme(const ColourScheme& colours)
 	{
-		if (needRestart)
-		{
-			settingsNotSavedField->SetValue(restartNeededText);
-			mgr.Show(settingsNotSavedField, true);
-		}
-		else if (areSaved)
+		DisplayField::SetColourScheme(colours);
+		mgr.SetBackgroundColour(colours.defaultBackColour);
+		PopupWindow * const popups[] = { setTempPopup, movePopup, extrudePopup, fileListPopup, filePopup, baudPopup, volumePopup, areYouSurePopup, keyboardPopup, languagePopup, coloursPopup, temperatureChartPopup };
+		for (PopupWindow *p : popups)
 		{
-			mgr.Show(settingsNotSavedField, false);
+			p->SetColours(colours.popupBackColour, colours.popupBorderColour);
 		}
-		else
+		alertPopup->SetColours(colours.alertPopupBackColour, colours.popupBorderColour);
+	}
+
+	// Change the keyboard layout in place
+	void SetLanguage(uint32_t language)
+	{
+		if (language < numLanguages)
 		{
-			settingsNotSavedField->SetValue(settingsNotSavedText);
-			mgr.Show(settingsNotSavedField, true);
+			for (size_t i = 0; i < numKeyboardRows; ++i)
+			{
+				keyboardRows[i]->SetText(keyboards[language][i]);
+			}
 		}
 	}
+
+	// Show or hide the field that warns about unsaved settings
+	void SettingsAreSaved(bool areSaved)
+	{
+		mgr.Show(settingsNotSavedField, !areSaved);
+	}
 	
 	void ShowFilesButton()
 	{
@@ -713,9 +777,9 @@ namespace Fields
 	// Show or hide an axis on the move button grid and on the axis display
 	void ShowAxis(size_t axis, bool b)
 	{
-		// The table gives us a pointer to the label field, which is followed by 8 buttons. So we need to show or hide 9 fields.
+		// The table gives us a pointer to the label field, which is followed by the row of buttons. So we need to show or hide 2 fields.
 		DisplayField *f = moveAxisRows[axis];
-		for (int i = 0; i < 9 && f != nullptr; ++i)
+		for (int i = 0; i < 2 && f != nullptr; ++i)
 		{
 			f->Show(b);
 			f = f->next;
@@ -103,6 +103,10 @@ const PixelNumber closeButtonWidth = 40;
 
 const PixelNumber touchCalibMargin = 15;
 
+const PixelNumber chartLabelWidth = 44;
+const PixelNumber chartPixelsPerSample = 2;
+const unsigned int chartSamples = 200;
+
 extern uint8_t glcd19x21[];				// declare which fonts we will be using
 #define DEFAULT_FONT	glcd19x21
 
@@ -147,6 +151,10 @@ const PixelNumber closeButtonWidth = 66;
 
 const PixelNumber touchCalibMargin = 22;
 
+const PixelNumber chartLabelWidth = 66;
+const PixelNumber chartPixelsPerSample = 3;
+const unsigned int chartSamples = 225;
+
 extern uint8_t glcd28x32[];				// declare which fonts we will be using
 extern uint8_t glcd28x32[];				// declare which fonts we will be using
 #define DEFAULT_FONT	glcd28x32
@@ -214,7 +222,6 @@ const PixelNumber keyboardPopupX = fullWidthPopupX, keyboardPopupY = margin;
 
 const unsigned int numFileColumns = 2;
 const unsigned int numFileRows = (fullPopupHeight - (2 * popupTopMargin) + fileButtonRowSpacing)/(buttonHeight + fileButtonRowSpacing) - 1;
-const unsigned int numDisplayedFiles = numFileColumns * numFileRows;
 const PixelNumber fileListPopupWidth = fullPopupWidth;
 const PixelNumber fileListPopupHeight = ((numFileRows + 1) * buttonHeight) + (numFileRows * fileButtonRowSpacing) + (2 * popupTopMargin);
 const PixelNumber fileListPopupX = (DisplayX - fileListPopupWidth)/2;
@@ -223,6 +230,15 @@ const PixelNumber fileListPopupY = (DisplayY - fileListPopupHeight)/2;
 const PixelNumber alertPopupWidth = fullPopupWidth - 6 * margin;
 const PixelNumber alertPopupHeight = 3 * rowTextHeight + 2 * popupTopMargin;
 
+// Temperature chart. The chart shows the last chartMinutes minutes, with one sample per column of chartPixelsPerSample pixels.
+const unsigned int chartMinutes = 15;
+const uint32_t chartSampleInterval = (chartMinutes * 60000)/chartSamples;		// milliseconds between samples
+const uint16_t chartFullScale = 300, chartGridInterval = 50, chartLabelInterval = 100;		// temperatures in degC
+const PixelNumber chartX = popupSideMargin + chartLabelWidth + popupFieldSpacing/2;
+const PixelNumber chartY = popupTopMargin + buttonHeight + rowTextHeight/2;
+const PixelNumber chartHeight = fullPopupHeight - chartY - popupTopMargin;
+static_assert(chartX + chartSamples * chartPixelsPerSample + popupSideMargin <= fullPopupWidth, "Temperature chart is too wide");
+
 const uint32_t numMessageRows = (rowTabs - margin - rowHeight)/rowTextHeight;
 const PixelNumber messageTextX = margin + messageTimeWidth + 2;
 const PixelNumber messageTextWidth = DisplayX - margin - messageTextX;
@@ -230,7 +246,9 @@ const PixelNumber messageTextWidth = DisplayX - margin - messageTextX;
 namespace Fields
 {
 	extern void CreateFields(uint32_t language, const ColourScheme& colours);
-	extern void SettingsAreSaved(bool areSaved, bool needRestart);
+	extern void SetColourScheme(const ColourScheme& colours);
+	extern void SetLanguage(uint32_t language);
+	extern void SettingsAreSaved(bool areSaved);
 	extern void ShowPauseButton();
 	extern void ShowFilesButton();
 	extern void ShowResumeAndCancelButtons();
@@ -261,7 +279,8 @@ extern IntegerField *freeMem, *touchX, *touchY, *fpSizeField, *fpFilamentField,
 extern ProgressBar *printProgressBar;
 extern SingleButton *tabControl, *tabPrint, *tabFiles, *tabMsg, *tabSetup;
 extern SingleButton *moveButton, *extrudeButton, *macroButton;
-extern TextButton *filenameButtons[numDisplayedFiles], *languageButton, *coloursButton;
+extern TextButton *languageButton, *coloursButton;
+extern ListField *filenameList;
 extern SingleButton *scrollFilesLeftButton, *scrollFilesRightButton, *filesUpButton, *changeCardButton;
 extern SingleButton *homeButtons[MAX_AXES], *homeAllButton;
 extern ButtonPress currentExtrudeRatePress, currentExtrudeAmountPress;
@@ -278,7 +297,19 @@ extern ButtonPress fieldBeingAdjusted;
 extern ButtonPress currentButton;
 extern PopupWindow *setTempPopup, *movePopup, *extrudePopup, *fileListPopup, *filePopup, *baudPopup, *volumePopup, *areYouSurePopup, *keyboardPopup, *languagePopup, *coloursPopup;
 extern TextField *zProbe, *fpNameField, *fpGeneratedByField, *userCommandField;
-extern PopupWindow *alertPopup;
+extern PopupWindow *alertPopup, *temperatureChartPopup;
+extern ChartField *temperatureChart;
+
+// Display styles. Each one selects a foreground and background colour from the colour scheme. The table of colours is in Fields.cpp.
+enum Style : uint8_t
+{
+	styleLabel, styleInfo, styleInfoBox, styleError, styleTitleBar, styleProgressBar,
+	styleButton, styleHomedButton, styleNotHomedButton, stylePauseButton, styleResumeButton, styleResetButton,
+	styleHeaterActive, styleHeaterStandby, styleHeaterTuning,
+	stylePopupText, stylePopupButtonText, stylePopupInfoText, stylePopupButton, stylePopupInfo, styleAlert,
+	styleChart,
+	numStyles
+};
 
 // Event numbers, used to say what we need to do when a field is touched
 // *** MUST leave value 0 free to mean "no event"
@@ -290,7 +321,7 @@ enum Event : uint8_t
 	evTabControl, evTabPrint, evTabMsg, evTabSetup,
 
 	// Heater control
-	evSelectHead, evAdjustActiveTemp, evAdjustStandbyTemp,
+	evSelectHead, evAdjustActiveTemp, evAdjustStandbyTemp, evTemperatureChart,
 	
 	// Control functions
 	evMovePopup, evExtrudePopup, evFan, evListMacros,
@@ -40,13 +40,17 @@ namespace FileManager
 	}
 
 	FileSet::FileSet(Event fe, Event fu, const char * array rootDir, bool pIsFilesList)
-		: requestedPath(rootDir), currentPath(), timer(FileListRequestTimeout, "M20 S2 P", requestedPath.c_str()), which(-1), fileEvent(fe), upEvent(fu), scrollOffset(0),
+		: requestedPath(rootDir), currentPath(), timer(FileListRequestTimeout, "M20 S2 P", requestedPath.c_str()), which(-1), fileEvent(fe), upEvent(fu),
 		  isFilesList(pIsFilesList), cardNumber(0)
 	{
 	}
 
 	void FileSet::Display()
 	{
+		if (displayedFileSet != this)
+		{
+			filenameList->ScrollTo(0);							// the list was showing the other file set
+		}
 		RefreshPopup();
 		filePopupTitleField->SetValue(cardNumber);
 		filePopupTitleField->Show(isFilesList);
@@ -86,57 +90,26 @@ namespace FileManager
 			// 1. Sort the file list
 			fileIndex.sort(StringGreaterThan);
 
-			// 2. Make sure the scroll position is still sensible
-			if (scrollOffset < 0)
-			{
-				scrollOffset = 0;
-			}
-			else if ((unsigned int)scrollOffset >= fileIndex.size())
-			{
-				scrollOffset = ((fileIndex.size() - 1)/numFileRows) * numFileRows;
-			}
-		
-			// 3. Display the scroll buttons if needed
-			mgr.Show(scrollFilesLeftButton, scrollOffset != 0);
-			mgr.Show(scrollFilesRightButton, scrollOffset + (numFileRows * numFileColumns) < fileIndex.size());
+			// 2. Display the file list. The list keeps its scroll position if it can, so that refreshing the list doesn't move it.
+			filenameList->SetEvent(fileEvent);
+			filenameList->SetItems(fileIndex.c_ptr(), fileIndex.size());
+			mgr.Show(filenameList, true);
+
+			// 3. Display the scroll buttons if the list doesn't fit
+			mgr.Show(scrollFilesLeftButton, filenameList->CanScroll());
+			mgr.Show(scrollFilesRightButton, filenameList->CanScroll());
 			mgr.Show(filesUpButton, IsInSubdir());
-		
-			// 4. Display the file list
-			for (size_t i = 0; i < numDisplayedFiles; ++i)
-			{
-				TextButton *f = filenameButtons[i];
-				if (i + scrollOffset < fileIndex.size())
-				{
-					const char *text = fileIndex[i + scrollOffset];
-					f->SetText(text);
-					f->SetEvent(fileEvent, text);
-					mgr.Show(f, true);
-				}
-				else
-				{
-					f->SetText("");
-					mgr.Show(f, false);
-				}
-			}
 			displayedFileSet = this;
 		}
 		else
 		{
 			mgr.Show(scrollFilesLeftButton, false);
 			mgr.Show(scrollFilesRightButton, false);
-			for (size_t i = 0; i < numDisplayedFiles; ++i)
-			{
-				mgr.Show(filenameButtons[i], false);
-			}
+			filenameList->SetItems(nullptr, 0);					// this also scrolls back to the start, ready for the new list
+			mgr.Show(filenameList, false);
 		}
 	}
 	
-	void FileSet::Scroll(int amount)
-	{
-		scrollOffset += amount;
-		RefreshPopup();
-	}
-	
 	void FileSet::SetPath(const char * array pPath)
 	{
 		currentPath.copy(pPath);
@@ -345,7 +318,7 @@ namespace FileManager
 	{
 		if (displayedFileSet != nullptr)
 		{
-			displayedFileSet->Scroll(amount);
+			filenameList->ScrollRows(amount);
 		}
 	}
 
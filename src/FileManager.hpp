@@ -27,7 +27,6 @@ namespace FileManager
 		int which;
 		const Event fileEvent;
 		const Event upEvent;
-		int scrollOffset;
 		bool IsInSubdir() const;
 		const bool isFilesList;			// true for a file list, false for a macro list
 		uint8_t cardNumber;
@@ -37,7 +36,6 @@ namespace FileManager
 		void Display();
 		void Reload(int whichList, const Path& dir, int errCode);
 		void RefreshPopup();
-		void Scroll(int amount);
 		void SetIndex(int index) { which = index; }
 		int GetIndex() const { return which; }
 		void SetPath(const char * array pPath);
@@ -0,0 +1,266 @@
+/*
+ * FontMetricsData.cpp
+ *
+ * Generated by fontmetrics.py from glcd19x21.cpp, glcd28x32.cpp. Do not edit.
+ */
+
+#include "Hardware/FontMetrics.hpp"
+
+extern const uint8_t glcd19x21[];
+
+// 224 characters, 83 left kerning classes, 88 right kerning classes
+static const uint8_t glcd19x21_numCols[] =
+{
+	0x07, 0x02, 0x05, 0x0C, 0x0C, 0x11, 0x0D, 0x02, 0x05, 0x06, 0x06, 0x0A, 0x02, 0x05, 0x02, 0x06,
+	0x0A, 0x09, 0x0A, 0x0A, 0x0B, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x02, 0x02, 0x0A, 0x0A, 0x0A, 0x0A,
+	0x11, 0x0D, 0x0B, 0x0D, 0x0C, 0x0B, 0x0A, 0x0D, 0x0A, 0x02, 0x09, 0x0B, 0x09, 0x0D, 0x0A, 0x0E,
+	0x0B, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x13, 0x0C, 0x0C, 0x0B, 0x04, 0x06, 0x04, 0x08, 0x0C,
+	0x04, 0x0B, 0x09, 0x09, 0x09, 0x0A, 0x06, 0x09, 0x09, 0x02, 0x03, 0x09, 0x02, 0x0E, 0x09, 0x0A,
+	0x09, 0x09, 0x06, 0x09, 0x06, 0x09, 0x0B, 0x0F, 0x08, 0x0B, 0x07, 0x07, 0x02, 0x07, 0x0A, 0x05,
+	0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x02, 0x09, 0x0B, 0x0A, 0x0C, 0x02, 0x0A, 0x06, 0x0F, 0x07, 0x0A, 0x0A, 0x05, 0x0F, 0x0C,
+	0x06, 0x0A, 0x06, 0x05, 0x04, 0x0A, 0x09, 0x02, 0x03, 0x06, 0x08, 0x0A, 0x10, 0x10, 0x10, 0x0A,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x13, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x03, 0x03, 0x05, 0x07,
+	0x0E, 0x0A, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x08, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x11, 0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x04, 0x04, 0x07, 0x06,
+	0x0A, 0x09, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x09, 0x09, 0x09, 0x09, 0x0B, 0x0A, 0x0B,
+};
+
+static const uint8_t glcd19x21_leftClass[] =
+{
+	0x00, 0x41, 0x0E, 0x1C, 0x21, 0x13, 0x32, 0x0E, 0x23, 0x4F, 0x09, 0x11, 0x4A, 0x1E, 0x3C, 0x3C,
+	0x25, 0x38, 0x3E, 0x29, 0x1C, 0x2A, 0x20, 0x05, 0x2B, 0x26, 0x3F, 0x4B, 0x16, 0x1D, 0x28, 0x0B,
+	0x34, 0x36, 0x45, 0x20, 0x45, 0x45, 0x45, 0x20, 0x45, 0x45, 0x21, 0x45, 0x45, 0x45, 0x45, 0x20,
+	0x45, 0x20, 0x45, 0x27, 0x05, 0x1B, 0x05, 0x0C, 0x37, 0x08, 0x3D, 0x52, 0x06, 0x4E, 0x14, 0x4D,
+	0x04, 0x31, 0x47, 0x23, 0x2D, 0x24, 0x0A, 0x48, 0x47, 0x43, 0x4D, 0x47, 0x47, 0x42, 0x42, 0x2D,
+	0x51, 0x2D, 0x42, 0x30, 0x0A, 0x2E, 0x0A, 0x0D, 0x3F, 0x0A, 0x3E, 0x17, 0x52, 0x4E, 0x11, 0x35,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4C, 0x15, 0x40, 0x14, 0x05, 0x50, 0x36, 0x06, 0x1A, 0x12, 0x1F, 0x11, 0x1E, 0x1A, 0x02,
+	0x0B, 0x39, 0x17, 0x19, 0x07, 0x51, 0x10, 0x15, 0x49, 0x18, 0x0F, 0x2F, 0x18, 0x18, 0x19, 0x3C,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x3C, 0x20, 0x45, 0x45, 0x45, 0x45, 0x01, 0x46, 0x02, 0x03,
+	0x11, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x3B, 0x1B, 0x1B, 0x1B, 0x1B, 0x08, 0x45, 0x42,
+	0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x33, 0x23, 0x24, 0x24, 0x24, 0x24, 0x04, 0x44, 0x07, 0x06,
+	0x2C, 0x42, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x11, 0x3A, 0x2E, 0x2E, 0x2E, 0x2E, 0x0A, 0x52, 0x0A,
+};
+
+static const uint8_t glcd19x21_rightClass[] =
+{
+	0xFF, 0x44, 0x10, 0x0E, 0x26, 0x3A, 0x3C, 0x10, 0x55, 0x29, 0x09, 0x12, 0x4E, 0x20, 0x41, 0x06,
+	0x2A, 0x3C, 0x3F, 0x30, 0x1E, 0x32, 0x32, 0x08, 0x31, 0x25, 0x42, 0x4F, 0x2D, 0x1F, 0x16, 0x11,
+	0x25, 0x3C, 0x2F, 0x2E, 0x23, 0x3D, 0x14, 0x33, 0x49, 0x49, 0x35, 0x3C, 0x3C, 0x49, 0x49, 0x23,
+	0x11, 0x23, 0x3C, 0x2F, 0x05, 0x1D, 0x05, 0x0D, 0x3D, 0x08, 0x3D, 0x53, 0x41, 0x58, 0x13, 0x52,
+	0x07, 0x3C, 0x34, 0x37, 0x4B, 0x2C, 0x0B, 0x4D, 0x45, 0x47, 0x51, 0x3C, 0x4B, 0x45, 0x45, 0x34,
+	0x34, 0x57, 0x0F, 0x39, 0x3E, 0x46, 0x0A, 0x0F, 0x42, 0x0A, 0x3F, 0x53, 0x58, 0x19, 0x12, 0x3B,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x50, 0x28, 0x2B, 0x1B, 0x05, 0x56, 0x43, 0x06, 0x1C, 0x13, 0x36, 0x29, 0x20, 0x1C, 0x02,
+	0x0C, 0x40, 0x1A, 0x17, 0x04, 0x3C, 0x05, 0x15, 0x54, 0x19, 0x11, 0x21, 0x2B, 0x3C, 0x2B, 0x4C,
+	0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3D, 0x2E, 0x3D, 0x3D, 0x3D, 0x3D, 0x4A, 0x01, 0x02, 0x03,
+	0x23, 0x49, 0x23, 0x23, 0x23, 0x23, 0x23, 0x27, 0x24, 0x1D, 0x1D, 0x1D, 0x1D, 0x08, 0x18, 0x38,
+	0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x2C, 0x37, 0x2C, 0x2C, 0x2C, 0x2C, 0x48, 0x04, 0x07, 0x06,
+	0x34, 0x45, 0x34, 0x34, 0x34, 0x34, 0x34, 0x12, 0x22, 0x46, 0x46, 0x46, 0x46, 0x0A, 0x34, 0x0A,
+};
+
+static const uint8_t glcd19x21_kernTable[] =
+{
+	0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0x07, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF,
+	0x07, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x77, 0x3F, 0x02, 0x9F, 0xAE, 0xFF, 0xF7,
+	0xFF, 0xFF, 0x5F, 0xDF, 0x15, 0x7F, 0x02, 0x8F, 0xAE, 0xFF, 0xF7, 0xFF, 0xFF, 0x5F, 0xDF, 0x15,
+	0x3F, 0x02, 0x7F, 0xAE, 0xF6, 0xF4, 0xFF, 0xFE, 0xDF, 0xFF, 0x0D, 0xFF, 0x02, 0x1F, 0xAE, 0xF6,
+	0xF4, 0xFF, 0xFE, 0x5F, 0xDF, 0x05, 0x7F, 0x02, 0xFF, 0x25, 0xF6, 0xF7, 0xBB, 0xF4, 0xDF, 0xFE,
+	0x1D, 0xFF, 0x02, 0xFF, 0x03, 0xF6, 0xF7, 0x9B, 0xB5, 0xDF, 0x3E, 0x01, 0xE7, 0x00, 0xAF, 0x03,
+	0xF6, 0xF7, 0x9B, 0xB5, 0xDF, 0x3E, 0x01, 0x27, 0x00, 0xFF, 0x01, 0xF6, 0xF7, 0x9B, 0xB4, 0xDF,
+	0x3E, 0x01, 0xE7, 0x00, 0x1F, 0x00, 0xF6, 0xF4, 0x9B, 0xB4, 0x5F, 0x1E, 0x01, 0x67, 0x00, 0xFF,
+	0x1F, 0xF2, 0xD7, 0x9E, 0x33, 0xDE, 0x77, 0x01, 0xE7, 0x00, 0xFF, 0x03, 0xF2, 0xD7, 0x9A, 0x31,
+	0xDE, 0x36, 0x01, 0xE7, 0x00, 0x1F, 0x00, 0xF2, 0xD4, 0x9A, 0x30, 0x5E, 0x16, 0x01, 0x67, 0x00,
+	0xFF, 0x01, 0xB2, 0xD3, 0x8A, 0x10, 0xC4, 0x36, 0x01, 0xE6, 0x00, 0xFF, 0xFF, 0x91, 0xF3, 0x86,
+	0x8B, 0xCE, 0xF5, 0x00, 0xFE, 0x00, 0xFF, 0xFF, 0x8F, 0x71, 0xC6, 0x8F, 0xCF, 0xF3, 0x01, 0xEE,
+	0x01, 0x9F, 0xAE, 0x8F, 0x71, 0xC6, 0x8F, 0x4F, 0xD3, 0x01, 0x6E, 0x00, 0xFF, 0xFF, 0x81, 0x71,
+	0x86, 0x8B, 0xCE, 0xF1, 0x00, 0xEE, 0x00, 0xFF, 0x7F, 0x80, 0x71, 0x86, 0x8B, 0xC4, 0xF1, 0x00,
+	0xEE, 0x00, 0x7F, 0x00, 0x80, 0x70, 0x82, 0x80, 0xC4, 0x30, 0x00, 0xE6, 0x00, 0xFF, 0x1F, 0x80,
+	0x51, 0x86, 0x03, 0xC4, 0x71, 0x00, 0xE6, 0x00, 0xFF, 0xFF, 0x7F, 0x30, 0xC6, 0x87, 0xC3, 0xF3,
+	0x01, 0xEE, 0x01, 0x7F, 0x00, 0x72, 0x10, 0x82, 0x00, 0xC2, 0x32, 0x01, 0xE6, 0x00, 0xFF, 0xFF,
+	0x01, 0x30, 0x86, 0x83, 0xC2, 0xF1, 0x00, 0xEE, 0x00, 0xFF, 0x7F, 0x00, 0x30, 0x86, 0x83, 0xC0,
+	0xF1, 0x00, 0xEE, 0x00, 0x1F, 0x00, 0x00, 0x10, 0x82, 0x00, 0x40, 0x10, 0x00, 0x66, 0x00, 0xFF,
+	0xFF, 0xFF, 0x0F, 0xC2, 0x87, 0xC1, 0xF3, 0x01, 0xEE, 0x01, 0xFF, 0x1F, 0xF2, 0x07, 0x82, 0x03,
+	0xC0, 0x73, 0x01, 0xE6, 0x00, 0xFF, 0xFF, 0x7F, 0x00, 0xC2, 0x87, 0xC1, 0xF3, 0x01, 0xEE, 0x01,
+	0xFF, 0xFF, 0x0F, 0x00, 0xC2, 0x87, 0xC1, 0xF3, 0x01, 0xEE, 0x01, 0xFF, 0x03, 0x06, 0x00, 0x82,
+	0x85, 0xC1, 0x32, 0x01, 0xE6, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0x82, 0x03, 0xC0, 0x71, 0x00, 0xE6,
+	0x00, 0x9F, 0x0E, 0x00, 0x00, 0x82, 0x03, 0x40, 0x51, 0x00, 0x66, 0x00, 0xFF, 0x03, 0x00, 0x00,
+	0x82, 0x01, 0xC0, 0x30, 0x00, 0xE6, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0x40, 0x80, 0xC1, 0xF3, 0x01,
+	0xEE, 0x00, 0xFF, 0x01, 0xF6, 0x07, 0x00, 0x80, 0xC1, 0x32, 0x01, 0xE6, 0x00, 0xFF, 0x03, 0x72,
+	0x00, 0x00, 0x00, 0xC0, 0x32, 0x01, 0xE6, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x80, 0xC0, 0xF1,
+	0x00, 0xEE, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x30, 0x00, 0xE6, 0x00, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x3F, 0x80, 0xC0, 0xFF, 0x03, 0xEE, 0x00, 0xFF, 0xFF, 0x01, 0x30, 0x06, 0x80, 0xC0,
+	0xF1, 0x00, 0xEE, 0x00, 0x7F, 0x24, 0xF6, 0xF4, 0x01, 0x80, 0xC0, 0xFE, 0x01, 0xEE, 0x00, 0xFF,
+	0x01, 0xF6, 0xF7, 0x01, 0x80, 0xC0, 0x3E, 0x01, 0xE6, 0x00, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x80,
+	0xC0, 0xF3, 0x01, 0xEE, 0x00, 0xFF, 0x01, 0x76, 0x00, 0x00, 0x80, 0xC0, 0x32, 0x01, 0xE6, 0x00,
+	0xFF, 0x01, 0x72, 0x00, 0x00, 0x00, 0xC0, 0x32, 0x01, 0xE6, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
+	0x80, 0xC0, 0xF3, 0x01, 0xEE, 0x00, 0xFF, 0x01, 0x06, 0x00, 0x00, 0x80, 0xC0, 0x32, 0x01, 0xE6,
+	0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xF1, 0x00, 0xEE, 0x00, 0x1F, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x40, 0x10, 0x00, 0x66, 0x00, 0xFF, 0x1F, 0xF2, 0xD7, 0x9E, 0x33, 0xC0, 0x07, 0x00,
+	0xE3, 0x00, 0xFF, 0x1F, 0xB2, 0xD3, 0x0E, 0x00, 0xC0, 0x07, 0x00, 0xE2, 0x00, 0xFF, 0xFF, 0xFF,
+	0x0F, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xE2, 0x00, 0xFF, 0x1F, 0xB2, 0x03, 0x00, 0x00, 0xC0, 0x03,
+	0x00, 0xE2, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0xE2, 0x00, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x22, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+	0x00, 0x00, 0xE3, 0x00, 0x9F, 0xAE, 0xFF, 0xF7, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x63, 0x00, 0xFF,
+	0x03, 0xF6, 0xF7, 0x9B, 0xB5, 0x1F, 0x00, 0x00, 0xE3, 0x00, 0xFF, 0x03, 0xF2, 0xD7, 0x9A, 0x31,
+	0x1E, 0x00, 0x00, 0xE3, 0x00, 0xFF, 0xFF, 0x91, 0xF3, 0x86, 0x8B, 0x0E, 0x00, 0x00, 0xE2, 0x00,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xE3, 0x00, 0xFF, 0x03, 0xF2, 0xD7, 0x9A,
+	0x31, 0x00, 0x00, 0x00, 0xE3, 0x00, 0x7F, 0xAE, 0x80, 0x70, 0x86, 0x0A, 0x00, 0x00, 0x00, 0xE2,
+	0x00, 0x1F, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0xFF, 0x7F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xE2, 0x00, 0x8F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x7F, 0x02, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x62, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x0F, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+	0x00, 0x00, 0xE1, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xFF, 0x03, 0xF2, 0xD7, 0x9A, 0x31,
+	0x00, 0x00, 0x00, 0xE0, 0x00, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
+	0x8F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x77, 0x1F,
+	0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x8F, 0xAE, 0xFF, 0xF7,
+	0xFF, 0xFF, 0x5F, 0xDF, 0x15, 0x03, 0x00, 0x0F, 0x00, 0x90, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const FontMetrics glcd19x21_metrics =
+{
+	glcd19x21, glcd19x21_numCols, glcd19x21_leftClass, glcd19x21_rightClass, glcd19x21_kernTable,
+	0x20, 0xFF, 2, 11
+};
+
+extern const uint8_t glcd28x32[];
+
+// 224 characters, 77 left kerning classes, 85 right kerning classes
+static const uint8_t glcd28x32_numCols[] =
+{
+	0x0B, 0x03, 0x08, 0x10, 0x10, 0x18, 0x12, 0x02, 0x07, 0x07, 0x0B, 0x0F, 0x02, 0x08, 0x02, 0x08,
+	0x0E, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 0x0D, 0x0E, 0x0E, 0x0E, 0x02, 0x02, 0x0F, 0x0F, 0x0F, 0x0E,
+	0x19, 0x13, 0x0F, 0x13, 0x12, 0x10, 0x0F, 0x14, 0x11, 0x03, 0x0D, 0x10, 0x0D, 0x13, 0x11, 0x15,
+	0x0F, 0x15, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1C, 0x11, 0x11, 0x10, 0x06, 0x08, 0x06, 0x0E, 0x10,
+	0x06, 0x0F, 0x0D, 0x0D, 0x0D, 0x0E, 0x08, 0x0D, 0x0C, 0x03, 0x05, 0x0C, 0x03, 0x15, 0x0C, 0x0E,
+	0x0D, 0x0D, 0x08, 0x0D, 0x08, 0x0C, 0x0D, 0x15, 0x0B, 0x0D, 0x0C, 0x09, 0x02, 0x09, 0x0F, 0x05,
+	0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x03, 0x0C, 0x0E, 0x0C, 0x10, 0x02, 0x0C, 0x08, 0x15, 0x0B, 0x0E, 0x0F, 0x08, 0x15, 0x10,
+	0x08, 0x0E, 0x08, 0x08, 0x06, 0x0E, 0x0E, 0x02, 0x05, 0x08, 0x0B, 0x0E, 0x16, 0x16, 0x15, 0x0E,
+	0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x1B, 0x13, 0x10, 0x10, 0x10, 0x10, 0x06, 0x06, 0x08, 0x07,
+	0x14, 0x11, 0x15, 0x15, 0x15, 0x15, 0x15, 0x0D, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0F, 0x0F,
+	0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x18, 0x0D, 0x0E, 0x0E, 0x0E, 0x0E, 0x06, 0x06, 0x0A, 0x08,
+	0x0E, 0x0C, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x0E, 0x10, 0x0C, 0x0C, 0x0C, 0x0C, 0x0D, 0x0D, 0x0D,
+};
+
+static const uint8_t glcd28x32_leftClass[] =
+{
+	0x00, 0x3D, 0x10, 0x22, 0x27, 0x15, 0x2D, 0x10, 0x32, 0x49, 0x0D, 0x17, 0x45, 0x1E, 0x3B, 0x36,
+	0x20, 0x36, 0x36, 0x27, 0x24, 0x27, 0x29, 0x09, 0x2A, 0x13, 0x3C, 0x46, 0x1B, 0x23, 0x2F, 0x0E,
+	0x2B, 0x35, 0x41, 0x17, 0x41, 0x41, 0x41, 0x17, 0x41, 0x41, 0x21, 0x41, 0x41, 0x41, 0x41, 0x1C,
+	0x41, 0x1C, 0x41, 0x27, 0x09, 0x26, 0x06, 0x0C, 0x35, 0x06, 0x3B, 0x4C, 0x07, 0x49, 0x16, 0x48,
+	0x05, 0x2C, 0x43, 0x25, 0x25, 0x25, 0x0E, 0x25, 0x43, 0x3F, 0x48, 0x43, 0x43, 0x3E, 0x3E, 0x25,
+	0x4B, 0x25, 0x3E, 0x30, 0x0E, 0x33, 0x0D, 0x0E, 0x37, 0x0D, 0x36, 0x1E, 0x4C, 0x49, 0x1B, 0x34,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x47, 0x20, 0x39, 0x29, 0x06, 0x4A, 0x3A, 0x0B, 0x17, 0x14, 0x1D, 0x17, 0x1E, 0x17, 0x04,
+	0x0F, 0x38, 0x1A, 0x18, 0x0A, 0x4B, 0x12, 0x1F, 0x48, 0x19, 0x11, 0x2E, 0x19, 0x19, 0x18, 0x44,
+	0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x36, 0x17, 0x41, 0x41, 0x41, 0x41, 0x01, 0x42, 0x02, 0x02,
+	0x17, 0x41, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x28, 0x1C, 0x26, 0x26, 0x26, 0x26, 0x06, 0x41, 0x40,
+	0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x31, 0x25, 0x25, 0x25, 0x25, 0x25, 0x03, 0x08, 0x08, 0x09,
+	0x2B, 0x3E, 0x25, 0x25, 0x25, 0x25, 0x25, 0x17, 0x35, 0x33, 0x33, 0x33, 0x33, 0x0D, 0x4C, 0x0D,
+};
+
+static const uint8_t glcd28x32_rightClass[] =
+{
+	0xFF, 0x48, 0x11, 0x12, 0x26, 0x38, 0x42, 0x11, 0x52, 0x3E, 0x0D, 0x18, 0x46, 0x22, 0x46, 0x07,
+	0x25, 0x42, 0x42, 0x2F, 0x27, 0x31, 0x29, 0x09, 0x2F, 0x20, 0x47, 0x47, 0x3C, 0x28, 0x1E, 0x14,
+	0x18, 0x40, 0x38, 0x2C, 0x1F, 0x42, 0x09, 0x39, 0x4D, 0x4D, 0x33, 0x40, 0x42, 0x4D, 0x4D, 0x19,
+	0x15, 0x19, 0x44, 0x2F, 0x09, 0x2B, 0x06, 0x0C, 0x40, 0x06, 0x42, 0x52, 0x42, 0x55, 0x16, 0x51,
+	0x0A, 0x42, 0x2A, 0x35, 0x4E, 0x23, 0x0F, 0x4B, 0x4A, 0x4C, 0x4C, 0x40, 0x4E, 0x4A, 0x4A, 0x2A,
+	0x2A, 0x54, 0x0E, 0x37, 0x43, 0x4B, 0x0D, 0x0E, 0x43, 0x0D, 0x42, 0x52, 0x55, 0x22, 0x19, 0x3F,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0x50, 0x30, 0x3D, 0x2E, 0x06, 0x53, 0x49, 0x0B, 0x18, 0x17, 0x3B, 0x3A, 0x22, 0x18, 0x04,
+	0x10, 0x45, 0x1D, 0x1B, 0x05, 0x42, 0x06, 0x23, 0x4F, 0x1C, 0x13, 0x21, 0x34, 0x41, 0x34, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x42, 0x2C, 0x42, 0x42, 0x42, 0x42, 0x02, 0x01, 0x02, 0x02,
+	0x1F, 0x4D, 0x19, 0x19, 0x19, 0x19, 0x19, 0x2D, 0x1A, 0x2B, 0x2B, 0x2B, 0x2B, 0x06, 0x24, 0x36,
+	0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x23, 0x35, 0x23, 0x23, 0x23, 0x23, 0x08, 0x03, 0x08, 0x09,
+	0x32, 0x4A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x18, 0x0D, 0x4B, 0x4B, 0x4B, 0x4B, 0x0D, 0x2A, 0x0D,
+};
+
+static const uint8_t glcd28x32_kernTable[] =
+{
+	0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFB, 0x1F, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xE3, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x1F, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+	0xF7, 0x09, 0x3F, 0xED, 0xFE, 0xFF, 0xBF, 0xFF, 0xFF, 0x5F, 0xF1, 0x09, 0x1F, 0xED, 0xFE, 0xFF,
+	0xBF, 0xFF, 0xFF, 0x5F, 0xF1, 0x09, 0xFF, 0xE4, 0xFE, 0xFE, 0xBF, 0xFF, 0xEF, 0xDF, 0xF1, 0x0B,
+	0x3F, 0xE4, 0xFE, 0xFE, 0xBF, 0xFF, 0xEF, 0x5F, 0xF1, 0x09, 0xFF, 0x63, 0xFE, 0xF8, 0xBF, 0xFF,
+	0xEF, 0xDB, 0xF1, 0x0B, 0xFF, 0x60, 0xFE, 0xF8, 0xBF, 0xFF, 0xEF, 0xDB, 0xF1, 0x0B, 0x3F, 0x60,
+	0xDA, 0xF8, 0xBF, 0x7F, 0xEF, 0x5B, 0xF0, 0x09, 0xFF, 0x1F, 0xD8, 0xFF, 0xBF, 0x7D, 0x67, 0x0F,
+	0x30, 0x03, 0xFF, 0x1F, 0xD0, 0xFF, 0xBF, 0x7C, 0x67, 0x0F, 0x30, 0x03, 0x1F, 0x0D, 0xD0, 0xFF,
+	0xBF, 0x7C, 0x67, 0x0F, 0x30, 0x01, 0xFF, 0x03, 0xD0, 0xF8, 0xBF, 0x7C, 0x67, 0x0B, 0x30, 0x03,
+	0x3F, 0x00, 0xD0, 0xF8, 0xBF, 0x7C, 0x67, 0x0B, 0x30, 0x01, 0xFF, 0x3F, 0xD0, 0xFF, 0xB6, 0xFC,
+	0x67, 0x0F, 0x30, 0x03, 0xFF, 0x1F, 0xD0, 0xFF, 0xB6, 0x7C, 0x67, 0x0F, 0x30, 0x03, 0xFF, 0x0F,
+	0xD0, 0xFD, 0xB6, 0x7C, 0x67, 0x0B, 0x30, 0x03, 0xFF, 0x03, 0xC0, 0xE8, 0xB6, 0x3C, 0x62, 0x0A,
+	0x30, 0x03, 0xFF, 0xFF, 0x3F, 0xE6, 0x9E, 0xFD, 0xE3, 0x18, 0xF0, 0x03, 0xFF, 0xFF, 0x7F, 0x62,
+	0x9E, 0xF5, 0xE3, 0x19, 0xF0, 0x07, 0xFF, 0xFF, 0x3F, 0x62, 0x9E, 0xF5, 0xE3, 0x18, 0xF0, 0x03,
+	0xFF, 0xFF, 0x0F, 0x62, 0x9E, 0xF5, 0xE2, 0x18, 0xF0, 0x03, 0x5F, 0xFF, 0x0F, 0x62, 0x9E, 0xF5,
+	0xE2, 0x18, 0xF0, 0x01, 0xFF, 0x60, 0x00, 0x60, 0x96, 0x35, 0xE2, 0x08, 0x30, 0x03, 0xFF, 0xFF,
+	0xFF, 0x21, 0x9E, 0xF5, 0xE3, 0x1B, 0x70, 0x07, 0xFF, 0x00, 0xD0, 0x20, 0x9E, 0x74, 0x63, 0x0B,
+	0x30, 0x03, 0xFF, 0xFF, 0x3F, 0x20, 0x9E, 0xF5, 0xE3, 0x18, 0x70, 0x03, 0xFF, 0xFF, 0x0F, 0x20,
+	0x9E, 0xF5, 0xE2, 0x18, 0x70, 0x03, 0xFF, 0xFF, 0x07, 0x20, 0x96, 0xB5, 0xE2, 0x18, 0x70, 0x03,
+	0xFF, 0xFF, 0xFF, 0x1F, 0x8E, 0xD5, 0xE3, 0x1F, 0x70, 0x07, 0xFF, 0xFF, 0xFF, 0x01, 0x8E, 0xD5,
+	0xE3, 0x1B, 0x70, 0x07, 0xFF, 0xFF, 0x7F, 0x00, 0x8E, 0xD5, 0xE3, 0x19, 0x70, 0x07, 0xFF, 0xFF,
+	0x01, 0x00, 0x86, 0x95, 0xE2, 0x08, 0x30, 0x03, 0xFF, 0xFF, 0x01, 0x00, 0x82, 0x81, 0xE0, 0x08,
+	0x30, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xC1, 0xE1, 0x3F, 0x70, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x80, 0xC1, 0xE1, 0x1F, 0x70, 0x07, 0xFF, 0xFF, 0xC1, 0xFF, 0x80, 0x81, 0xE1, 0x0F, 0x30, 0x03,
+	0xFF, 0xFF, 0xFF, 0x01, 0x80, 0xC1, 0xE1, 0x1B, 0x70, 0x07, 0xFF, 0xFF, 0x3F, 0x00, 0x80, 0xC1,
+	0xE1, 0x18, 0x70, 0x03, 0x3F, 0x00, 0x00, 0x00, 0x80, 0x00, 0x60, 0x08, 0x30, 0x01, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x7F, 0xC0, 0xE1, 0x3F, 0x70, 0x03, 0xFF, 0x3F, 0xD0, 0xFF, 0x3F, 0xC0, 0x61, 0x0F,
+	0x30, 0x03, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x60, 0x08, 0x30, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0xC0, 0xE1, 0x1F, 0x70, 0x03, 0xFF, 0x3F, 0xD0, 0xFF, 0x00, 0xC0, 0x61, 0x0F, 0x30, 0x03,
+	0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xC0, 0xE1, 0x1B, 0x70, 0x03, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xC0,
+	0xE1, 0x18, 0x70, 0x03, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x08, 0x30, 0x01, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0x4F, 0xE0, 0x3F, 0x60, 0x03, 0xFF, 0xFF, 0xC7, 0xEF, 0x36, 0x00, 0xE0, 0x1E,
+	0x60, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x40, 0xE0, 0x3F, 0x60, 0x03, 0xFF, 0xFF, 0xC7, 0xFF,
+	0x00, 0x00, 0xE0, 0x1F, 0x60, 0x03, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x40, 0xE0, 0x1B, 0x60, 0x03,
+	0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x40, 0xE0, 0x19, 0x60, 0x03, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x40,
+	0xE0, 0x18, 0x60, 0x03, 0xFF, 0xFF, 0xC7, 0xFF, 0xB6, 0x3D, 0xE0, 0x07, 0x00, 0x03, 0xFF, 0x0F,
+	0xD8, 0xFD, 0xBF, 0x0D, 0x60, 0x03, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xE0, 0x07,
+	0x00, 0x03, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x20, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x03,
+	0xFF, 0xFF, 0x3F, 0x00, 0x82, 0xC1, 0x01, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x0F, 0x00, 0x00, 0x03, 0xFF, 0x1F, 0xD0, 0xFF, 0xBF, 0x7C, 0x07, 0x00, 0x00, 0x03, 0xFF, 0x1F,
+	0xC0, 0xFF, 0xB6, 0x3C, 0x03, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x0F, 0xE6, 0x9E, 0xFD, 0x02, 0x00,
+	0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x1F, 0xD0, 0xFF,
+	0xB6, 0x3C, 0x00, 0x00, 0x00, 0x03, 0x3F, 0x00, 0xC0, 0xE8, 0xB6, 0x3C, 0x00, 0x00, 0x00, 0x01,
+	0xFF, 0x60, 0x0E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x03, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1F, 0x0D,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xFF, 0x1F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x1F, 0xED, 0xFE, 0xFF, 0xBF, 0xFF,
+	0xFF, 0x5F, 0x71, 0x00, 0x1F, 0x00, 0x00, 0xE0, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00,
+};
+
+static const FontMetrics glcd28x32_metrics =
+{
+	glcd28x32, glcd28x32_numCols, glcd28x32_leftClass, glcd28x32_rightClass, glcd28x32_kernTable,
+	0x20, 0xFF, 3, 10
+};
+
+const FontMetrics * const FontMetrics::fonts[] =
+{
+	&glcd19x21_metrics,
+	&glcd28x32_metrics,
+};
+
+const size_t FontMetrics::numFonts = 2;
+
+// End
@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+#
+# fontmetrics.py
+#
+# Created: 16/10/2026 10:05:17
+#
+# Font compiler step for PanelDue. Reads the font arrays in glcdNNxNN.cpp files and generates FontMetricsData.cpp,
+# which holds the width of each character and the auto-kerning tables for each font in flash memory.
+#
+# For each character we find the signature of its first column (which auto-kerning compares with the preceding character)
+# and of its last non-blank column (which it compares with the following character). Signatures that give the same kerning
+# decisions are merged into classes, and the kerning decision for each pair of classes is stored as one bit.
+#
+# Run this whenever a font is changed or added, e.g.:
+#   python3 fontmetrics.py glcd19x21.cpp glcd28x32.cpp > FontMetricsData.cpp
+# Only list the fonts that are linked into the firmware, because the generated file references them.
+
+import os
+import re
+import sys
+
+NO_CLASS_CHANGE = 0xFF		# must match FontMetrics::noClassChange
+
+def read_font(filename):
+	"""Return the name of the font array and its contents as a list of byte values"""
+	with open(filename, encoding='latin-1') as f:
+		text = f.read()
+	text = re.sub(r'//[^\n]*', '', text)
+	text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+	m = re.search(r'const\s+uint8_t\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\}', text, re.S)
+	if m is None:
+		raise ValueError("No font array found in " + filename)
+	data = [int(v, 0) for v in m.group(2).replace('\n', ' ').split(',') if v.strip() != '']
+	return m.group(1), data
+
+def read_column(data, offset):
+	"""Read 32 bits of column data in the same way that the firmware does, i.e. little-endian and possibly including bytes of the following column"""
+	val = 0
+	for i in range(4):
+		val |= (data[offset + i] if offset + i < len(data) else 0) << (8 * i)
+	return val
+
+def kern(spaces, this_col_data, prev_col_data):
+	"""The auto-kerning rule used by UTFT::writeNative"""
+	if spaces >= 2:
+		return (this_col_data & prev_col_data) == 0
+	return ((this_col_data | (this_col_data << 1)) & (prev_col_data | (prev_col_data << 1))) == 0
+
+def analyse(filename, data):
+	x_size, y_size, spaces, first_char, last_char = data[0:5]
+	bytes_per_column = (y_size + 7) // 8
+	bytes_per_char = bytes_per_column * x_size + 1
+	if len(data) != 5 + (last_char - first_char + 1) * bytes_per_char:
+		raise ValueError(filename + " doesn't have the 5-byte header that UTFT::setFont expects, or its data is the wrong length")
+	cmask = (1 << y_size) - 1
+	chars = []
+	for i in range(last_char - first_char + 1):
+		base = 5 + i * bytes_per_char
+		num_cols = data[base]
+		first = read_column(data, base + 1) & cmask
+		if first == 0:
+			# characters with a deliberate space column at the start, e.g. decimal point, use the second column
+			first = read_column(data, base + 1 + bytes_per_column) & cmask
+		last = None				# None means that this character doesn't change the kerning data
+		for col in range(num_cols):
+			col_data = read_column(data, base + 1 + col * bytes_per_column)
+			if col_data != 0:
+				last = col_data & cmask
+		chars.append((num_cols, first, last))
+	return spaces, first_char, last_char, chars
+
+def make_classes(spaces, chars):
+	"""Group the first and last column signatures into classes that give identical kerning decisions"""
+	lefts = sorted(set(c[1] for c in chars))
+	rights = sorted(set(c[2] for c in chars if c[2] is not None and c[2] != 0))
+
+	# Right classes: signatures with the same row of decisions against every left signature are equivalent. Class 0 means zero data, i.e. no space.
+	right_class_of = {0: 0}
+	rows = {}
+	for r in rights:
+		row = tuple(kern(spaces, l, r) for l in lefts)
+		if row not in rows:
+			rows[row] = len(rows) + 1
+		right_class_of[r] = rows[row]
+	row_reps = [None] * len(rows)
+	for r in rights:
+		if row_reps[right_class_of[r] - 1] is None:
+			row_reps[right_class_of[r] - 1] = r
+
+	# Left classes: signatures with the same column of decisions against every right class are equivalent
+	left_class_of = {}
+	cols = {}
+	for l in lefts:
+		col = tuple(kern(spaces, l, r) for r in row_reps)
+		if col not in cols:
+			cols[col] = len(cols)
+		left_class_of[l] = cols[col]
+	col_reps = [None] * len(cols)
+	for l in lefts:
+		if col_reps[left_class_of[l]] is None:
+			col_reps[left_class_of[l]] = l
+
+	if len(rows) + 1 >= NO_CLASS_CHANGE or len(cols) > 256:
+		raise ValueError("Too many kerning classes")
+
+	bytes_per_row = (len(cols) + 7) // 8
+	table = []
+	for r in row_reps:
+		row_bytes = [0] * bytes_per_row
+		for lc, l in enumerate(col_reps):
+			if kern(spaces, l, r):
+				row_bytes[lc // 8] |= 1 << (lc % 8)
+		table.extend(row_bytes)
+	return left_class_of, right_class_of, len(cols), bytes_per_row, table
+
+def num_spaces(spaces, first, prev):
+	return 0 if prev == 0 else (spaces - 1 if kern(spaces, first, prev) else spaces)
+
+def verify(spaces, chars, left_class_of, right_class_of, bytes_per_row, table):
+	"""Check that the class tables give the same number of spaces as the original rule for every pair of characters"""
+	def lookup(c, prev_class):
+		if prev_class == 0:
+			return 0
+		lc = left_class_of[c[1]]
+		bit = (table[(prev_class - 1) * bytes_per_row + lc // 8] >> (lc % 8)) & 1
+		return spaces - 1 if bit else spaces
+	for p in chars:
+		if p[2] is None:
+			continue
+		for c in chars:
+			if lookup(c, right_class_of[p[2]]) != num_spaces(spaces, c[1], p[2]):
+				raise ValueError("Kerning table mismatch")
+
+def format_bytes(values, indent='\t'):
+	lines = []
+	for i in range(0, len(values), 16):
+		lines.append(indent + ' '.join('0x%02X,' % v for v in values[i:i + 16]))
+	return '\n'.join(lines)
+
+def main(argv):
+	if len(argv) < 2:
+		sys.stderr.write("Usage: fontmetrics.py font.cpp [font.cpp ...]\n")
+		return 1
+	out = []
+	out.append('/*\n * FontMetricsData.cpp\n *\n * Generated by fontmetrics.py from ' + ', '.join(os.path.basename(f) for f in argv[1:]) + '. Do not edit.\n */\n')
+	out.append('#include "Hardware/FontMetrics.hpp"\n')
+	names = []
+	for filename in argv[1:]:
+		name, data = read_font(filename)
+		spaces, first_char, last_char, chars = analyse(filename, data)
+		left_class_of, right_class_of, num_left, bytes_per_row, table = make_classes(spaces, chars)
+		verify(spaces, chars, left_class_of, right_class_of, bytes_per_row, table)
+		names.append(name)
+
+		out.append('extern const uint8_t %s[];\n' % name)
+		out.append('// %d characters, %d left kerning classes, %d right kerning classes' % (len(chars), num_left, len(table) // max(bytes_per_row, 1)))
+		out.append('static const uint8_t %s_numCols[] =\n{\n%s\n};\n' % (name, format_bytes([c[0] for c in chars])))
+		out.append('static const uint8_t %s_leftClass[] =\n{\n%s\n};\n' % (name, format_bytes([left_class_of[c[1]] for c in chars])))
+		out.append('static const uint8_t %s_rightClass[] =\n{\n%s\n};\n' % (name, format_bytes([NO_CLASS_CHANGE if c[2] is None else right_class_of[c[2]] for c in chars])))
+		out.append('static const uint8_t %s_kernTable[] =\n{\n%s\n};\n' % (name, format_bytes(table)))
+		out.append('static const FontMetrics %s_metrics =\n{\n\t%s, %s_numCols, %s_leftClass, %s_rightClass, %s_kernTable,\n\t0x%02X, 0x%02X, %d, %d\n};\n'
+					% (name, name, name, name, name, name, first_char, last_char, spaces, bytes_per_row))
+
+	out.append('const FontMetrics * const FontMetrics::fonts[] =\n{\n' + ''.join('\t&%s_metrics,\n' % n for n in names) + '};\n')
+	out.append('const size_t FontMetrics::numFonts = %d;\n' % len(names))
+	out.append('// End')
+	sys.stdout.write('\n'.join(out) + '\n')
+	return 0
+
+if __name__ == '__main__':
+	sys.exit(main(sys.argv))
+
+# End
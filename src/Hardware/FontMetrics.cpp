@@ -0,0 +1,65 @@
+/*
+ * FontMetrics.cpp
+ *
+ * Created: 16/10/2026 09:30:34
+ */ 
+
+#include "FontMetrics.hpp"
+
+// Get the metrics for a font, or nullptr if Fonts/fontmetrics.py has not generated tables for it.
+// Text in a font without tables is drawn and measured with the font's own spacing and no auto-kerning.
+/*static*/ const FontMetrics * null FontMetrics::Get(const uint8_t *font)
+{
+	for (size_t i = 0; i < numFonts; ++i)
+	{
+		if (fonts[i]->font == font)
+		{
+			return fonts[i];
+		}
+	}
+	return nullptr;
+}
+
+TextMeasurer::TextMeasurer(const uint8_t *f, uint16_t maxW)
+	: font(f), metrics(FontMetrics::Get(f)), kernClass(0), width(0), maxWidth(maxW)
+{
+}
+
+// Measure a UTF8 byte. This must give the same result as UTFT::write when no character translation is in use.
+size_t TextMeasurer::write(uint8_t c)
+{
+	const int ch = decoder.Process(c);
+	if (ch == Utf8Decoder::noChar)
+	{
+		return 0;
+	}
+
+	const uint8_t cc = (uint8_t)ch;
+	if (metrics != nullptr)
+	{
+		if (!metrics->Contains(cc))
+		{
+			return 0;
+		}
+		width += metrics->NumSpacesBefore(cc, kernClass) + metrics->GetNumCols(cc);
+		metrics->UpdateKernClass(cc, kernClass);
+	}
+	else
+	{
+		// No tables for this font, so take the width from the font data. The font header is x size, y size, spaces, first char, last char.
+		if (cc < font[3] || cc > font[4])
+		{
+			return 0;
+		}
+		const size_t bytesPerChar = (((font[1] + 7)/8) * font[0]) + 1;
+		width += ((kernClass != 0) ? font[2] : 0) + font[5 + (bytesPerChar * (cc - font[3]))];
+		kernClass = FontMetrics::noKerning;
+	}
+	if (width > maxWidth)
+	{
+		width = maxWidth;
+	}
+	return 1;
+}
+
+// End
@@ -0,0 +1,83 @@
+/*
+ * FontMetrics.hpp
+ *
+ * Created: 16/10/2026 09:30:12
+ */ 
+
+
+#ifndef FONTMETRICS_H_
+#define FONTMETRICS_H_
+
+#include "ecv.h"
+#include "Print.hpp"
+#include "Library/Utf8Decoder.hpp"
+
+// Width and auto-kerning data for all the characters in a font. These tables are generated from the font data by Fonts/fontmetrics.py
+// and held in flash memory. Instead of comparing column data, auto-kerning looks up a bit in a table indexed by the kerning class that
+// the preceding character left behind and the kerning class of the first column of the next character.
+struct FontMetrics
+{
+	static const uint8_t noClassChange = 0xFF;		// right class of a blank character, which doesn't change the kerning class
+	static const uint8_t noKerning = 1;				// kerning class left by any character in a font that we have no tables for
+
+	const uint8_t *font;							// the font that these metrics belong to
+	const uint8_t * array numCols;					// number of columns in each character, not including space columns
+	const uint8_t * array leftClass;				// kerning class of the first column of each character
+	const uint8_t * array rightClass;				// kerning class that each character leaves for the next one, 0 meaning no space is needed
+	const uint8_t * array kernTable;				// for each right class from 1 upwards, one bit per left class saying whether to kern
+	uint8_t firstChar, lastChar;
+	uint8_t spaces;									// number of space columns between characters before kerning
+	uint8_t bytesPerKernRow;
+
+	static const FontMetrics * null Get(const uint8_t *font);
+
+	bool Contains(uint8_t c) const { return c >= firstChar && c <= lastChar; }
+	uint8_t GetNumCols(uint8_t c) const pre(Contains(c)) { return numCols[c - firstChar]; }
+
+	// Return the number of space columns to put in front of character c if the preceding character left kerning class prevClass.
+	// Class 0 means that we are at the start of the text or the preceding data was blank, so no space is needed.
+	uint8_t NumSpacesBefore(uint8_t c, uint8_t prevClass) const pre(Contains(c))
+	{
+		if (prevClass == 0)
+		{
+			return 0;
+		}
+		const uint8_t lc = leftClass[c - firstChar];
+		const bool kern = ((kernTable[(prevClass - 1) * bytesPerKernRow + lc/8] >> (lc % 8)) & 1u) != 0;
+		return (kern) ? spaces - 1 : spaces;
+	}
+
+	// Update the kerning class after character c has been written
+	void UpdateKernClass(uint8_t c, uint8_t& kernClass) const pre(Contains(c))
+	{
+		const uint8_t rc = rightClass[c - firstChar];
+		if (rc != noClassChange)
+		{
+			kernClass = rc;
+		}
+	}
+
+	static const FontMetrics * const fonts[];		// the fonts that we have tables for, defined in the generated file
+	static const size_t numFonts;
+};
+
+// Class to measure how much width some text needs, by 'printing' it without touching the display
+class TextMeasurer : public Print
+{
+public:
+	TextMeasurer(const uint8_t *font, uint16_t maxWidth);
+	size_t write(uint8_t c) override;
+	using Print::write;
+	uint16_t GetWidth() const { return width; }
+
+private:
+	const uint8_t *font;
+	const FontMetrics * null metrics;
+	uint8_t kernClass;
+	uint16_t width, maxWidth;
+	Utf8Decoder decoder;
+};
+
+#endif /* FONTMETRICS_H_ */
+
+// End
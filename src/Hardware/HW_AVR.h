@@ -4,6 +4,9 @@
 // *** Hardware specific functions ***
 void UTFT::LCD_Write_Bus(uint16_t VHL)
 {
+#ifdef UTFT_STATISTICS
+	++stats.busWrites;
+#endif
 #if 1
 	// inline code for speed
 	PIOA->PIO_ODSR = VHL;
@@ -15,8 +18,11 @@ void UTFT::LCD_Write_Bus(uint16_t VHL)
 
 // Write the previous 16-bit data again the specified number of times.
 // Only supported in 9 and 16 bit modes. Used to speed up setting large blocks of pixels to the same colour. 
-void UTFT::LCD_Write_Again(uint16_t num)
+void UTFT::LCD_Write_Again(uint32_t num)
 {   
+#ifdef UTFT_STATISTICS
+	stats.busWrites += num;
+#endif
 	while (num != 0)
 	{
 		portWR.pulseLow();
@@ -9,6 +9,8 @@
 #include "asf.h"
 #include "SerialIo.hpp"
 #include "Library/Vector.hpp"
+#include "Library/DmaReceiveBuffer.hpp"
+#include "Library/JsonValue.hpp"
 #include "PanelDue.hpp"
 
 namespace SerialIo
@@ -23,9 +25,33 @@ namespace SerialIo
 	const char* array trCircle =		"A\xC5"                                         "a\xE5"                                        ;
 	const char* array trCedilla =		"C\xC7" "c\xE7";
 
+	// Transmit data. The main loop puts characters in the buffer and the UART interrupt sends them, so that the main loop can
+	// carry on sampling the touch screen and refreshing the display while a command is being sent.
+	// The buffer is big enough for several of the longest commands we send (a file command with a long path), so it only fills up
+	// if commands are issued faster than the serial line can carry them. If it does fill up, RawSendChar waits for the interrupt to make room.
+	// We never discard characters, because that would corrupt a command or its checksum.
+	const size_t txBufsize = 512;
+	static volatile char txBuffer[txBufsize];
+	static volatile size_t txNextIn = 0;			// only written by the main loop
+	static volatile size_t txNextOut = 0;			// only written by the ISR
+
+	// Receive data. The PDC stores received characters in rxBuffer, so we only get an interrupt when it has filled a block.
+	static DmaReceiveBuffer rxBuffer;
+	static volatile bool rxError = false;
+
+	static bool initialised = false;
+
 	// Initialize the serial I/O subsystem, or re-initialize it with a new baud rate
 	void Init(uint32_t baudRate)
 	{
+		// Let any pending output go at the old baud rate before we change it. When the ISR has emptied the buffer the last character may still
+		// be in the shift register, so wait for TXEMPTY too. That is never set while the transmitter is disabled, so we can't wait for it the first time.
+		while (txNextIn != txNextOut) { }
+		if (initialised)
+		{
+			while ((UART1->UART_SR & UART_SR_TXEMPTY) == 0) { }
+		}
+
 		uart_disable_interrupt(UART1, 0xFFFFFFFF);
 		pio_configure(PIOB, PIO_PERIPH_A, PIO_PB2 | PIO_PB3, 0);	// enable UART 1 pins
 	
@@ -34,19 +60,46 @@ namespace SerialIo
 		uartOptions.ul_baudrate = baudRate;
 		uartOptions.ul_mode = US_MR_PAR_NO;				// mode = normal, no parity
 		uart_init(UART1, &uartOptions);
+		initialised = true;
+
+		// Set up the PDC to receive into the first block with the second one queued. uart_init has disabled the PDC.
+		rxBuffer.Reset();
+		rxError = false;
+		UART1->UART_RPR = reinterpret_cast<uint32_t>(rxBuffer.GetBlock(0));
+		UART1->UART_RCR = DmaReceiveBuffer::blockSize;
+		UART1->UART_RNPR = reinterpret_cast<uint32_t>(rxBuffer.GetBlock(1));
+		UART1->UART_RNCR = DmaReceiveBuffer::blockSize;
+		UART1->UART_PTCR = UART_PTCR_RXTEN;
+
 		irq_register_handler(UART1_IRQn, 5);
-		uart_enable_interrupt(UART1, UART_IER_RXRDY | UART_IER_OVRE | UART_IER_FRAME);
+		uart_enable_interrupt(UART1, UART_IER_ENDRX | UART_IER_OVRE | UART_IER_FRAME);
 	}
 	
 	uint16_t numChars = 0;
 	uint8_t checksum = 0;
 	
-	// Send a character to the 3D printer.
-	// A typical command string is only about 12 characters long, which at 115200 baud takes just over 1ms to send.
-	// So there is no particular reason to use interrupts, and by so doing so we avoid having to handle buffer full situations.
+	// Queue a character to be sent to the 3D printer
 	void RawSendChar(char c)
 	{
-		while(uart_write(UART1, c) != 0) { }
+		const size_t temp = (txNextIn + 1) % txBufsize;
+		while (temp == txNextOut) { }			// if the buffer is full, wait for the ISR to send a character
+		txBuffer[txNextIn] = c;
+		txNextIn = temp;
+		uart_enable_interrupt(UART1, UART_IER_TXRDY);
+	}
+	
+	// Called by the ISR when the transmitter is ready for another character
+	void transmitChar()
+	{
+		if (txNextOut != txNextIn)
+		{
+			uart_write(UART1, txBuffer[txNextOut]);
+			txNextOut = (txNextOut + 1) % txBufsize;
+		}
+		else
+		{
+			uart_disable_interrupt(UART1, UART_IDR_TXRDY);	// nothing left to send
+		}
 	}
 	
 	void SendCharAndChecksum(char c)
@@ -137,13 +190,6 @@ namespace SerialIo
 		SendChar((char)((char)i + '0'));
 	}
 
-	// Receive data processing
-	const size_t rxBufsize = 2048;
-	static volatile char rxBuffer[rxBufsize];
-	static volatile size_t nextIn = 0;
-	static size_t nextOut = 0;
-	static bool inError = false;
-	
 	// Enumeration to represent the json parsing state.
 	// We don't allow nested objects or nested arrays, so we don't need a state stack.
 	// An additional variable elementCount is 0 if we are not in an array, else the number of elements we have found (including the current one)
@@ -165,30 +211,68 @@ namespace SerialIo
 	
 	JsonState state = jsBegin;
 	
-	String<20> fieldId;
-	String<100> fieldVal;
+	// Values are not copied out of the receive buffer. Instead we record where the current token starts, and when we reach the end of it
+	// we pass the characters to ProcessReceivedValue where they are. Only a token that wraps round the end of the receive buffer is copied, to valueScratch.
+	// When we reach the end of an ID we look up the event that handles it, so we don't need to keep the ID.
+	const size_t maxIdLength = 20;
+	const size_t valueScratchSize = 128;
+
+	static ReceivedDataEvent fieldEvent = rcvUnknown;
+	static uint32_t idHash;
+	static char valueScratch[valueScratchSize];
+	static uint32_t charPos;					// total receive buffer position of the character being processed
+	static uint32_t bytesWritten;				// total number of characters written to the receive buffer when CheckInput fetched it
+	static uint32_t tokenStart;					// total receive buffer position of the start of the current ID or value
+	static bool hadEscape, hadNonAscii;			// true if the current string value needs escape sequences or combining characters processed
 	int arrayElems = -1;
 	
-	static void ProcessField()
+	static void StartToken(uint32_t pos)
 	{
-		ProcessReceivedValue(fieldId.c_str(), fieldVal.c_str(), arrayElems);
-		fieldVal.clear();
+		tokenStart = pos;
+		hadEscape = hadNonAscii = false;
 	}
-	
-	static void EndArray()
+
+	// Replace escape sequences in a string value in place and return the new length
+	static size_t Unescape(char * array s, size_t len)
 	{
-		ProcessArrayLength(fieldId.c_str(), arrayElems);
-		arrayElems = -1;
+		size_t j = 0;
+		for (size_t i = 0; i < len; ++i)
+		{
+			char c = s[i];
+			if (c == '\\' && i + 1 < len)
+			{
+				c = s[++i];
+				switch (c)
+				{
+				case '"':
+				case '\\':
+				case '/':
+					break;
+				case 'n':
+				case 't':
+					c = ' ';			// replace newline and tab by space
+					break;
+				case 'b':
+				case 'f':
+				case 'r':
+				default:
+					continue;
+				}
+			}
+			s[j++] = c;
+		}
+		s[j] = 0;
+		return j;
 	}
-	
-	// Look for combining characters in the string value and convert them if possible
-	static void ConvertUnicode()
+
+	// Look for combining characters in a string value and convert them in place if possible. Return the new length.
+	static size_t ConvertUnicode(char * array s, size_t len)
 	{
 		unsigned int numContinuationBytesLeft = 0;
 		uint32_t charVal;
-		for (size_t i = 0; i < fieldVal.size(); )
+		for (size_t i = 0; i < len; )
 		{
-			const unsigned char c = fieldVal[i++];
+			const unsigned char c = s[i++];
 			if (numContinuationBytesLeft == 0)
 			{
 				if (c >= 0x80)
@@ -259,7 +343,7 @@ namespace SerialIo
 					// The diacritical marks are in the range 03xx so they are encoded as 2 UTF8 bytes.
 					if (trtab != nullptr && i > 2)
 					{
-						const char c2 = fieldVal[i - 3];
+						const char c2 = s[i - 3];
 						while (*trtab != 0 && *trtab != c2)
 						{
 							trtab += 2;
@@ -268,9 +352,10 @@ namespace SerialIo
 						{
 							// Get he translated character and encode it as 2 ITF8 bytes
 							const unsigned char c3 = trtab[1];
-							fieldVal[i - 3] = (c3 >> 6) | 0xC0;
-							fieldVal[i - 2] = (c3 & 0x3F) | 0x80;
-							fieldVal.erase(i - 1);
+							s[i - 3] = (c3 >> 6) | 0xC0;
+							s[i - 2] = (c3 & 0x3F) | 0x80;
+							memmove(s + i - 1, s + i, len - i + 1);		// remove the second byte of the combining character, and move the null terminator too
+							--len;
 							--i;
 						}
 					}
@@ -282,390 +367,415 @@ namespace SerialIo
 				numContinuationBytesLeft = 0;
 			}
 		}
+		return len;
 	}
-	
-	void CheckInput()
+
+	// Pass the value that ends at the current character to ProcessReceivedValue
+	static void ProcessField()
 	{
-		while (nextIn != nextOut)
+		// Ignore values that we don't handle, and values so long that the start of them has been overwritten
+		if (fieldEvent != rcvUnknown && rxBuffer.IsAvailable(tokenStart, bytesWritten))
 		{
-			char c = rxBuffer[nextOut];
-			nextOut = (nextOut + 1) % rxBufsize;
-			if (c == '\n')
+			size_t len = charPos - tokenStart;
+			char * array val = rxBuffer.GetToken(tokenStart, len, valueScratch, valueScratchSize);
+			val[len] = 0;						// this replaces the character that ended the value, which we have finished with
+			if (hadEscape)
 			{
-				state = jsBegin;		// abandon current parse (if any) and start again
+				len = Unescape(val, len);
 			}
-			else
+			if (hadNonAscii)
 			{
-				switch(state)
+				len = ConvertUnicode(val, len);
+			}
+			ProcessReceivedValue(fieldEvent, JsonValue(val, len), arrayElems);
+		}
+	}
+	
+	static void EndArray()
+	{
+		ProcessArrayLength(fieldEvent, arrayElems);
+		arrayElems = -1;
+	}
+	
+	// Process a received character
+	static void ProcessChar(char c)
+	{
+		if (c == '\n')
+		{
+			state = jsBegin;		// abandon current parse (if any) and start again
+		}
+		else
+		{
+			switch(state)
+			{
+			case jsBegin:			// initial state, expecting '{'
+				if (c == '{')
 				{
-				case jsBegin:			// initial state, expecting '{'
-					if (c == '{')
-					{
-						StartReceivedMessage();
-						state = jsExpectId;
-						fieldVal.clear();
-					}
-					break;
+					StartReceivedMessage();
+					state = jsExpectId;
+				}
+				break;
 
-				case jsExpectId:		// expecting a quoted ID
-					switch (c)
-					{
-					case ' ':
-						break;
-					case '"':
-						fieldId.clear();
-						state = jsId;
-						break;
-					case '}':
-						EndReceivedMessage();
-						state = jsBegin;
-						break;
-					default:
-						state = jsError;
-						break;
-					}
+			case jsExpectId:		// expecting a quoted ID
+				switch (c)
+				{
+				case ' ':
+					break;
+				case '"':
+					StartToken(charPos + 1);
+					idHash = JsonKey::initialHash;
+					state = jsId;
+					break;
+				case '}':
+					EndReceivedMessage();
+					state = jsBegin;
+					break;
+				default:
+					state = jsError;
 					break;
-						
-				case jsId:				// expecting an identifier, or in the middle of one
-					switch (c)
+				}
+				break;
+					
+			case jsId:				// expecting an identifier, or in the middle of one
+				switch (c)
+				{
+				case '"':
 					{
-					case '"':
-						state = jsHadId;
-						break;
-					default:
-						if (c >= ' ' && !fieldId.full())
+						const size_t len = charPos - tokenStart;
+						if (len <= maxIdLength)
 						{
-							fieldId.add(c);
+							char id[maxIdLength + 1];
+							rxBuffer.Copy(tokenStart, len, id);
+							id[len] = 0;
+							fieldEvent = FindReceivedDataEvent(idHash, id);
+							state = jsHadId;
 						}
 						else
 						{
 							state = jsError;
 						}
-						break;
 					}
 					break;
-	
-				case jsHadId:			// had a quoted identifier, expecting ':'
-					switch(c)
+				default:
+					if (c < ' ')
 					{
-					case ':':
-						arrayElems = -1;
-						state = jsVal;
-						break;
-					case ' ':
-						break;
-					default:
 						state = jsError;
-						break;
 					}
+					else
+					{
+						idHash = JsonKey::AddChar(idHash, c);
+					}
+					break;
+				}
+				break;
+
+			case jsHadId:			// had a quoted identifier, expecting ':'
+				switch(c)
+				{
+				case ':':
+					arrayElems = -1;
+					state = jsVal;
 					break;
+				case ' ':
+					break;
+				default:
+					state = jsError;
+					break;
+				}
+				break;
 
-				case jsVal:				// had ':', expecting value
-					switch(c)
+			case jsVal:				// had ':', expecting value
+				switch(c)
+				{
+				case ' ':
+					break;
+				case '"':
+					StartToken(charPos + 1);
+					state = jsStringVal;
+					break;
+				case '[':
+					if (arrayElems == -1)
 					{
-					case ' ':
-						break;
-					case '"':
-						fieldVal.clear();
-						state = jsStringVal;
-						break;
-					case '[':
-						if (arrayElems == -1)
-						{
-							arrayElems = 0;
-						}
-						else
-						{
-							state = jsError;
-						}
-						break;
-					case ']':
-						if (arrayElems == 0)
-						{
-							EndArray();
-							state = jsEndVal;
-						}
-						else
-						{
-							state = jsError;
-						}
-						break;
-					case '-':
-						fieldVal.clear();
-						fieldVal.add(c);
-						state = jsNegIntVal;
-						break;
-					default:
-						if (c >= '0' && c <= '9')
-						{
-							fieldVal.clear();
-							fieldVal.add(c);
-							state = jsIntVal;
-							break;
-						}
-						else
-						{
-							state = jsError;
-						}
+						arrayElems = 0;
+					}
+					else
+					{
+						state = jsError;
 					}
 					break;
-					
-				case jsStringVal:		// just had '"' and expecting a string value
-					switch (c)
+				case ']':
+					if (arrayElems == 0)
 					{
-					case '"':
-						ConvertUnicode();
-						ProcessField();
+						EndArray();
 						state = jsEndVal;
+					}
+					else
+					{
+						state = jsError;
+					}
+					break;
+				case '-':
+					StartToken(charPos);
+					state = jsNegIntVal;
+					break;
+				default:
+					if (c >= '0' && c <= '9')
+					{
+						StartToken(charPos);
+						state = jsIntVal;
 						break;
-					case '\\':
-						state = jsStringEscape;
-						break;
-					default:
-						if (c < ' ')
-						{
-							state = jsError;
-						}
-						else if (!fieldVal.full())
-						{
-							fieldVal.add(c);
-						}
-						break;
 					}
+					else
+					{
+						state = jsError;
+					}
+				}
+				break;
+				
+			case jsStringVal:		// just had '"' and expecting a string value
+				switch (c)
+				{
+				case '"':
+					ProcessField();
+					state = jsEndVal;
 					break;
-
-				case jsStringEscape:	// just had backslash in a string
-					if (!fieldVal.full())
+				case '\\':
+					hadEscape = true;
+					state = jsStringEscape;
+					break;
+				default:
+					if (c < ' ')
 					{
-						switch (c)
-						{
-						case '"':
-						case '\\':
-						case '/':
-							fieldVal.add(c);
-							break;
-						case 'n':
-						case 't':
-							fieldVal.add(' ');		// replace newline and tab by space
-							break;
-						case 'b':
-						case 'f':
-						case 'r':
-						default:
-							break;
-						}
+						state = jsError;
+					}
+					else if ((c & 0x80) != 0)
+					{
+						hadNonAscii = true;
 					}
-					state = jsStringVal;
 					break;
+				}
+				break;
 
-				case jsNegIntVal:		// had '-' so expecting a integer value
-					if (c >= '0' && c <= '9')
+			case jsStringEscape:	// just had backslash in a string, so this character doesn't end the string. Unescape will deal with it.
+				state = jsStringVal;
+				break;
+
+			case jsNegIntVal:		// had '-' so expecting a integer value
+				if (c >= '0' && c <= '9')
+				{
+					state = jsIntVal;
+				}
+				else
+				{
+					state = jsError;
+				}
+				break;
+				
+			case jsIntVal:			// receiving an integer value
+				switch(c)
+				{
+				case '.':
+					state = jsFracVal;
+					break;
+				case ',':
+					ProcessField();
+					if (arrayElems >= 0)
 					{
-						fieldVal.add(c);
-						state = jsIntVal;
+						++arrayElems;
+						state = jsVal;
+					}
+					else
+					{
+						state = jsExpectId;
+					}
+					break;					
+				case ']':
+					if (arrayElems >= 0)
+					{
+						ProcessField();
+						++arrayElems;
+						EndArray();
+						state = jsEndVal;
 					}
 					else
 					{
 						state = jsError;
 					}
 					break;
-					
-				case jsIntVal:			// receiving an integer value
-					switch(c)
+				case '}':
+					if (arrayElems == -1)
 					{
-					case '.':
-						if (fieldVal.full())
-						{
-							state = jsError;
-						}
-						else
-						{
-							fieldVal.add(c);
-							state = jsFracVal;
-						}
-						break;
-					case ',':
 						ProcessField();
-						if (arrayElems >= 0)
-						{
-							++arrayElems;
-							state = jsVal;
-						}
-						else
-						{
-							state = jsExpectId;
-						}
-						break;					
-					case ']':
-						if (arrayElems >= 0)
-						{
-							ProcessField();
-							++arrayElems;
-							EndArray();
-							state = jsEndVal;
-						}
-						else
-						{
-							state = jsError;
-						}
-						break;
-					case '}':
-						if (arrayElems == -1)
-						{
-							ProcessField();
-							EndReceivedMessage();
-							state = jsBegin;
-						}
-						else
-						{
-							state = jsError;
-						}
-						break;
-					default:
-						if (c >= '0' && c <= '9' && !fieldVal.full())
-						{
-							fieldVal.add(c);
-						}
-						else
-						{
-							state = jsError;
-						}
-						break;
+						EndReceivedMessage();
+						state = jsBegin;
+					}
+					else
+					{
+						state = jsError;
 					}
 					break;
+				default:
+					if (c < '0' || c > '9')
+					{
+						state = jsError;
+					}
+					break;
+				}
+				break;
 
-				case jsFracVal:			// receiving a fractional value
-					switch(c)
+			case jsFracVal:			// receiving a fractional value
+				switch(c)
+				{
+				case ',':
+					ProcessField();
+					if (arrayElems >= 0)
+					{
+						++arrayElems;
+						state = jsVal;
+					}
+					else
+					{
+						state = jsExpectId;
+					}
+					break;
+				case ']':
+					if (arrayElems >= 0)
 					{
-					case ',':
 						ProcessField();
-						if (arrayElems >= 0)
-						{
-							++arrayElems;
-							state = jsVal;
-						}
-						else
-						{
-							state = jsExpectId;
-						}
-						break;
-					case ']':
-						if (arrayElems >= 0)
-						{
-							ProcessField();
-							++arrayElems;
-							EndArray();
-							state = jsEndVal;
-						}
-						else
-						{
-							state = jsError;
-						}
-						break;
-					case '}':
-						if (arrayElems == -1)
-						{
-							ProcessField();
-							EndReceivedMessage();
-							state = jsBegin;
-						}
-						else
-						{
-							state = jsError;
-						}
-						break;
-					default:
-						if (c >= '0' && c <= '9' && !fieldVal.full())
-						{
-							fieldVal.add(c);
-						}
-						else
-						{
-							state = jsError;
-						}
-						break;
+						++arrayElems;
+						EndArray();
+						state = jsEndVal;
+					}
+					else
+					{
+						state = jsError;
 					}
 					break;
-
-				case jsEndVal:			// had the end of a string or array value, expecting comma or ] or }
-					switch (c)
+				case '}':
+					if (arrayElems == -1)
 					{
-					case ',':
-						if (arrayElems >= 0)
-						{
-							++arrayElems;
-							fieldVal.clear();
-							state = jsVal;
-						}
-						else
-						{
-							state = jsExpectId;
-						}
-						break;
-					case ']':
-						if (arrayElems >= 0)
-						{
-							++arrayElems;
-							EndArray();
-							state = jsEndVal;
-						}
-						else
-						{
-							state = jsError;
-						}
-						break;
-					case '}':
-						if (arrayElems == -1)
-						{
-							EndReceivedMessage();
-							state = jsBegin;
-						}
-						else
-						{
-							state = jsError;
-						}
-						break;
-					default:
-						break;
+						ProcessField();
+						EndReceivedMessage();
+						state = jsBegin;
+					}
+					else
+					{
+						state = jsError;
+					}
+					break;
+				default:
+					if (c < '0' || c > '9')
+					{
+						state = jsError;
 					}
 					break;
+				}
+				break;
 
-				case jsError:
-					// Ignore all characters. State will be reset to jsBegin at the start of this function when we receive a newline.
+			case jsEndVal:			// had the end of a string or array value, expecting comma or ] or }
+				switch (c)
+				{
+				case ',':
+					if (arrayElems >= 0)
+					{
+						++arrayElems;
+						state = jsVal;
+					}
+					else
+					{
+						state = jsExpectId;
+					}
+					break;
+				case ']':
+					if (arrayElems >= 0)
+					{
+						++arrayElems;
+						EndArray();
+						state = jsEndVal;
+					}
+					else
+					{
+						state = jsError;
+					}
+					break;
+				case '}':
+					if (arrayElems == -1)
+					{
+						EndReceivedMessage();
+						state = jsBegin;
+					}
+					else
+					{
+						state = jsError;
+					}
+					break;
+				default:
 					break;
 				}
+				break;
+
+			case jsError:
+				// Ignore all characters. State will be reset to jsBegin at the start of this function when we receive a newline.
+				break;
 			}
 		}
 	}
-	
-	// Called by the ISR to store a received character.
-	// If the buffer is full, we wait for the next end-of-line.
-	void receiveChar(char c)
+
+	// Called by the ISR when the PDC has filled a block and moved on to the next one
+	void receiveBlockDone()
 	{
-		if (c == '\n')
+		UART1->UART_RNPR = reinterpret_cast<uint32_t>(rxBuffer.BlockDone());
+		UART1->UART_RNCR = DmaReceiveBuffer::blockSize;		// this also clears ENDRX
+	}
+
+	// Called by the ISR to signify an error. We abandon the current message and wait for the next end of line.
+	void receiveError()
+	{
+		rxError = true;
+	}
+
+	// Process all the data received since the last call.
+	// The PDC doesn't tell us when the line goes idle with a block partly filled, so we read the part of the block that it has filled so far.
+	void CheckInput()
+	{
+		// The PDC keeps running while interrupts are disabled. If it finishes a block after we read RCR then we see ENDRX and read RCR again.
+		irqflags_t flags = cpu_irq_save();
+		size_t remaining = UART1->UART_RCR;
+		if ((UART1->UART_SR & UART_SR_ENDRX) != 0)
+		{
+			receiveBlockDone();				// the PDC has moved on to the next block but the ISR hasn't run yet
+			remaining = UART1->UART_RCR;
+		}
+		bytesWritten = rxBuffer.GetBytesWritten(remaining);
+		cpu_irq_restore(flags);
+
+		if (rxError)
 		{
-			inError = false;
+			rxError = false;
+			state = jsError;
 		}
-		if (!inError)
+
+		for (;;)
 		{
-			size_t temp = (nextIn + 1) % rxBufsize;
-			if (temp == nextOut)
+			const char * array data;
+			bool overrun;
+			charPos = rxBuffer.GetBytesRead();
+			size_t len = rxBuffer.GetData(bytesWritten, data, overrun);
+			if (overrun)
 			{
-				inError = true;
+				state = jsError;			// we have lost some data, so wait for the next end of line
 			}
-			else
+			if (len == 0)
 			{
-				rxBuffer[nextIn] = c;
-				nextIn = temp;
+				break;
 			}
+			do
+			{
+				ProcessChar(*data++);
+				++charPos;
+			} while (--len != 0);
 		}
 	}
-	
-	// Called by the ISR to signify an error. We wait for the next end of line.
-	void receiveError()
-	{
-		inError = true;
-	}
 }
 
 extern "C" {
@@ -674,10 +784,10 @@ extern "C" {
 	{
 		uint32_t status = UART1->UART_SR;
 
-		// Did we receive data ?
-		if ((status & UART_SR_RXRDY) == UART_SR_RXRDY)
+		// Has the PDC filled a receive block?
+		if ((status & UART_SR_ENDRX) == UART_SR_ENDRX)
 		{
-			SerialIo::receiveChar(UART1->UART_RHR);
+			SerialIo::receiveBlockDone();
 		}
 
 		// Acknowledge errors
@@ -685,7 +795,13 @@ extern "C" {
 		{
 			UART1->UART_CR |= UART_CR_RSTSTA;
 			SerialIo::receiveError();
-		}	
+		}
+
+		// Can we send data?
+		if ((status & UART_SR_TXRDY) == UART_SR_TXRDY)
+		{
+			SerialIo::transmitChar();
+		}
 	}
 	
 };
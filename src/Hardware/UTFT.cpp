@@ -48,9 +48,13 @@
 
 #include "asf.h"
 #include "UTFT.hpp"
-#include "memorysaver.h"
-#include "HW_AVR.h" 
+#ifdef UTFT_BUS_HEADER
+# include UTFT_BUS_HEADER
+#else
+# include "HW_AVR.h"
+#endif
 #include <cstring>			// for strchr
+#include "Library/Misc.hpp"
 
 template <class T> inline void swap(T& a, T& b)
 {
@@ -64,14 +68,29 @@ inline bool UTFT::isParallel() const
 	return displayTransferMode >= TModeLowestParallel;
 }
 
+// Return the display controller we are driving. If the build is for a single controller then this is a compile-time constant,
+// so the compiler resolves the switches on it and omits the code for the other controllers.
+inline DisplayType UTFT::getModel() const
+{
+#ifdef UTFT_CONTROLLER
+	return UTFT_CONTROLLER;
+#else
+	return displayModel;
+#endif
+}
+
 UTFT::UTFT(DisplayType model, TransferMode pmode, unsigned int RS, unsigned int WR, unsigned int CS, unsigned int RST, unsigned int SER_LATCH)
 	: fcolour(0xFFFF), bcolour(0), transparentBackground(false),
 	  displayModel(model), displayTransferMode(pmode),
 	  portRS(RS), portWR(WR), portCS(CS), portRST(RST), portSDA(RS), portSCL(SER_LATCH),
+	  textClipTop(0), textClipBottom(0xFFFF),
 	  translateFrom(NULL), translateTo(NULL),
-	  numContinuationBytesLeft(0)
+	  cmetrics(NULL)
 { 
-	switch (model)
+#ifdef UTFT_STATISTICS
+	resetStatistics();
+#endif
+	switch (getModel())
 	{
 		case HX8347A:
 		case SSD1289:
@@ -119,18 +138,27 @@ UTFT::UTFT(DisplayType model, TransferMode pmode, unsigned int RS, unsigned int
 
 inline void UTFT::LCD_Write_COM(uint8_t VL)  
 {   
+#ifdef UTFT_STATISTICS
+	++stats.commands;
+#endif
 	setRSLow();
 	LCD_Write_Bus((uint16_t)VL);
 }
 
 inline void UTFT::LCD_Write_DATA16(uint16_t VHL)
 {
+#ifdef UTFT_STATISTICS
+	++stats.pixels;
+#endif
 	setRSHigh();
 	LCD_Write_Bus(VHL);
 }
 
-inline void UTFT::LCD_Write_Repeated_DATA16(uint16_t VHL, uint16_t num)
+inline void UTFT::LCD_Write_Repeated_DATA16(uint16_t VHL, uint32_t num)
 {
+#ifdef UTFT_STATISTICS
+	stats.pixels += num;
+#endif
 	setRSHigh();
 	LCD_Write_Bus(VHL);
 	LCD_Write_Again(num - 1);
@@ -156,7 +184,8 @@ void UTFT::LCD_Write_DATA8(uint8_t VL)
 void UTFT::LCD_Write_COM_DATA16(uint8_t com1, uint16_t dat1)
 {
      LCD_Write_COM(com1);
-     LCD_Write_DATA16(dat1);
+     setRSHigh();					// don't use LCD_Write_DATA16 here because this is not pixel data
+     LCD_Write_Bus(dat1);
 }
 
 void UTFT::LCD_Write_COM_DATA8(uint8_t com1, uint8_t dat1)
@@ -170,8 +199,8 @@ void UTFT::InitLCD(DisplayOrientation po, bool is24bit)
 	orient = po;
 	textXpos = 0;
 	textYpos = 0;
-	lastCharColData = 0UL;
-	numContinuationBytesLeft = 0;
+	lastKernClass = 0;
+	decoder.Reset();
 
 	removeReset();
 	delay_ms(5); 
@@ -182,7 +211,7 @@ void UTFT::InitLCD(DisplayOrientation po, bool is24bit)
 
 	assertCS();
 
-	switch(displayModel)
+	switch(getModel())
 	{
 #ifndef DISABLE_HX8347A
 	case HX8347A:
@@ -1286,6 +1315,9 @@ void UTFT::InitLCD(DisplayOrientation po, bool is24bit)
 
 void UTFT::setXY(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 {
+#ifdef UTFT_STATISTICS
+	++stats.windows;
+#endif
 	if (orient & SwapXY)
 	{
 		swap(x1, y1);
@@ -1320,7 +1352,7 @@ void UTFT::setXY(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
 		}
 	}
 
-	switch(displayModel)
+	switch(getModel())
 	{
 #if !(defined(DISABLE_HX8347A) && defined(DISABLE_HX8352A))
 	case HX8347A:
@@ -1456,6 +1488,14 @@ void UTFT::clrXY()
 	}
 }
 
+// Fill a rectangle with the foreground colour. The coordinates must be in order.
+// The caller must assert CS before calling this and call clrXY afterwards, so that shapes made of several rectangles only do that once.
+void UTFT::fillArea(int x1, int y1, int x2, int y2)
+{
+	setXY(x1, y1, x2, y2);
+	LCD_Write_Repeated_DATA16(fcolour, (uint32_t)(x2 - x1 + 1) * (y2 - y1 + 1));
+}
+
 void UTFT::drawRect(int x1, int y1, int x2, int y2)
 {
 	if (x1 > x2)
@@ -1467,10 +1507,32 @@ void UTFT::drawRect(int x1, int y1, int x2, int y2)
 		swap(y1, y2);
 	}
 
-	drawHLine(x1, y1, x2-x1);
-	drawHLine(x1, y2, x2-x1);
-	drawVLine(x1, y1, y2-y1);
-	drawVLine(x2, y1, y2-y1);
+	assertCS();
+	fillArea(x1, y1, x2, y1);
+	if (y2 != y1)
+	{
+		fillArea(x1, y2, x2, y2);
+	}
+	if (y2 - y1 > 1)
+	{
+		fillArea(x1, y1 + 1, x1, y2 - 1);
+		fillArea(x2, y1 + 1, x2, y2 - 1);
+	}
+	removeCS();
+	clrXY();
+}
+
+// Corner shape of rounded rectangles. This is the number of pixels that the top rows are inset from the sides, starting with the top row.
+// The bottom rows are inset in the same way. The last entry must be 1.
+static const uint8_t roundRectInsets[] = { 2, 1 };
+const int roundRectRows = ARRAY_SIZE(roundRectInsets);
+
+// Return the inset of a row of a rounded rectangle with the specified number of rows
+static inline int roundRectInset(int row, int numRows)
+{
+	return (row < roundRectRows) ? roundRectInsets[row]
+			: (row >= numRows - roundRectRows) ? roundRectInsets[numRows - 1 - row]
+			: 0;
 }
 
 void UTFT::drawRoundRect(int x1, int y1, int x2, int y2)
@@ -1485,17 +1547,34 @@ void UTFT::drawRoundRect(int x1, int y1, int x2, int y2)
 	}
 	if ((x2-x1) > 4 && (y2-y1) > 4)
 	{
-		drawPixel(x1+1, y1+1);
-		drawPixel(x2-1, y1+1);
-		drawPixel(x1+1, y2-1);
-		drawPixel(x2-1, y2-1);
-		drawHLine(x1+2, y1, x2-x1-4);
-		drawHLine(x1+2, y2, x2-x1-4);
-		drawVLine(x1, y1+2, y2-y1-4);
-		drawVLine(x2, y1+2, y2-y1-4);
+		assertCS();
+
+		// Top and bottom edges
+		fillArea(x1 + roundRectInsets[0], y1, x2 - roundRectInsets[0], y1);
+		fillArea(x1 + roundRectInsets[0], y2, x2 - roundRectInsets[0], y2);
+
+		// Corners. In each row, draw from the inset of that row to just before the inset of the row nearer the edge.
+		for (int row = 1; row < roundRectRows; ++row)
+		{
+			const int inset = roundRectInsets[row], last = roundRectInsets[row - 1] - 1;
+			fillArea(x1 + inset, y1 + row, x1 + last, y1 + row);
+			fillArea(x2 - last, y1 + row, x2 - inset, y1 + row);
+			fillArea(x1 + inset, y2 - row, x1 + last, y2 - row);
+			fillArea(x2 - last, y2 - row, x2 - inset, y2 - row);
+		}
+
+		// Sides
+		fillArea(x1, y1 + roundRectRows, x1, y2 - roundRectRows);
+		fillArea(x2, y1 + roundRectRows, x2, y2 - roundRectRows);
+
+		removeCS();
+		clrXY();
 	}
 }
 
+// Fill a rectangle, optionally with a colour gradient.
+// If grad is nonzero then it is added to the colour after every gradChange lines. The lines are columns if SwapXY is set, otherwise rows.
+// We use one window for each band of lines of the same colour.
 void UTFT::fillRect(int x1, int y1, int x2, int y2, Colour grad, uint8_t gradChange)
 {
 	if (x1>x2)
@@ -1507,35 +1586,38 @@ void UTFT::fillRect(int x1, int y1, int x2, int y2, Colour grad, uint8_t gradCha
 		swap(y1, y2);
 	}
 
-	Colour fcolourSave = fcolour;
-	uint8_t gradCount = 0;
-	if (orient & SwapXY)
+	assertCS();
+	if (grad == 0 || gradChange == 0)
+	{
+		fillArea(x1, y1, x2, y2);
+	}
+	else
 	{
-		for (int i = x1; i <= x2; i++)
+		const Colour fcolourSave = fcolour;
+		if (orient & SwapXY)
 		{
-			drawVLine(i, y1, y2-y1);
-			if (++gradCount == gradChange)
+			for (int i = x1; i <= x2; i += gradChange)
 			{
-				gradCount = 0;
+				fillArea(i, y1, min<int>(i + gradChange - 1, x2), y2);
 				fcolour += grad;
 			}
 		}
-	}
-	else
-	{
-		for (int i = y1; i <= y2; i++)
+		else
 		{
-			drawHLine(x1, i, x2-x1);
-			if (++gradCount == gradChange)
+			for (int i = y1; i <= y2; i += gradChange)
 			{
-				gradCount = 0;
+				fillArea(x1, i, x2, min<int>(i + gradChange - 1, y2));
 				fcolour += grad;
 			}
 		}
+		fcolour = fcolourSave;
 	}
-	fcolour = fcolourSave;
+	removeCS();
+	clrXY();
 }
 
+// Fill a rounded rectangle, optionally with a colour gradient. If grad is nonzero then it is added to the colour after every gradChange rows.
+// We use one window for each group of adjacent rows that have the same colour and the same inset.
 void UTFT::fillRoundRect(int x1, int y1, int x2, int y2, Colour grad, uint8_t gradChange)
 {
 	if (x1>x2)
@@ -1549,91 +1631,95 @@ void UTFT::fillRoundRect(int x1, int y1, int x2, int y2, Colour grad, uint8_t gr
 
 	if ((x2-x1) > 4 && (y2-y1) > 4)
 	{
-		Colour fcolourSave = fcolour;
-		uint8_t gradCount = 0;
-
-		drawHLine(x1+2, y1, x2-x1-4);
-		++y1;
-		if (++gradCount == gradChange)
-		{
-			gradCount = 0;
-			fcolour += grad;
-		}
-		drawHLine(x1+1, y1, x2-x1-2);
-		++y1;
-		if (++gradCount == gradChange)
+		if (gradChange == 0)
 		{
-			gradCount = 0;
-			fcolour += grad;
+			grad = 0;
 		}
-		while (y1 + 1 < y2)
+		const Colour fcolourSave = fcolour;
+		const int numRows = y2 - y1 + 1;
+		assertCS();
+		int row = 0;
+		while (row < numRows)
 		{
-			drawHLine(x1, y1, x2-x1);
-			++y1;
-			if (++gradCount == gradChange)
+			const int inset = roundRectInset(row, numRows);
+			int lastRow = row;
+			while (lastRow + 1 < numRows
+					&& roundRectInset(lastRow + 1, numRows) == inset
+					&& (grad == 0 || (lastRow + 1) % gradChange != 0)
+				  )
+			{
+				++lastRow;
+			}
+			fillArea(x1 + inset, y1 + row, x2 - inset, y1 + lastRow);
+			row = lastRow + 1;
+			if (grad != 0 && row % gradChange == 0)
 			{
-				gradCount = 0;
 				fcolour += grad;
 			}
 		}
-		drawHLine(x1+1, y1, x2-x1-2);
-		++y1;
-		if (++gradCount == gradChange)
+		removeCS();
+		clrXY();
+		fcolour = fcolourSave;
+	}
+}
+
+// Circles are drawn as groups of rows that have the same half width. A pixel dx, dy from the centre is inside the circle if dx^2 + dy^2 - max(dx, dy) < radius^2,
+// which gives the same shape as the midpoint circle algorithm.
+// Return the half width of row dy of a circle, given the half width of a row nearer the centre. The result is -1 if the row is outside the circle.
+static inline int circleHalfWidth(int radiusSquared, int dy, int hw)
+{
+	while (hw >= 0 && hw * hw + dy * dy - max<int>(hw, dy) >= radiusSquared)
+	{
+		--hw;
+	}
+	return hw;
+}
+
+// Fill the parts of rows dy to lastDy above and below the centre of a circle whose horizontal distance from the centre is between inner and outer pixels
+void UTFT::fillCircleRows(int x, int y, int dy, int lastDy, int inner, int outer)
+{
+	// If dy is zero then the rows above and below the centre are contiguous, so we can use one window for both
+	const int yTop = (dy == 0) ? y - lastDy : y + dy;
+	for (int i = (dy == 0) ? 1 : 0; i < 2; ++i)
+	{
+		const int ya = (i == 0) ? y - lastDy : yTop, yb = (i == 0) ? y - dy : y + lastDy;
+		if (inner == 0)
 		{
-			gradCount = 0;
-			fcolour += grad;
+			fillArea(x - outer, ya, x + outer, yb);
+		}
+		else
+		{
+			fillArea(x - outer, ya, x - inner, yb);
+			fillArea(x + inner, ya, x + outer, yb);
 		}
-		drawHLine(x1+2, y1, x2-x1-4);
-		
-		fcolour = fcolourSave;
 	}
 }
 
 void UTFT::drawCircle(int x, int y, int radius)
 {
-	int f = 1 - radius;
-	int ddF_x = 1;
-	int ddF_y = -2 * radius;
-	int x1 = 0;
-	int y1 = radius;
-	
+	const int radiusSquared = radius * radius;
 	assertCS();
-	setXY(x, y + radius, x, y + radius);
-	LCD_Write_DATA16(fcolour);
-	setXY(x, y - radius, x, y - radius);
-	LCD_Write_DATA16(fcolour);
-	setXY(x + radius, y, x + radius, y);
-	LCD_Write_DATA16(fcolour);
-	setXY(x - radius, y, x - radius, y);
-	LCD_Write_DATA16(fcolour);
- 
-	while(x1 < y1)
+	int dy = 0, hw = radius;
+	while (dy <= radius)
 	{
-		if(f >= 0) 
+		// The outline in row dy goes from just beyond the half width of the next row out to the half width of this row, and is at least one pixel wide
+		int nextHw = circleHalfWidth(radiusSquared, dy + 1, hw);
+		const int inner = min<int>(nextHw + 1, hw);
+		int lastDy = dy;
+		while (lastDy < radius && nextHw == hw)
 		{
-			y1--;
-			ddF_y += 2;
-			f += ddF_y;
+			// The next row has the same half width, so it has the same outline if the row beyond it is no narrower than the rows before it by more than one pixel
+			const int hw2 = circleHalfWidth(radiusSquared, lastDy + 2, nextHw);
+			if (min<int>(hw2 + 1, nextHw) != inner)
+			{
+				break;
+			}
+			++lastDy;
+			nextHw = hw2;
 		}
-		x1++;
-		ddF_x += 2;
-		f += ddF_x;    
-		setXY(x + x1, y + y1, x + x1, y + y1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x - x1, y + y1, x - x1, y + y1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x + x1, y - y1, x + x1, y - y1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x - x1, y - y1, x - x1, y - y1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x + y1, y + x1, x + y1, y + x1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x - y1, y + x1, x - y1, y + x1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x + y1, y - x1, x + y1, y - x1);
-		LCD_Write_DATA16(fcolour);
-		setXY(x - y1, y - x1, x - y1, y - x1);
-		LCD_Write_DATA16(fcolour);
+		fillCircleRows(x, y, dy, lastDy, inner, hw);
+		dy = lastDy + 1;
+		hw = nextHw;
 	}
 	removeCS();
 	clrXY();
@@ -1641,39 +1727,19 @@ void UTFT::drawCircle(int x, int y, int radius)
 
 void UTFT::fillCircle(int x, int y, int radius)
 {
-	int f = 1 - radius;
-	int ddF_x = 1;
-	int ddF_y = -2 * radius;
-	int x1 = 0;
-	int y1 = radius;
-	
+	const int radiusSquared = radius * radius;
 	assertCS();
-	setXY(x, y + radius, x, y + radius);
-	LCD_Write_DATA16(fcolour);
-	setXY(x, y - radius, x, y - radius);
-	LCD_Write_DATA16(fcolour);
-	setXY(x - radius, y, x + radius, y);
-	LCD_Write_Repeated_DATA16(fcolour, radius + radius);
- 
-	while(x1 < y1)
+	int dy = 0, hw = radius;
+	while (dy <= radius)
 	{
-		if(f >= 0) 
+		int lastDy = dy;
+		while (lastDy < radius && circleHalfWidth(radiusSquared, lastDy + 1, hw) == hw)
 		{
-			y1--;
-			ddF_y += 2;
-			f += ddF_y;
+			++lastDy;
 		}
-		x1++;
-		ddF_x += 2;
-		f += ddF_x;    
-		setXY(x - x1, y + y1, x + x1, y + y1);
-		LCD_Write_Repeated_DATA16(fcolour, x1 + x1);
-		setXY(x - x1, y - y1, x + x1, y - y1);
-		LCD_Write_Repeated_DATA16(fcolour, x1 + x1);
-		setXY(x - y1, y + x1, x + y1, y + x1);
-		LCD_Write_Repeated_DATA16(fcolour, y1 + y1);
-		setXY(x - y1, y - x1, x + y1, y - x1);
-		LCD_Write_Repeated_DATA16(fcolour, y1 + y1);
+		fillCircleRows(x, y, dy, lastDy, 0, hw);
+		dy = lastDy + 1;
+		hw = circleHalfWidth(radiusSquared, dy, hw);
 	}
 	removeCS();
 	clrXY();
@@ -1758,8 +1824,7 @@ void UTFT::drawLine(int x1, int y1, int x2, int y2)
 void UTFT::drawHLine(int x, int y, int len)
 {
 	assertCS();
-	setXY(x, y, x+len, y);
-	LCD_Write_Repeated_DATA16(fcolour, len + 1);
+	fillArea(x, y, x + len, y);
 	removeCS();
 	clrXY();
 }
@@ -1767,8 +1832,7 @@ void UTFT::drawHLine(int x, int y, int len)
 void UTFT::drawVLine(int x, int y, int len)
 {
 	assertCS();
-	setXY(x, y, x, y+len);
-	LCD_Write_Repeated_DATA16(fcolour, len + 1);
+	fillArea(x, y, x, y + len);
 	removeCS();
 	clrXY();
 }
@@ -1780,7 +1844,7 @@ void UTFT::setTextPos(uint16_t x, uint16_t y, uint16_t rm)
 	textYpos = y;
 	uint16_t xSize = (orient & SwapXY) ? disp_y_size : disp_x_size;
 	textRightMargin = (rm > xSize) ? xSize + 1 : rm;
-    lastCharColData = 0UL;    // flag that we just set the cursor position, so no space before next character
+    lastKernClass = 0;    // flag that we just set the cursor position, so no space before next character
 }
 
 size_t UTFT::print(const char *s, uint16_t x, uint16_t y, uint16_t rm)
@@ -1791,90 +1855,96 @@ size_t UTFT::print(const char *s, uint16_t x, uint16_t y, uint16_t rm)
 
 void UTFT::clearToMargin()
 {
-	if (textXpos < textRightMargin)
+	uint8_t firstRow, ySize;
+	if (textXpos < textRightMargin && getTextRows(firstRow, ySize))
 	{
-		uint8_t ySize = cfont.y_size;
-		if (textYpos + ySize > disp_y_size)
-		{
-			ySize = disp_y_size + 1 - textYpos;
-		}
-
 		assertCS();		
-		setXY(textXpos, textYpos, textRightMargin - 1, textYpos + ySize - 1);
-		LCD_Write_Repeated_DATA16(bcolour, textRightMargin - textXpos, ySize);
+		setXY(textXpos, textYpos + firstRow, textRightMargin - 1, textYpos + ySize - 1);
+		LCD_Write_Repeated_DATA16(bcolour, textRightMargin - textXpos, ySize - firstRow);
 		removeCS();
 		clrXY();
 	}
 }
 
+// Find which rows of the current font are inside the display and the text clipping rows when the text is at textYpos.
+// The rows to draw are firstRow up to but not including endRow. Return false if there are none.
+bool UTFT::getTextRows(uint8_t& firstRow, uint8_t& endRow) const
+{
+	const uint16_t bottom = min<uint16_t>(textClipBottom, disp_y_size);
+	if (textYpos > bottom)
+	{
+		return false;
+	}
+	endRow = (textYpos + cfont.y_size > bottom) ? bottom + 1 - textYpos : cfont.y_size;
+	firstRow = (textYpos >= textClipTop) ? 0 : (textClipTop - textYpos < endRow) ? textClipTop - textYpos : endRow;
+	return firstRow < endRow;
+}
+
 // Write a UTF8 byte.
-// If textYpos is off the end of the display, then don't write anything, just update textXpos and lastCharColData
+// If textYpos is off the end of the display, then don't write anything, just update textXpos and lastKernClass
 size_t UTFT::write(uint8_t c)
 {
-	if (numContinuationBytesLeft == 0)
+	const int ch = decoder.Process(c);
+	return (ch == Utf8Decoder::noChar) ? 0 : writeNative((uint8_t)ch);
+}
+
+// Add a run of pixels of the same colour to the pending output. Used to coalesce pixels when rendering glyphs.
+inline void UTFT::addRun(Colour c, uint16_t num)
+{
+	if (c != runColour)
 	{
-		if (c < 0x80)
-		{
-			return writeNative(c);
-		}
-		else if ((c & 0xE0) == 0xC0)
-		{
-			charVal = (uint32_t)(c & 0x1F);
-			numContinuationBytesLeft = 1;
-			return 0;
-		}
-		else if ((c & 0xF0) == 0xE0)
-		{
-			charVal = (uint32_t)(c & 0x0F);
-			numContinuationBytesLeft = 2;
-			return 0;
-		}
-		else if ((c & 0xF8) == 0xF0)
-		{
-			charVal = (uint32_t)(c & 0x07);
-			numContinuationBytesLeft = 3;
-			return 0;
-		}
-		else if ((c & 0xFC) == 0xF8)
-		{
-			charVal = (uint32_t)(c & 0x03);
-			numContinuationBytesLeft = 4;
-			return 0;
-		}
-		else if ((c & 0xFE) == 0xFC)
-		{
-			charVal = (uint32_t)(c & 0x01);
-			numContinuationBytesLeft = 5;
-			return 0;
-		}
-		else
-		{
-			return writeNative(0x7F);
-		}
+		flushRun();
+		runColour = c;
 	}
-	else if ((c & 0xC0) == 0x80)
+	runLength += num;
+}
+
+// Send any pending run of pixels to the display
+inline void UTFT::flushRun()
+{
+	if (runLength != 0)
 	{
-		charVal = (charVal << 6) | (c & 0x3F);
-		--numContinuationBytesLeft;
-		if (numContinuationBytesLeft == 0)
-		{
-			return writeNative((charVal < 0x100) ? (uint8_t)charVal : 0x7F);
-		}
-		else
+		LCD_Write_Repeated_DATA16(runColour, runLength);
+		runLength = 0;
+	}
+}
+
+// Add the pixels of one column of a character to the pending output as runs of foreground and background pixels.
+// Bit 0 of colData is the top pixel. The pixels are generated in the order that the display writes them, which is bottom to top if InvertText is set.
+void UTFT::addColumnRuns(uint32_t colData, uint8_t ySize)
+{
+	if (orient & InvertText)
+	{
+		uint32_t bits = colData << (32 - ySize);		// move the bottom pixel to bit 31
+		uint8_t left = ySize;
+		while (left != 0)
 		{
-			return 0;
+			const bool isSet = (bits & 0x80000000) != 0;
+			const uint32_t runBits = (isSet) ? ~bits : bits;
+			const uint8_t num = min<uint8_t>((runBits == 0) ? 32 : __builtin_clz(runBits), left);
+			addRun((isSet) ? fcolour : bcolour, num);
+			bits = (num == 32) ? 0 : bits << num;
+			left -= num;
 		}
 	}
 	else
 	{
-		// Bad UTF8 state
-		numContinuationBytesLeft = 0;
-		return writeNative(0x7F);
+		uint32_t bits = colData;
+		uint8_t left = ySize;
+		while (left != 0)
+		{
+			const bool isSet = (bits & 1u) != 0;
+			const uint32_t runBits = (isSet) ? ~bits : bits;
+			const uint8_t num = min<uint8_t>((runBits == 0) ? 32 : __builtin_ctz(runBits), left);
+			addRun((isSet) ? fcolour : bcolour, num);
+			bits = (num == 32) ? 0 : bits >> num;
+			left -= num;
+		}
 	}
 }
 
 // Write a character.
-// If textYpos is off the end of the display, then don't write anything, just update textXpos and lastCharColData
+// If textYpos is off the end of the display, then don't write anything, just update textXpos and lastKernClass
 size_t UTFT::writeNative(uint8_t c)
 {
 	if (translateFrom != 0)
@@ -1891,133 +1961,120 @@ size_t UTFT::writeNative(uint8_t c)
 		return 0;
     }
     
-	uint8_t ySize = cfont.y_size;
-    const uint8_t bytesPerColumn = (ySize + 7)/8;
-	if (textYpos > disp_y_size)
-	{
-		ySize = 0;
-	}
-	else if (textYpos + ySize > disp_y_size)
+    const uint8_t bytesPerColumn = (cfont.y_size + 7)/8;
+
+	// Find the rows of the character that we need to draw. We draw rows firstRow to ySize - 1.
+	uint8_t firstRow, ySize;
+	if (!getTextRows(firstRow, ySize))
 	{
-		ySize = disp_y_size + 1 - textYpos;
+		firstRow = ySize = 0;
 	}
+	const uint8_t numRows = ySize - firstRow;
     const uint8_t bytesPerChar = (bytesPerColumn * cfont.x_size) + 1;
     const uint8_t *fontPtr = (const uint8_t*)cfont.font + (bytesPerChar * (c - cfont.firstChar));
     
-	const uint32_t cmask = (1UL << cfont.y_size) - 1;
-    
     uint8_t nCols = *(uint8_t*)(fontPtr++);
-	assertCS();
-	
-	if (lastCharColData != 0)	// if we have written anything other than spaces
-	{
-		uint8_t numSpaces = cfont.spaces;
 
-		// Decide whether to add the full number of space columns first (auto-kerning)
-		// We don't add a space column before a space character.
-		// We add a space column after a space character if we would have added one between the preceding and following characters.
-		uint32_t thisCharColData = *(uint32_t*)(fontPtr) & cmask;    // atmega328p is little-endian
-		if (thisCharColData == 0)  // for characters with deliberate space row at the start, e.g. decimal point
-		{
-			thisCharColData = *(uint32_t*)(fontPtr + bytesPerColumn) & cmask;	// get the next column instead
-		}
+	// Decide how many space columns to add first (auto-kerning, if we have tables for this font)
+	uint8_t numSpaces = (cmetrics != NULL) ? cmetrics->NumSpacesBefore(c, lastKernClass)
+						: (lastKernClass != 0) ? cfont.spaces
+							: 0;
 
-		bool kern = (numSpaces >= 2)
-						? ((thisCharColData & lastCharColData) == 0)
-						: (((thisCharColData | (thisCharColData << 1)) & (lastCharColData | (lastCharColData << 1))) == 0);
-		if (kern)
-		{
-			--numSpaces;	// kern the character pair
-		}
-		while (numSpaces != 0 && textXpos < textRightMargin)
-		{
-			// Add a single space column after the character
-			if (ySize != 0 && !transparentBackground)
-			{
-				setXY(textXpos, textYpos, textXpos, textYpos + ySize - 1);
-				LCD_Write_Repeated_DATA16(bcolour, ySize);
-			}
-			++textXpos;
-			--numSpaces;
-		}      
+	// Clip the space columns and the character columns to the right margin
+	const uint16_t available = (textXpos < textRightMargin) ? textRightMargin - textXpos : 0;
+	if (numSpaces > available)
+	{
+		numSpaces = available;
+	}
+	if (nCols > available - numSpaces)
+	{
+		nCols = available - numSpaces;
 	}
 
-    while (nCols != 0 && textXpos < textRightMargin)
-    {
-		uint32_t colData = *(uint32_t*)(fontPtr);
-		fontPtr += bytesPerColumn;
-		if (colData != 0)
-		{
-			lastCharColData = colData & cmask;
-		}
-		if (ySize != 0)
+	if (numRows != 0 && numSpaces + nCols != 0)
+	{
+		assertCS();
+		if (transparentBackground)
 		{
-			bool doSetXY = true;
-			if (orient & InvertText)
+			// We can't skip background pixels within an address window, so set a window for each run of foreground pixels in each column
+			for (uint8_t col = 0; col < nCols; ++col)
 			{
-				uint32_t mask = 1u << (ySize - 1);
-				for (uint8_t i = 0; i < ySize; ++i)
+				const uint16_t x = textXpos + numSpaces + col;
+				uint32_t bits = *(const uint32_t*)(fontPtr + col * bytesPerColumn) >> firstRow;
+				uint8_t row = firstRow;
+				while (row < ySize)
 				{
-					if (colData & mask)
-					{
-						if (doSetXY)
-						{
-							setXY(textXpos, textYpos, textXpos, textYpos + ySize - i - 1);
-							doSetXY = false;
-						}
-						LCD_Write_DATA16(fcolour);
-					}
-					else if (transparentBackground)
+					if ((bits & 1u) == 0)
 					{
-						doSetXY = true;
+						const uint8_t numClear = (bits == 0) ? ySize - row : min<uint8_t>(__builtin_ctz(bits), ySize - row);
+						bits = (numClear == 32) ? 0 : bits >> numClear;
+						row += numClear;
 					}
 					else
 					{
-						if (doSetXY)
-						{
-							setXY(textXpos, textYpos, textXpos, textYpos + ySize - i - 1);
-							doSetXY = false;
-						}
-						LCD_Write_DATA16(bcolour);
+						const uint8_t numSet = min<uint8_t>((~bits == 0) ? 32 : __builtin_ctz(~bits), ySize - row);
+						setXY(x, textYpos + row, x, textYpos + row + numSet - 1);
+						LCD_Write_Repeated_DATA16(fcolour, numSet);
+						bits = (numSet == 32) ? 0 : bits >> numSet;
+						row += numSet;
 					}
-					colData <<= 1;
 				}
 			}
-			else
+		}
+		else
+		{
+			// Write the space columns and the character through a single address window, coalescing pixels of the same colour into runs
+			setXY(textXpos, textYpos + firstRow, textXpos + numSpaces + nCols - 1, textYpos + ySize - 1);
+			runColour = bcolour;
+			runLength = 0;
+			const uint8_t totalCols = numSpaces + nCols;
+			if (orient & SwapXY)
 			{
-				for (uint8_t i = 0; i < ySize; ++i)
+				// The display fills the window one column at a time, right to left if InvertBitmap is set
+				for (uint8_t i = 0; i < totalCols; ++i)
 				{
-					if (colData & 1u)
+					const uint8_t col = (orient & InvertBitmap) ? totalCols - 1 - i : i;
+					if (col < numSpaces)
 					{
-						if (doSetXY)
-						{
-							setXY(textXpos, textYpos + i, textXpos, textYpos + ySize - 1);
-							doSetXY = false;
-						}
-						LCD_Write_DATA16(fcolour);
+						addRun(bcolour, numRows);
 					}
-					else if (transparentBackground)
+					else
 					{
-						doSetXY = true;
+						addColumnRuns(*(const uint32_t*)(fontPtr + (col - numSpaces) * bytesPerColumn) >> firstRow, numRows);
 					}
-					else
+				}
+			}
+			else
+			{
+				// The display fills the window one row at a time, bottom to top if InvertText is set and right to left if InvertBitmap is set
+				for (uint8_t i = 0; i < numRows; ++i)
+				{
+					const uint8_t row = firstRow + ((orient & InvertText) ? numRows - 1 - i : i);
+					for (uint8_t j = 0; j < totalCols; ++j)
 					{
-						if (doSetXY)
-						{
-							setXY(textXpos, textYpos + i, textXpos, textYpos + ySize - 1);
-							doSetXY = false;
-						}
-						LCD_Write_DATA16(bcolour);
+						const uint8_t col = (orient & InvertBitmap) ? totalCols - 1 - j : j;
+						const bool isSet = col >= numSpaces && ((*(const uint32_t*)(fontPtr + (col - numSpaces) * bytesPerColumn) >> row) & 1u) != 0;
+						addRun((isSet) ? fcolour : bcolour, 1);
 					}
-					colData >>= 1;
 				}
 			}
+			flushRun();
 		}
-		--nCols;
-		++textXpos;
-    }
- 	removeCS();
-	clrXY();
+		removeCS();
+		clrXY();
+	}
+
+	// Record the kerning class that the character leaves, for auto-kerning the next character.
+	// If we clipped the character then this doesn't matter, because nothing more will be written until the text position is set again.
+	if (cmetrics != NULL)
+	{
+		cmetrics->UpdateKernClass(c, lastKernClass);
+	}
+	else
+	{
+		lastKernClass = FontMetrics::noKerning;
+	}
+	textXpos += numSpaces + nCols;
    
 	return 1;
 }
@@ -2039,6 +2096,7 @@ void UTFT::setFont(const uint8_t* font)
 	cfont.firstChar=fontbyte(3);
 	cfont.lastChar=fontbyte(4);
 	cfont.font += 5;
+	cmetrics = FontMetrics::Get(font);			// null if the font has no tables in Fonts/FontMetricsData.cpp, in which case we don't kern
 }
 
 void UTFT::drawBitmap(int x, int y, int sx, int sy, const uint16_t * data, int scale, bool byCols)
@@ -2084,87 +2142,434 @@ void UTFT::drawBitmap(int x, int y, int sx, int sy, const uint16_t * data, int s
 
 #ifndef DISABLE_BITMAP_ROTATE
 
-void UTFT::drawBitmap(int x, int y, int sx, int sy, uint16_t *data, int deg, int rox, int roy)
+// Sine of 0 to 90 degrees in 1 degree steps, scaled by 32768
+static const uint16_t sineTable[91] =
+{
+	0, 572, 1144, 1715, 2286, 2856, 3425, 3993, 4560, 5126,
+	5690, 6252, 6813, 7371, 7927, 8481, 9032, 9580, 10126, 10668,
+	11207, 11743, 12275, 12803, 13328, 13848, 14365, 14876, 15384, 15886,
+	16384, 16877, 17364, 17847, 18324, 18795, 19261, 19720, 20174, 20622,
+	21063, 21498, 21926, 22348, 22763, 23170, 23571, 23965, 24351, 24730,
+	25102, 25466, 25822, 26170, 26510, 26842, 27166, 27482, 27789, 28088,
+	28378, 28660, 28932, 29197, 29452, 29698, 29935, 30163, 30382, 30592,
+	30792, 30983, 31164, 31336, 31499, 31651, 31795, 31928, 32052, 32166,
+	32270, 32365, 32449, 32524, 32588, 32643, 32688, 32723, 32748, 32763,
+	32768
+};
+
+// Return the sine of an angle in degrees, scaled by 65536
+static int32_t fixedSin(int deg)
 {
-	double radian = deg*0.0175;  
+	deg %= 360;
+	if (deg < 0)
+	{
+		deg += 360;
+	}
+	return (deg <= 90) ? sineTable[deg] << 1
+			: (deg <= 180) ? sineTable[180 - deg] << 1
+			: (deg <= 270) ? -(sineTable[deg - 180] << 1)
+			: -(sineTable[360 - deg] << 1);
+}
+
+// Draw a bitmap rotated clockwise by 'deg' degrees about the point (rox, roy) of the bitmap. The bitmap data is stored one row at a time.
+// For each display pixel that the rotated bitmap may cover, we find the bitmap pixel that maps to it using fixed point arithmetic with 16 fraction bits.
+// Source coordinates include an extra half pixel, so that truncating them selects the nearest pixel.
+void UTFT::drawBitmap(int x, int y, int sx, int sy, const uint16_t *data, int deg, int rox, int roy)
+{
+	if (deg % 360 == 0)
+	{
+		drawBitmap(x, y, sx, sy, data, 1, false);
+		return;
+	}
 
-	if (deg==0)
+	const int32_t sinA = fixedSin(deg), cosA = fixedSin(deg + 90);
+	const int cx = x + rox, cy = y + roy;			// centre of rotation on the display
+
+	// Find the display area that the corners of the bitmap map to, and clip it to the display
+	int xmin = 0, xmax = 0, ymin = 0, ymax = 0;
+	for (unsigned int corner = 0; corner < 4; ++corner)
+	{
+		const int u = ((corner & 1) ? sx - 1 : 0) - rox, v = ((corner & 2) ? sy - 1 : 0) - roy;
+		const int px = (u * cosA - v * sinA + 0x8000) >> 16, py = (v * cosA + u * sinA + 0x8000) >> 16;
+		xmin = (corner == 0) ? px : min<int>(xmin, px);
+		xmax = (corner == 0) ? px : max<int>(xmax, px);
+		ymin = (corner == 0) ? py : min<int>(ymin, py);
+		ymax = (corner == 0) ? py : max<int>(ymax, py);
+	}
+	xmin = max<int>(xmin + cx, 0);
+	xmax = min<int>(xmax + cx, getDisplayXSize() - 1);
+	ymin = max<int>(ymin + cy, 0);
+	ymax = min<int>(ymax + cy, getDisplayYSize() - 1);
+	if (xmin > xmax || ymin > ymax)
 	{
-		drawBitmap(x, y, sx, sy, data);
+		return;
+	}
+
+	assertCS();
+	runLength = 0;
+	if (sinA == 0 || cosA == 0)
+	{
+		// Rotation by a multiple of 90 degrees. The rotated bitmap is a rectangle, so we write it through a single window in the order that the display fills it.
+		// The display moves along y first if SwapXY is set, else along x first. It moves backwards in y if InvertText is set, and backwards in x if InvertBitmap is set.
+		const int xStep = (orient & InvertBitmap) ? -1 : 1, yStep = (orient & InvertText) ? -1 : 1;
+		const int u = ((xStep < 0) ? xmax : xmin) - cx, v = ((yStep < 0) ? ymax : ymin) - cy;
+		int32_t fx = (rox << 16) + u * cosA + v * sinA + 0x8000, fy = (roy << 16) - u * sinA + v * cosA + 0x8000;
+
+		// Source steps for one display pixel along x and along y
+		const int32_t xStepFx = xStep * cosA, xStepFy = -xStep * sinA;
+		const int32_t yStepFx = yStep * sinA, yStepFy = yStep * cosA;
+		const bool yFirst = (orient & SwapXY) != 0;
+		const int32_t innerFx = (yFirst) ? yStepFx : xStepFx, innerFy = (yFirst) ? yStepFy : xStepFy;
+		const int32_t outerFx = (yFirst) ? xStepFx : yStepFx, outerFy = (yFirst) ? xStepFy : yStepFy;
+		const int numInner = (yFirst) ? ymax - ymin + 1 : xmax - xmin + 1;
+		const int numOuter = (yFirst) ? xmax - xmin + 1 : ymax - ymin + 1;
+
+		setXY(xmin, ymin, xmax, ymax);
+		for (int i = 0; i < numOuter; ++i)
+		{
+			int32_t gx = fx, gy = fy;
+			for (int j = 0; j < numInner; ++j)
+			{
+				addRun(data[(gy >> 16) * sx + (gx >> 16)], 1);
+				gx += innerFx;
+				gy += innerFy;
+			}
+			fx += outerFx;
+			fy += outerFy;
+		}
+		flushRun();
 	}
 	else
 	{
-		assertCS();
-		for (int ty=0; ty<sy; ty++)
+		// Walk each display row, using one window for the span of the row that the bitmap covers
+		const int32_t fxLimit = sx << 16, fyLimit = sy << 16;
+		for (int py = ymin; py <= ymax; ++py)
 		{
-			for (int tx=0; tx<sx; tx++)
+			// Source coordinates of the display pixel at the start of the row
+			const int u = xmin - cx, v = py - cy;
+			const int32_t fx0 = (rox << 16) + u * cosA + v * sinA + 0x8000, fy0 = (roy << 16) - u * sinA + v * cosA + 0x8000;
+
+			// Find the span of the row that maps to pixels in the bitmap. The bitmap is convex, so this is contiguous.
+			int first = 0, last = xmax - xmin;
+			int32_t fx = fx0, fy = fy0;
+			while (first <= last && (fx < 0 || fx >= fxLimit || fy < 0 || fy >= fyLimit))
 			{
-				uint16_t col = data[(ty*sx)+tx];
-
-				int newx=x+rox+(((tx-rox)*cos(radian))-((ty-roy)*sin(radian)));
-				int newy=y+roy+(((ty-roy)*cos(radian))+((tx-rox)*sin(radian)));
+				++first;
+				fx += cosA;
+				fy -= sinA;
+			}
+			fx = fx0 + last * cosA;
+			fy = fy0 - last * sinA;
+			while (last >= first && (fx < 0 || fx >= fxLimit || fy < 0 || fy >= fyLimit))
+			{
+				--last;
+				fx -= cosA;
+				fy += sinA;
+			}
 
-				setXY(newx, newy, newx, newy);
-				LCD_Write_DATA16(col);
+			if (first <= last)
+			{
+				// The display fills the span from right to left if InvertBitmap is set
+				setXY(xmin + first, py, xmin + last, py);
+				int32_t stepFx = cosA, stepFy = -sinA;
+				if (orient & InvertBitmap)
+				{
+					stepFx = -stepFx;
+					stepFy = -stepFy;
+				}
+				else
+				{
+					fx = fx0 + first * cosA;
+					fy = fy0 - first * sinA;
+				}
+				for (int i = first; i <= last; ++i)
+				{
+					addRun(data[(fy >> 16) * sx + (fx >> 16)], 1);
+					fx += stepFx;
+					fy += stepFy;
+				}
+				flushRun();
 			}
 		}
-		removeCS();
 	}
+	removeCS();
 	clrXY();
 }
 
 #endif
 
-// Draw a compressed bitmap. Data comprises alternate (repeat count - 1, data to write) pairs, both as 16-bit values.
-void UTFT::drawCompressedBitmap(int x, int y, int sx, int sy, const uint16_t *data)
+// Draw a bitmap supplied as runs of pixels of the same colour. The runs are in column order, i.e. each column from top to bottom,
+// starting with the leftmost column. Runs may continue from one column into the next.
+// RunSource must provide a function 'uint32_t GetRun(Colour& col)' that returns the length of the next run and its colour.
+template<class RunSource> void UTFT::drawRuns(int x, int y, int sx, int sy, RunSource& src)
 {
-//	int curY = y;
-	uint32_t count = 0;
-	uint16_t col = 0;
 	assertCS();
-	for (int tx = 0; tx < sx; tx++)
+	if ((orient & (SwapXY | InvertText)) == SwapXY)
 	{
-//		bool xySet = false;
-		for (int ty = 0; ty < sy; ty++)
+		// The display fills each column of a window from top to bottom, which is the order of the data.
+		// If InvertBitmap is clear then it fills the columns from left to right, so a window can cover several complete columns.
+		// Otherwise it fills them from right to left, so a window can only cover part of one column.
+		// We need a new window after skipping transparent pixels.
+		const bool windowPerColumn = (orient & InvertBitmap) != 0;
+		const uint32_t numPixels = (uint32_t)sx * sy;
+		uint32_t pos = 0, windowLeft = 0;
+		while (pos < numPixels)
 		{
-			//const int actualX = (orient & InvertBitmap) ? sx - tx - 1 : tx;
-			if (count == 0)
+			Colour col;
+			uint32_t runLeft = min<uint32_t>(src.GetRun(col), numPixels - pos);
+			if (transparentBackground && col == 0xFFFF)
 			{
-				count = *data++;
-				col = *data++;
+				pos += runLeft;
+				windowLeft = 0;
 			}
 			else
 			{
-				--count;
+				while (runLeft != 0)
+				{
+					if (windowLeft == 0)
+					{
+						const int tx = pos/sy, ty = pos % sy;
+						const int lastX = (windowPerColumn || ty != 0) ? tx : sx - 1;
+						setXY(x + tx, y + ty, x + lastX, y + sy - 1);
+						windowLeft = (uint32_t)(lastX + 1 - tx) * sy - ty;
+					}
+					const uint32_t num = min<uint32_t>(runLeft, windowLeft);
+					LCD_Write_Repeated_DATA16(col, num);
+					runLeft -= num;
+					windowLeft -= num;
+					pos += num;
+				}
 			}
-#if 1
-			setXY(tx, ty, tx, ty);
-#else
-			if (!xySet)
+		}
+	}
+	else
+	{
+		// The display fills a window in a different order from the data.
+		// So write each run as rectangles of a single colour: the part of the run in its first column, then any complete columns, then the part in its last column.
+		int tx = 0, ty = 0;
+		while (tx < sx)
+		{
+			Colour col;
+			uint32_t runLeft = src.GetRun(col);
+			const bool skip = transparentBackground && col == 0xFFFF;
+			while (runLeft != 0 && tx < sx)
 			{
-				if (orient & InvertBitmap)
+				if (ty == 0 && runLeft >= (uint32_t)sy)
 				{
-					setXY(x, curY, x + (sx - tx) - 1, curY);
+					const int numCols = min<int>(runLeft/sy, sx - tx);
+					if (!skip)
+					{
+						setXY(x + tx, y, x + tx + numCols - 1, y + sy - 1);
+						LCD_Write_Repeated_DATA16(col, (uint32_t)numCols * sy);
+					}
+					runLeft -= (uint32_t)numCols * sy;
+					tx += numCols;
 				}
 				else
 				{
-					setXY(x + tx, curY, x + sx - 1, curY);
+					const int numRows = min<int>(runLeft, sy - ty);
+					if (!skip)
+					{
+						setXY(x + tx, y + ty, x + tx, y + ty + numRows - 1);
+						LCD_Write_Repeated_DATA16(col, numRows);
+					}
+					runLeft -= numRows;
+					ty += numRows;
+					if (ty == sy)
+					{
+						ty = 0;
+						++tx;
+					}
 				}
-				xySet = true;
 			}
-#endif
-			LCD_Write_DATA16(col);
 		}
-//		++curY;
 	}
 	removeCS();
-	clrXY();	
+	clrXY();
+}
+
+// Source of runs for drawCompressedBitmap. Data comprises alternate (repeat count - 1, data to write) pairs, both as 16-bit values.
+class CompressedBitmapRuns
+{
+public:
+	CompressedBitmapRuns(const uint16_t *d) : data(d) { }
+
+	uint32_t GetRun(Colour& col)
+	{
+		const uint32_t num = (uint32_t)*data++ + 1;
+		col = *data++;
+		return num;
+	}
+
+private:
+	const uint16_t *data;
+};
+
+// Source of runs for drawPalettedBitmap. See UTFT.hpp for the data format.
+class PalettedBitmapRuns
+{
+public:
+	PalettedBitmapRuns(const uint8_t *d) : palette(d + 1), data(d + 1 + 2 * d[0]), literalsLeft(0) { }
+
+	uint32_t GetRun(Colour& col)
+	{
+		uint32_t num = 1;
+		if (literalsLeft != 0)
+		{
+			--literalsLeft;
+		}
+		else
+		{
+			const uint8_t control = *data++;
+			if (control & 0x80)
+			{
+				num = (control & 0x7F) + 1;
+			}
+			else
+			{
+				literalsLeft = control;
+			}
+		}
+		const uint8_t index = *data++;
+		col = palette[2 * index] | (palette[2 * index + 1] << 8);
+		return num;
+	}
+
+private:
+	const uint8_t *palette;
+	const uint8_t *data;
+	uint8_t literalsLeft;
+};
+
+// Draw a compressed bitmap. Data comprises alternate (repeat count - 1, data to write) pairs, both as 16-bit values.
+// The pixels are in column order, i.e. each column from top to bottom, starting with the leftmost column. Runs may continue from one column into the next.
+void UTFT::drawCompressedBitmap(int x, int y, int sx, int sy, const uint16_t *data)
+{
+	CompressedBitmapRuns runs(data);
+	drawRuns(x, y, sx, sy, runs);
+}
+
+#ifdef UTFT_READBACK
+
+// Read back an area of the display from the frame memory of the display controller and store it in the format used by drawCompressedBitmap,
+// so that it can be put back later, e.g. when a popup window that covers it is removed.
+// Return the number of 16-bit words stored, or zero if the controller can't be read or the buffer is too small.
+size_t UTFT::readCompressedBitmap(int x, int y, int sx, int sy, uint16_t *buffer, size_t bufferSize)
+{
+	if (getModel() != SSD1963_480 && getModel() != SSD1963_800)
+	{
+		return 0;
+	}
+
+	size_t used = 0;
+	assertCS();
+	for (int col = 0; col < sx; ++col)
+	{
+		// Read one column at a time, so that whatever the orientation the pixels come back in column order, possibly reversed
+		setXY(x + col, y, x + col, y + sy - 1);
+		LCD_Write_COM(0x2E);			// read memory start
+		const size_t columnStart = used;
+		for (int row = 0; row < sy; ++row)
+		{
+			const Colour c = LCD_Read_Bus();
+			if (used != columnStart && buffer[used - 1] == c && buffer[used - 2] != 0xFFFF)
+			{
+				++buffer[used - 2];
+			}
+			else if (used + 2 <= bufferSize)
+			{
+				buffer[used++] = 0;
+				buffer[used++] = c;
+			}
+			else
+			{
+				removeCS();
+				clrXY();
+				return 0;
+			}
+		}
+
+		if (orient & InvertText)
+		{
+			// The column was read bottom to top, so reverse the order of its runs
+			for (size_t i = columnStart, j = used - 2; i < j; i += 2, j -= 2)
+			{
+				swap(buffer[i], buffer[j]);
+				swap(buffer[i + 1], buffer[j + 1]);
+			}
+		}
+
+		// Merge the first run of this column into the last run of the previous one if they are the same colour
+		if (columnStart != 0 && buffer[columnStart + 1] == buffer[columnStart - 1] && (uint32_t)buffer[columnStart - 2] + buffer[columnStart] < 0xFFFF)
+		{
+			buffer[columnStart - 2] += buffer[columnStart] + 1;
+			memmove(buffer + columnStart, buffer + columnStart + 2, (used - columnStart - 2) * sizeof(uint16_t));
+			used -= 2;
+		}
+	}
+	removeCS();
+	clrXY();
+	return used;
+}
+
+#endif
+
+// Draw a bitmap that is stored as palette indices with run-length encoding
+void UTFT::drawPalettedBitmap(int x, int y, int sx, int sy, const uint8_t *data)
+{
+	PalettedBitmapRuns runs(data);
+	drawRuns(x, y, sx, sy, runs);
+}
+
+// Return true if we can scroll part of the display in hardware
+bool UTFT::canScroll() const
+{
+#ifdef DISABLE_HARDWARE_SCROLL
+	return false;
+#else
+	return (getModel() == SSD1963_480 || getModel() == SSD1963_800) && (orient & SwapXY) != 0;
+#endif
+}
+
+// Make display rows y1 to y2 into a vertical scrolling area and set the scroll offset. See the header file for the meaning of the offset.
+// In landscape orientation each display row is one line of the panel, so this is a vertical scroll as far as the controller is concerned.
+void UTFT::setScroll(uint16_t y1, uint16_t y2, uint16_t offset)
+{
+	if (canScroll() && y1 <= y2 && y2 <= disp_x_size)
+	{
+		const uint16_t numLines = y2 + 1 - y1;
+		offset %= numLines;
+
+		// Convert to panel lines. If ReverseY is set then the rows are stored in the opposite order, so the offset goes the other way.
+		uint16_t topLines = y1;
+		if (orient & ReverseY)
+		{
+			topLines = disp_x_size - y2;
+			if (offset != 0)
+			{
+				offset = numLines - offset;
+			}
+		}
+		const uint16_t bottomLines = disp_x_size + 1 - topLines - numLines;
+		const uint16_t startLine = topLines + offset;
+
+		assertCS();
+		LCD_Write_COM_DATA16(0x33, topLines >> 8);		// set_scroll_area: top fixed area, vertical scrolling area, bottom fixed area
+		LCD_Write_Bus(topLines);
+		LCD_Write_Bus(numLines >> 8);
+		LCD_Write_Bus(numLines);
+		LCD_Write_Bus(bottomLines >> 8);
+		LCD_Write_Bus(bottomLines);
+		LCD_Write_COM_DATA16(0x37, startLine >> 8);		// set_scroll_start: the frame memory line shown at the top of the scrolling area
+		LCD_Write_Bus(startLine);
+		removeCS();
+	}
 }
 
 void UTFT::lcdOff()
 {
 	assertCS();
-	switch (displayModel)
+	switch (getModel())
 	{
 	case PCF8833:
 		LCD_Write_COM(0x28);
@@ -2178,7 +2583,7 @@ void UTFT::lcdOff()
 void UTFT::lcdOn()
 {
 	assertCS();
-	switch (displayModel)
+	switch (getModel())
 	{
 	case PCF8833:
 		LCD_Write_COM(0x29);
@@ -2192,7 +2597,7 @@ void UTFT::lcdOn()
 void UTFT::setContrast(uint8_t c)
 {
 	assertCS();
-	switch (displayModel)
+	switch (getModel())
 	{
 	case PCF8833:
 		if (c>64) c=64;
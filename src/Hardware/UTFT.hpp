@@ -52,7 +52,20 @@
 #include "OneBitPort.hpp"
 #include "DisplayOrientation.hpp"
 
+#include "FontMetrics.hpp"
+#include "Library/Utf8Decoder.hpp"
 #include "HW_AVR_defines.h"
+#include "memorysaver.h"
+
+// Uncomment the following to count the bus transactions made by the library, e.g. to measure how much a screen refresh costs
+//#define UTFT_STATISTICS		1
+
+// To build the library for a host computer with a simulated display, define UTFT_BUS_HEADER as the name of a header file that provides
+// LCD_Write_Bus, LCD_Write_Again and _set_direction_registers in place of the ones in HW_AVR.h.
+
+// Uncomment the following if the RD line of the display is connected, so that pixels can be read back from the frame memory of SSD1963 controllers.
+// The bus layer must then also provide LCD_Read_Bus. PanelDue boards tie RD high and HW_AVR.h has no read function, so this is off by default.
+//#define UTFT_READBACK		1
 
 enum DisplayType {
 	HX8347A,
@@ -172,6 +185,10 @@ public:
 	void clearToMargin();
 	size_t print(const char *s, uint16_t x, uint16_t y, uint16_t rm = 9999);
 	using Print::print;
+
+	// Restrict text to display rows ymin to ymax inclusive, so that a line of text can be drawn partly, e.g. in a list that scrolls by single pixels
+	void setTextClip(uint16_t ymin, uint16_t ymax) { textClipTop = ymin; textClipBottom = ymax; }
+	void clearTextClip() { setTextClip(0, 0xFFFF); }
 		
 	void setFont(const uint8_t* font);
 	void drawBitmap(int x, int y, int sx, int sy, const uint16_t *data, int scale = 1, bool byCols = true);
@@ -179,6 +196,24 @@ public:
 	void drawBitmap(int x, int y, int sx, int sy, const uint16_t *data, int deg, int rox, int roy);
 #endif
 	void drawCompressedBitmap(int x, int y, int sx, int sy, const uint16_t *data);
+#ifdef UTFT_READBACK
+	// Read an area of the display back into the format used by drawCompressedBitmap. Returns the number of words used, or 0 if the buffer is too small.
+	size_t readCompressedBitmap(int x, int y, int sx, int sy, uint16_t *buffer, size_t bufferSize);
+#endif
+
+	// Draw a bitmap stored as palette indices with run-length encoding, as generated by Icons/iconcompress.py.
+	// The data is the number of palette entries (1 to 255), then the palette as 16-bit colours stored low byte first, then the pixels in column order.
+	// The pixels are stored as a sequence of blocks. A block starting with a byte 0x80 + n is a run of n + 1 pixels, with the palette index in the next byte.
+	// A block starting with a byte n < 0x80 is n + 1 pixels, each given by a palette index byte.
+	// If transparent background is set then pixels with colour 0xFFFF are not written.
+	void drawPalettedBitmap(int x, int y, int sx, int sy, const uint8_t *data);
+
+	// Hardware vertical scrolling, which SSD1963 controllers support in landscape orientation. canScroll() returns false if DISABLE_HARDWARE_SCROLL is defined.
+	// setScroll makes display rows y1 to y2 inclusive into a scrolling area, in which display row y1 + n shows frame memory row y1 + (n + offset) % (y2 + 1 - y1).
+	// Drawing always goes to the frame memory rows, so the caller must allow for the offset. An offset of zero makes the display normal again.
+	bool canScroll() const;
+	void setScroll(uint16_t y1, uint16_t y2, uint16_t offset);
+
 	void lcdOff();
 	void lcdOn();
 	void setContrast(uint8_t c);
@@ -189,6 +224,19 @@ public:
 	uint16_t getFontHeight() const { return cfont.y_size; }
 	static uint16_t GetFontHeight(const uint8_t *f) { return reinterpret_cast<const FontDescriptor*>(f)->y_size; }
 
+#ifdef UTFT_STATISTICS
+	struct Statistics
+	{
+		uint32_t busWrites;			// number of words written to the bus, including repeated ones
+		uint32_t commands;			// number of those words that were commands
+		uint32_t windows;			// number of address windows set
+		uint32_t pixels;			// number of pixels written
+	};
+
+	const Statistics& getStatistics() const { return stats; }
+	void resetStatistics() { stats.busWrites = stats.commands = stats.windows = stats.pixels = 0; }
+#endif
+
 private:
 	uint16_t fcolour, bcolour;
 	bool transparentBackground;
@@ -202,35 +250,55 @@ private:
 	
 	FontDescriptor cfont;
 	uint16_t textXpos, textYpos, textRightMargin;
-	uint32_t lastCharColData;		// used for auto kerning
+	uint16_t textClipTop, textClipBottom;	// the display rows that text may be drawn in
+	uint8_t lastKernClass;			// kerning class left by the last character written, used for auto kerning
 	const char* translateFrom;
 	const char* translateTo;
 	
-	uint32_t charVal;
-	uint8_t numContinuationBytesLeft;
+	const FontMetrics * null cmetrics;	// width and kerning data for the current font, or null if it has no tables
+	Utf8Decoder decoder;
+
+#ifdef UTFT_STATISTICS
+	Statistics stats;				// bus transactions since the statistics were last reset
+#endif
+
+	// Run of pixels of the same colour that we have yet to send, used when rendering text
+	Colour runColour;
+	uint32_t runLength;
 
 	size_t writeNative(uint8_t c);
+	bool getTextRows(uint8_t& firstRow, uint8_t& endRow) const;
+	void addRun(Colour c, uint16_t num);
+	void flushRun();
+	void addColumnRuns(uint32_t colData, uint8_t ySize);
+	template<class RunSource> void drawRuns(int x, int y, int sx, int sy, RunSource& src);
 
 	// Hardware interface
 	void LCD_Write_Bus(uint16_t VHL);
-	void LCD_Write_Again(uint16_t num);
+	void LCD_Write_Again(uint32_t num);
 	void _set_direction_registers();
+#ifdef UTFT_READBACK
+	uint16_t LCD_Read_Bus();
+#endif
 
 	// Low level interface
 	void LCD_Write_COM(uint8_t VL);
 	void LCD_Write_DATA8(uint8_t VL);
 	void LCD_Write_DATA16(uint16_t VHL);
-	void LCD_Write_Repeated_DATA16(uint16_t VHL, uint16_t num);
+	void LCD_Write_Repeated_DATA16(uint16_t VHL, uint32_t num);
 	void LCD_Write_Repeated_DATA16(uint16_t VHL, uint16_t num1, uint16_t num2);
 	void LCD_Write_COM_DATA16(uint8_t com1, uint16_t dat1);
 	void LCD_Write_COM_DATA8(uint8_t com1, uint8_t dat1);
 		
 	void drawHLine(int x, int y, int len);
+	void fillArea(int x1, int y1, int x2, int y2);
+	void fillCircleRows(int x, int y, int dy, int lastDy, int inner, int outer);
 	void drawVLine(int x, int y, int len);
 	void setXY(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
 	void clrXY();
 		
 	bool isParallel() const;
+	DisplayType getModel() const;
 	
 	void assertCS() const
 	{
@@ -27,6 +27,25 @@
 //#define DISABLE_SSD1963_800		1
 #define DISABLE_S6D1121			1
 
+// PanelDue doesn't rotate bitmaps. Define UTFT_BITMAP_ROTATE to keep the rotating drawBitmap, e.g. to test it on the host.
+#ifndef UTFT_BITMAP_ROTATE
 #define DISABLE_BITMAP_ROTATE	1
+#endif
+
+// Hardware vertical scrolling on the SSD1963 has not been checked on a real panel yet, so lists are redrawn when they scroll instead.
+// Define UTFT_HARDWARE_SCROLL to let canScroll() return true on SSD1963 controllers in landscape orientation.
+#ifndef UTFT_HARDWARE_SCROLL
+#define DISABLE_HARDWARE_SCROLL	1
+#endif
+
+// Each PanelDue build drives just one display controller, so we specialise the library for it at compile time.
+// This removes the run-time selection of the controller from setXY and the other controller-specific functions, and the code for the other controllers.
+// Comment these lines out to select the controller at run time from the model passed to the constructor instead.
+// The controller selected here must match DISPLAY_CONTROLLER in Fields.hpp.
+#if defined(SCREEN_43)
+#define UTFT_CONTROLLER			SSD1963_480
+#elif defined(SCREEN_50) || defined(SCREEN_70)
+#define UTFT_CONTROLLER			SSD1963_800
+#endif
 
 // End
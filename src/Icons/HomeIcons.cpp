@@ -3,11 +3,12 @@
  *
  * Created: 29/11/2015 12:10:12
  *  Author: David
+ *
+ * Uncompressed source for the icons in IconData.cpp. This file is not compiled. After changing it, run iconcompress.py to regenerate IconData.cpp.
  */ 
 
 #include "asf.h"
 #include "Configuration.hpp"
-#include "Icons.hpp"
 
 #if LARGE_FONT
 
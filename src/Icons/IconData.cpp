@@ -0,0 +1,1349 @@
+/*
+ * IconData.cpp
+ *
+ * Generated by iconcompress.py from HomeIcons.cpp, KeyIcons.cpp, MiscIcons.cpp, NozzleIcons.cpp. Do not edit.
+ */
+
+#include "asf.h"
+#include "Configuration.hpp"
+#include "Icons.hpp"
+
+// Icons from HomeIcons.cpp
+
+#if LARGE_FONT
+
+// 35 x 30 pixels, 25 colours, 273 bytes (was 2104)
+extern const uint8_t IconHomeAll[] =
+{
+	35, 30,		// width, height
+	25,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0x20, 0x00, 0x18, 0xc6, 0x30, 0x84, 0x41, 0x08, 0xa2, 0x10, 0xc3, 0x18,
+	0x24, 0x21, 0xc7, 0x39, 0xd3, 0x9c, 0x55, 0xad, 0x75, 0xad, 0x96, 0xb5, 0x9a, 0xd6, 0xba, 0xd6,
+	0xfb, 0xde, 0x1c, 0xe7, 0x3c, 0xe7, 0x9e, 0xf7, 0xbe, 0xf7, 0x49, 0x4a, 0xaa, 0x52, 0xeb, 0x5a,
+	0x8e, 0x73,
+	0x8e, 0x01, 0x01, 0x0b, 0x11, 0x9a, 0x01, 0x02, 0x04, 0x02, 0x13, 0x99, 0x01, 0x02, 0x0d, 0x00,
+	0x00, 0x99, 0x01, 0x00, 0x03, 0x82, 0x00, 0x98, 0x01, 0x01, 0x0f, 0x05, 0x82, 0x00, 0x97, 0x01,
+	0x01, 0x12, 0x07, 0x91, 0x00, 0x88, 0x01, 0x01, 0x14, 0x08, 0x92, 0x00, 0x88, 0x01, 0x00, 0x09,
+	0x93, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x8f, 0x00, 0x84, 0x01,
+	0x85, 0x00, 0x82, 0x01, 0x8f, 0x00, 0x84, 0x01, 0x85, 0x00, 0x83, 0x01, 0x00, 0x0a, 0x8d, 0x00,
+	0x84, 0x01, 0x85, 0x00, 0x82, 0x01, 0x00, 0x0c, 0x8e, 0x00, 0x84, 0x01, 0x85, 0x00, 0x81, 0x01,
+	0x00, 0x03, 0x9a, 0x00, 0x02, 0x01, 0x0e, 0x02, 0x9a, 0x00, 0x01, 0x10, 0x06, 0x9b, 0x00, 0x00,
+	0x16, 0x9c, 0x00, 0x01, 0x10, 0x06, 0x9b, 0x00, 0x02, 0x01, 0x0e, 0x02, 0x8f, 0x00, 0x8c, 0x01,
+	0x00, 0x03, 0x8f, 0x00, 0x8d, 0x01, 0x00, 0x0c, 0x8e, 0x00, 0x8e, 0x01, 0x00, 0x0a, 0x8d, 0x00,
+	0x8f, 0x01, 0x00, 0x04, 0x8c, 0x00, 0x90, 0x01, 0x00, 0x18, 0x96, 0x00, 0x86, 0x01, 0x00, 0x17,
+	0x95, 0x00, 0x87, 0x01, 0x00, 0x15, 0x94, 0x00, 0x88, 0x01, 0x00, 0x09, 0x93, 0x00, 0x88, 0x01,
+	0x01, 0x14, 0x08, 0x92, 0x00, 0x89, 0x01, 0x01, 0x12, 0x07, 0x91, 0x00, 0x8a, 0x01, 0x01, 0x0f,
+	0x05, 0x82, 0x00, 0x99, 0x01, 0x00, 0x03, 0x82, 0x00, 0x9a, 0x01, 0x02, 0x0d, 0x00, 0x00, 0x9b,
+	0x01, 0x02, 0x04, 0x02, 0x13, 0x9b, 0x01, 0x01, 0x0b, 0x11, 0x8c, 0x01,
+};
+
+// 35 x 30 pixels, 34 colours, 429 bytes (was 2104)
+extern const uint8_t IconHomeX[] =
+{
+	35, 30,		// width, height
+	34,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0xfb, 0xde, 0x55, 0xad, 0x82, 0x10, 0xae, 0x73, 0x20, 0x00, 0xaa, 0x52,
+	0x18, 0xc6, 0x7d, 0xef, 0x86, 0x31, 0x30, 0x84, 0xd3, 0x9c, 0x79, 0xce, 0x41, 0x08, 0xa2, 0x10,
+	0xc3, 0x18, 0x04, 0x21, 0x24, 0x21, 0xc7, 0x39, 0x28, 0x42, 0x2c, 0x63, 0x51, 0x8c, 0x75, 0xad,
+	0x96, 0xb5, 0x9a, 0xd6, 0xba, 0xd6, 0x1c, 0xe7, 0x3c, 0xe7, 0x9e, 0xf7, 0xbe, 0xf7, 0x49, 0x4a,
+	0xeb, 0x5a, 0x8e, 0x73,
+	0x8e, 0x01, 0x01, 0x03, 0x1b, 0x9a, 0x01, 0x02, 0x0b, 0x06, 0x1d, 0x99, 0x01, 0x02, 0x18, 0x00,
+	0x00, 0x99, 0x01, 0x00, 0x08, 0x82, 0x00, 0x98, 0x01, 0x01, 0x1a, 0x0e, 0x82, 0x00, 0x97, 0x01,
+	0x01, 0x1c, 0x10, 0x91, 0x00, 0x88, 0x01, 0x01, 0x1e, 0x12, 0x92, 0x00, 0x88, 0x01, 0x00, 0x13,
+	0x93, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x8f, 0x00, 0x84, 0x01,
+	0x85, 0x00, 0x82, 0x01, 0x8f, 0x00, 0x84, 0x01, 0x85, 0x00, 0x83, 0x01, 0x00, 0x0c, 0x8d, 0x00,
+	0x84, 0x01, 0x85, 0x00, 0x82, 0x01, 0x00, 0x17, 0x8e, 0x00, 0x84, 0x01, 0x85, 0x00, 0x81, 0x01,
+	0x00, 0x08, 0x8d, 0x00, 0x00, 0x11, 0x88, 0x00, 0x05, 0x14, 0x00, 0x00, 0x01, 0x19, 0x06, 0x8d,
+	0x00, 0x01, 0x0d, 0x0a, 0x86, 0x00, 0x05, 0x15, 0x09, 0x00, 0x00, 0x02, 0x0f, 0x8e, 0x00, 0x81,
+	0x01, 0x00, 0x05, 0x83, 0x00, 0x06, 0x04, 0x03, 0x01, 0x01, 0x00, 0x00, 0x07, 0x8f, 0x00, 0x82,
+	0x01, 0x04, 0x03, 0x04, 0x00, 0x07, 0x02, 0x82, 0x01, 0x81, 0x00, 0x01, 0x02, 0x0f, 0x8e, 0x00,
+	0x83, 0x01, 0x01, 0x02, 0x16, 0x84, 0x01, 0x81, 0x00, 0x02, 0x01, 0x19, 0x06, 0x8d, 0x00, 0x00,
+	0x03, 0x87, 0x01, 0x06, 0x09, 0x15, 0x00, 0x00, 0x01, 0x01, 0x08, 0x8e, 0x00, 0x01, 0x07, 0x02,
+	0x84, 0x01, 0x01, 0x0c, 0x04, 0x82, 0x00, 0x82, 0x01, 0x00, 0x17, 0x8d, 0x00, 0x01, 0x04, 0x03,
+	0x84, 0x01, 0x00, 0x05, 0x83, 0x00, 0x83, 0x01, 0x00, 0x0c, 0x8b, 0x00, 0x01, 0x05, 0x09, 0x86,
+	0x01, 0x03, 0x02, 0x14, 0x00, 0x00, 0x84, 0x01, 0x00, 0x0b, 0x8a, 0x00, 0x83, 0x01, 0x01, 0x09,
+	0x0d, 0x84, 0x01, 0x81, 0x00, 0x85, 0x01, 0x00, 0x21, 0x89, 0x00, 0x82, 0x01, 0x03, 0x0d, 0x11,
+	0x00, 0x05, 0x83, 0x01, 0x81, 0x00, 0x86, 0x01, 0x00, 0x20, 0x88, 0x00, 0x81, 0x01, 0x00, 0x16,
+	0x83, 0x00, 0x05, 0x0a, 0x02, 0x01, 0x01, 0x00, 0x00, 0x87, 0x01, 0x00, 0x1f, 0x87, 0x00, 0x01,
+	0x02, 0x07, 0x85, 0x00, 0x04, 0x04, 0x03, 0x01, 0x00, 0x00, 0x88, 0x01, 0x00, 0x13, 0x86, 0x00,
+	0x00, 0x0a, 0x88, 0x00, 0x02, 0x05, 0x00, 0x00, 0x88, 0x01, 0x01, 0x1e, 0x12, 0x92, 0x00, 0x89,
+	0x01, 0x01, 0x1c, 0x10, 0x91, 0x00, 0x8a, 0x01, 0x01, 0x1a, 0x0e, 0x82, 0x00, 0x99, 0x01, 0x00,
+	0x08, 0x82, 0x00, 0x9a, 0x01, 0x02, 0x18, 0x00, 0x00, 0x9b, 0x01, 0x02, 0x0b, 0x06, 0x1d, 0x9b,
+	0x01, 0x01, 0x03, 0x1b, 0x8c, 0x01,
+};
+
+// 35 x 30 pixels, 34 colours, 378 bytes (was 2104)
+extern const uint8_t IconHomeY[] =
+{
+	35, 30,		// width, height
+	34,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0x2c, 0x63, 0xae, 0x73, 0x55, 0xad, 0x20, 0x00, 0x18, 0xc6, 0xfb, 0xde,
+	0x82, 0x10, 0x30, 0x84, 0x41, 0x08, 0xa2, 0x10, 0xc3, 0x18, 0x24, 0x21, 0x86, 0x31, 0xc7, 0x39,
+	0xaa, 0x52, 0x51, 0x8c, 0xd3, 0x9c, 0x75, 0xad, 0x96, 0xb5, 0xd7, 0xbd, 0x9a, 0xd6, 0xba, 0xd6,
+	0x1c, 0xe7, 0x3c, 0xe7, 0x7d, 0xef, 0x9e, 0xf7, 0xbe, 0xf7, 0x28, 0x42, 0x49, 0x4a, 0xeb, 0x5a,
+	0x8e, 0x73, 0x79, 0xce,
+	0x8e, 0x01, 0x01, 0x04, 0x18, 0x9a, 0x01, 0x02, 0x09, 0x05, 0x1b, 0x99, 0x01, 0x02, 0x14, 0x00,
+	0x00, 0x99, 0x01, 0x00, 0x06, 0x82, 0x00, 0x98, 0x01, 0x01, 0x17, 0x0a, 0x82, 0x00, 0x97, 0x01,
+	0x01, 0x19, 0x0c, 0x91, 0x00, 0x88, 0x01, 0x01, 0x1c, 0x0d, 0x92, 0x00, 0x88, 0x01, 0x00, 0x0f,
+	0x93, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x8e, 0x00, 0x84, 0x01,
+	0x86, 0x00, 0x82, 0x01, 0x8e, 0x00, 0x84, 0x01, 0x86, 0x00, 0x83, 0x01, 0x00, 0x12, 0x8c, 0x00,
+	0x84, 0x01, 0x86, 0x00, 0x82, 0x01, 0x00, 0x13, 0x8d, 0x00, 0x84, 0x01, 0x86, 0x00, 0x81, 0x01,
+	0x00, 0x06, 0x9a, 0x00, 0x02, 0x01, 0x16, 0x05, 0x8d, 0x00, 0x00, 0x02, 0x8b, 0x00, 0x01, 0x07,
+	0x0b, 0x8e, 0x00, 0x02, 0x01, 0x04, 0x08, 0x89, 0x00, 0x00, 0x10, 0x8f, 0x00, 0x81, 0x01, 0x01,
+	0x1a, 0x10, 0x88, 0x00, 0x01, 0x07, 0x0b, 0x8e, 0x00, 0x83, 0x01, 0x01, 0x04, 0x08, 0x86, 0x00,
+	0x02, 0x01, 0x16, 0x05, 0x8d, 0x00, 0x84, 0x01, 0x01, 0x1a, 0x03, 0x83, 0x02, 0x81, 0x00, 0x81,
+	0x01, 0x00, 0x06, 0x8d, 0x00, 0x01, 0x1d, 0x15, 0x88, 0x01, 0x81, 0x00, 0x82, 0x01, 0x00, 0x13,
+	0x8e, 0x00, 0x00, 0x02, 0x87, 0x01, 0x81, 0x00, 0x83, 0x01, 0x00, 0x12, 0x8c, 0x00, 0x01, 0x02,
+	0x07, 0x87, 0x01, 0x81, 0x00, 0x84, 0x01, 0x00, 0x09, 0x8a, 0x00, 0x00, 0x15, 0x84, 0x01, 0x00,
+	0x11, 0x83, 0x03, 0x81, 0x00, 0x85, 0x01, 0x00, 0x20, 0x89, 0x00, 0x83, 0x01, 0x01, 0x21, 0x0e,
+	0x86, 0x00, 0x86, 0x01, 0x00, 0x1f, 0x88, 0x00, 0x82, 0x01, 0x00, 0x11, 0x88, 0x00, 0x87, 0x01,
+	0x00, 0x1e, 0x87, 0x00, 0x02, 0x01, 0x07, 0x0e, 0x89, 0x00, 0x88, 0x01, 0x00, 0x0f, 0x86, 0x00,
+	0x01, 0x04, 0x08, 0x8a, 0x00, 0x88, 0x01, 0x01, 0x1c, 0x0d, 0x92, 0x00, 0x89, 0x01, 0x01, 0x19,
+	0x0c, 0x91, 0x00, 0x8a, 0x01, 0x01, 0x17, 0x0a, 0x82, 0x00, 0x99, 0x01, 0x00, 0x06, 0x82, 0x00,
+	0x9a, 0x01, 0x02, 0x14, 0x00, 0x00, 0x9b, 0x01, 0x02, 0x09, 0x05, 0x1b, 0x9b, 0x01, 0x01, 0x04,
+	0x18, 0x8c, 0x01,
+};
+
+// 35 x 30 pixels, 32 colours, 383 bytes (was 2104)
+extern const uint8_t IconHomeZ[] =
+{
+	35, 30,		// width, height
+	32,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0xd3, 0x9c, 0xae, 0x73, 0x20, 0x00, 0xd7, 0xbd, 0x18, 0xc6, 0xaa, 0x52,
+	0x2c, 0x63, 0x30, 0x84, 0xfb, 0xde, 0x41, 0x08, 0xa2, 0x10, 0xc3, 0x18, 0x24, 0x21, 0x86, 0x31,
+	0xc7, 0x39, 0x55, 0xad, 0x75, 0xad, 0x96, 0xb5, 0x9a, 0xd6, 0xba, 0xd6, 0x1c, 0xe7, 0x3c, 0xe7,
+	0x9e, 0xf7, 0xbe, 0xf7, 0x04, 0x21, 0x49, 0x4a, 0xeb, 0x5a, 0x8e, 0x73, 0x51, 0x8c, 0x7d, 0xef,
+	0x8e, 0x01, 0x01, 0x11, 0x16, 0x9a, 0x01, 0x02, 0x09, 0x04, 0x18, 0x99, 0x01, 0x02, 0x13, 0x00,
+	0x00, 0x99, 0x01, 0x00, 0x06, 0x82, 0x00, 0x98, 0x01, 0x01, 0x15, 0x0b, 0x82, 0x00, 0x97, 0x01,
+	0x01, 0x17, 0x0d, 0x91, 0x00, 0x88, 0x01, 0x01, 0x19, 0x0e, 0x92, 0x00, 0x88, 0x01, 0x00, 0x10,
+	0x93, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x8f, 0x00, 0x84, 0x01,
+	0x85, 0x00, 0x82, 0x01, 0x8f, 0x00, 0x84, 0x01, 0x85, 0x00, 0x83, 0x01, 0x00, 0x02, 0x8d, 0x00,
+	0x84, 0x01, 0x85, 0x00, 0x82, 0x01, 0x00, 0x12, 0x8e, 0x00, 0x84, 0x01, 0x85, 0x00, 0x81, 0x01,
+	0x00, 0x06, 0x9a, 0x00, 0x02, 0x01, 0x14, 0x04, 0x9a, 0x00, 0x01, 0x0a, 0x0c, 0x9b, 0x00, 0x00,
+	0x07, 0x9c, 0x00, 0x01, 0x0a, 0x0c, 0x8e, 0x00, 0x82, 0x08, 0x83, 0x00, 0x00, 0x0f, 0x82, 0x03,
+	0x81, 0x00, 0x02, 0x01, 0x14, 0x04, 0x8d, 0x00, 0x82, 0x01, 0x82, 0x00, 0x00, 0x07, 0x83, 0x01,
+	0x81, 0x00, 0x81, 0x01, 0x00, 0x06, 0x8d, 0x00, 0x82, 0x01, 0x81, 0x00, 0x00, 0x03, 0x84, 0x01,
+	0x81, 0x00, 0x82, 0x01, 0x00, 0x12, 0x8c, 0x00, 0x82, 0x01, 0x01, 0x00, 0x02, 0x85, 0x01, 0x81,
+	0x00, 0x83, 0x01, 0x00, 0x02, 0x8b, 0x00, 0x82, 0x01, 0x00, 0x05, 0x86, 0x01, 0x81, 0x00, 0x84,
+	0x01, 0x00, 0x09, 0x8a, 0x00, 0x86, 0x01, 0x00, 0x1e, 0x82, 0x01, 0x81, 0x00, 0x85, 0x01, 0x00,
+	0x1d, 0x89, 0x00, 0x85, 0x01, 0x01, 0x03, 0x00, 0x82, 0x01, 0x81, 0x00, 0x86, 0x01, 0x00, 0x1c,
+	0x88, 0x00, 0x83, 0x01, 0x03, 0x1f, 0x07, 0x00, 0x00, 0x82, 0x01, 0x81, 0x00, 0x87, 0x01, 0x00,
+	0x1b, 0x87, 0x00, 0x82, 0x01, 0x01, 0x0a, 0x0f, 0x82, 0x00, 0x82, 0x01, 0x81, 0x00, 0x88, 0x01,
+	0x00, 0x10, 0x86, 0x00, 0x82, 0x02, 0x00, 0x1a, 0x83, 0x00, 0x82, 0x05, 0x81, 0x00, 0x88, 0x01,
+	0x01, 0x19, 0x0e, 0x92, 0x00, 0x89, 0x01, 0x01, 0x17, 0x0d, 0x91, 0x00, 0x8a, 0x01, 0x01, 0x15,
+	0x0b, 0x82, 0x00, 0x99, 0x01, 0x00, 0x06, 0x82, 0x00, 0x9a, 0x01, 0x02, 0x13, 0x00, 0x00, 0x9b,
+	0x01, 0x02, 0x09, 0x04, 0x18, 0x9b, 0x01, 0x01, 0x11, 0x16, 0x8c, 0x01,
+};
+
+// 35 x 30 pixels, 24 colours, 330 bytes (was 2104)
+extern const uint8_t IconHomeU[] =
+{
+	35, 30,		// width, height
+	24,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0xef, 0x7b, 0x20, 0x00, 0x18, 0xc6, 0x30, 0x84, 0x41, 0x08, 0xa2, 0x10,
+	0xc3, 0x18, 0x24, 0x21, 0xc7, 0x39, 0xd3, 0x9c, 0x55, 0xad, 0x75, 0xad, 0x96, 0xb5, 0x9a, 0xd6,
+	0xba, 0xd6, 0xfb, 0xde, 0x3c, 0xe7, 0xbe, 0xf7, 0x49, 0x4a, 0xaa, 0x52, 0xeb, 0x5a, 0x8e, 0x73,
+	0x8e, 0x01, 0x00, 0x0c, 0x9b, 0x01, 0x01, 0x05, 0x03, 0x9a, 0x01, 0x02, 0x0e, 0x00, 0x00, 0x99,
+	0x01, 0x00, 0x04, 0x82, 0x00, 0x98, 0x01, 0x01, 0x10, 0x06, 0x82, 0x00, 0x97, 0x01, 0x01, 0x12,
+	0x08, 0x91, 0x00, 0x88, 0x01, 0x01, 0x13, 0x09, 0x92, 0x00, 0x88, 0x01, 0x00, 0x0a, 0x93, 0x00,
+	0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x8e, 0x00, 0x84, 0x01, 0x86, 0x00,
+	0x82, 0x01, 0x8e, 0x00, 0x84, 0x01, 0x86, 0x00, 0x83, 0x01, 0x00, 0x0b, 0x8c, 0x00, 0x84, 0x01,
+	0x86, 0x00, 0x82, 0x01, 0x00, 0x0d, 0x8d, 0x00, 0x84, 0x01, 0x86, 0x00, 0x81, 0x01, 0x00, 0x04,
+	0x9a, 0x00, 0x02, 0x01, 0x0f, 0x03, 0x9a, 0x00, 0x01, 0x11, 0x07, 0x8e, 0x00, 0x87, 0x01, 0x00,
+	0x02, 0x83, 0x00, 0x00, 0x15, 0x8f, 0x00, 0x88, 0x01, 0x00, 0x02, 0x82, 0x00, 0x01, 0x11, 0x07,
+	0x8e, 0x00, 0x89, 0x01, 0x05, 0x02, 0x00, 0x00, 0x01, 0x0f, 0x03, 0x8d, 0x00, 0x8a, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x00, 0x04, 0x93, 0x00, 0x00, 0x02, 0x83, 0x01, 0x81, 0x00, 0x82, 0x01, 0x00,
+	0x0d, 0x94, 0x00, 0x82, 0x01, 0x81, 0x00, 0x83, 0x01, 0x00, 0x0b, 0x93, 0x00, 0x82, 0x01, 0x81,
+	0x00, 0x84, 0x01, 0x00, 0x05, 0x90, 0x00, 0x00, 0x02, 0x83, 0x01, 0x81, 0x00, 0x85, 0x01, 0x00,
+	0x17, 0x89, 0x00, 0x8a, 0x01, 0x81, 0x00, 0x86, 0x01, 0x00, 0x16, 0x88, 0x00, 0x89, 0x01, 0x02,
+	0x02, 0x00, 0x00, 0x87, 0x01, 0x00, 0x14, 0x87, 0x00, 0x88, 0x01, 0x00, 0x02, 0x82, 0x00, 0x88,
+	0x01, 0x00, 0x0a, 0x86, 0x00, 0x87, 0x01, 0x00, 0x02, 0x83, 0x00, 0x88, 0x01, 0x01, 0x13, 0x09,
+	0x92, 0x00, 0x89, 0x01, 0x01, 0x12, 0x08, 0x91, 0x00, 0x8a, 0x01, 0x01, 0x10, 0x06, 0x82, 0x00,
+	0x99, 0x01, 0x00, 0x04, 0x82, 0x00, 0x9a, 0x01, 0x02, 0x0e, 0x00, 0x00, 0x9b, 0x01, 0x01, 0x05,
+	0x03, 0x9c, 0x01, 0x00, 0x0c, 0x8d, 0x01,
+};
+
+// 35 x 30 pixels, 24 colours, 363 bytes (was 2104)
+extern const uint8_t IconHomeV[] =
+{
+	35, 30,		// width, height
+	24,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0xef, 0x7b, 0x18, 0xc6, 0x20, 0x00, 0x30, 0x84, 0x41, 0x08, 0xa2, 0x10,
+	0xc3, 0x18, 0x24, 0x21, 0xc7, 0x39, 0xd3, 0x9c, 0x55, 0xad, 0x75, 0xad, 0x96, 0xb5, 0x9a, 0xd6,
+	0xba, 0xd6, 0xfb, 0xde, 0x3c, 0xe7, 0xbe, 0xf7, 0x49, 0x4a, 0xaa, 0x52, 0xeb, 0x5a, 0x8e, 0x73,
+	0x8e, 0x01, 0x00, 0x0c, 0x9b, 0x01, 0x01, 0x05, 0x04, 0x9a, 0x01, 0x02, 0x0e, 0x00, 0x00, 0x99,
+	0x01, 0x00, 0x03, 0x82, 0x00, 0x98, 0x01, 0x01, 0x10, 0x06, 0x82, 0x00, 0x97, 0x01, 0x01, 0x12,
+	0x08, 0x91, 0x00, 0x88, 0x01, 0x01, 0x13, 0x09, 0x92, 0x00, 0x88, 0x01, 0x00, 0x0a, 0x93, 0x00,
+	0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x8e, 0x00, 0x84, 0x01, 0x86, 0x00,
+	0x82, 0x01, 0x8e, 0x00, 0x84, 0x01, 0x86, 0x00, 0x83, 0x01, 0x00, 0x0b, 0x8c, 0x00, 0x84, 0x01,
+	0x86, 0x00, 0x82, 0x01, 0x00, 0x0d, 0x8d, 0x00, 0x84, 0x01, 0x86, 0x00, 0x81, 0x01, 0x00, 0x03,
+	0x9a, 0x00, 0x02, 0x01, 0x0f, 0x04, 0x9a, 0x00, 0x01, 0x11, 0x07, 0x8e, 0x00, 0x81, 0x01, 0x01,
+	0x03, 0x02, 0x88, 0x00, 0x00, 0x15, 0x8f, 0x00, 0x83, 0x01, 0x01, 0x03, 0x02, 0x86, 0x00, 0x01,
+	0x11, 0x07, 0x8e, 0x00, 0x00, 0x02, 0x84, 0x01, 0x01, 0x03, 0x02, 0x84, 0x00, 0x02, 0x01, 0x0f,
+	0x04, 0x8e, 0x00, 0x01, 0x02, 0x03, 0x84, 0x01, 0x01, 0x03, 0x02, 0x82, 0x00, 0x81, 0x01, 0x00,
+	0x03, 0x90, 0x00, 0x01, 0x02, 0x03, 0x84, 0x01, 0x02, 0x02, 0x00, 0x00, 0x82, 0x01, 0x00, 0x0d,
+	0x92, 0x00, 0x00, 0x02, 0x83, 0x01, 0x81, 0x00, 0x83, 0x01, 0x00, 0x0b, 0x91, 0x00, 0x00, 0x02,
+	0x83, 0x01, 0x81, 0x00, 0x84, 0x01, 0x00, 0x05, 0x8d, 0x00, 0x01, 0x02, 0x03, 0x84, 0x01, 0x02,
+	0x02, 0x00, 0x00, 0x85, 0x01, 0x00, 0x17, 0x8a, 0x00, 0x01, 0x02, 0x03, 0x84, 0x01, 0x01, 0x03,
+	0x02, 0x82, 0x00, 0x86, 0x01, 0x00, 0x16, 0x88, 0x00, 0x00, 0x02, 0x84, 0x01, 0x01, 0x03, 0x02,
+	0x84, 0x00, 0x87, 0x01, 0x00, 0x14, 0x87, 0x00, 0x83, 0x01, 0x01, 0x03, 0x02, 0x86, 0x00, 0x88,
+	0x01, 0x00, 0x0a, 0x86, 0x00, 0x81, 0x01, 0x01, 0x03, 0x02, 0x88, 0x00, 0x88, 0x01, 0x01, 0x13,
+	0x09, 0x92, 0x00, 0x89, 0x01, 0x01, 0x12, 0x08, 0x91, 0x00, 0x8a, 0x01, 0x01, 0x10, 0x06, 0x82,
+	0x00, 0x99, 0x01, 0x00, 0x03, 0x82, 0x00, 0x9a, 0x01, 0x02, 0x0e, 0x00, 0x00, 0x9b, 0x01, 0x01,
+	0x05, 0x04, 0x9c, 0x01, 0x00, 0x0c, 0x8d, 0x01,
+};
+
+// 35 x 30 pixels, 24 colours, 338 bytes (was 2104)
+extern const uint8_t IconHomeW[] =
+{
+	35, 30,		// width, height
+	24,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0xef, 0x7b, 0x20, 0x00, 0x18, 0xc6, 0x30, 0x84, 0x41, 0x08, 0xa2, 0x10,
+	0xc3, 0x18, 0x24, 0x21, 0xc7, 0x39, 0xd3, 0x9c, 0x55, 0xad, 0x75, 0xad, 0x96, 0xb5, 0x9a, 0xd6,
+	0xba, 0xd6, 0xfb, 0xde, 0x3c, 0xe7, 0xbe, 0xf7, 0x49, 0x4a, 0xaa, 0x52, 0xeb, 0x5a, 0x8e, 0x73,
+	0x8e, 0x01, 0x00, 0x0c, 0x9b, 0x01, 0x01, 0x05, 0x03, 0x9a, 0x01, 0x02, 0x0e, 0x00, 0x00, 0x99,
+	0x01, 0x00, 0x04, 0x82, 0x00, 0x98, 0x01, 0x01, 0x10, 0x06, 0x82, 0x00, 0x97, 0x01, 0x01, 0x12,
+	0x08, 0x91, 0x00, 0x88, 0x01, 0x01, 0x13, 0x09, 0x92, 0x00, 0x88, 0x01, 0x00, 0x0a, 0x93, 0x00,
+	0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x8e, 0x00, 0x84, 0x01, 0x86, 0x00,
+	0x82, 0x01, 0x8e, 0x00, 0x84, 0x01, 0x86, 0x00, 0x83, 0x01, 0x00, 0x0b, 0x8c, 0x00, 0x84, 0x01,
+	0x86, 0x00, 0x82, 0x01, 0x00, 0x0d, 0x8d, 0x00, 0x84, 0x01, 0x86, 0x00, 0x81, 0x01, 0x00, 0x04,
+	0x9a, 0x00, 0x02, 0x01, 0x0f, 0x03, 0x9a, 0x00, 0x01, 0x11, 0x07, 0x8e, 0x00, 0x88, 0x01, 0x00,
+	0x02, 0x82, 0x00, 0x00, 0x15, 0x8f, 0x00, 0x89, 0x01, 0x04, 0x02, 0x00, 0x00, 0x11, 0x07, 0x8e,
+	0x00, 0x8a, 0x01, 0x81, 0x00, 0x02, 0x01, 0x0f, 0x03, 0x93, 0x00, 0x00, 0x02, 0x83, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x00, 0x04, 0x92, 0x00, 0x00, 0x02, 0x83, 0x01, 0x02, 0x02, 0x00, 0x00, 0x82,
+	0x01, 0x00, 0x0d, 0x90, 0x00, 0x00, 0x02, 0x83, 0x01, 0x83, 0x00, 0x83, 0x01, 0x00, 0x0b, 0x8f,
+	0x00, 0x00, 0x02, 0x83, 0x01, 0x83, 0x00, 0x84, 0x01, 0x00, 0x05, 0x8f, 0x00, 0x00, 0x02, 0x83,
+	0x01, 0x02, 0x02, 0x00, 0x00, 0x85, 0x01, 0x00, 0x17, 0x8f, 0x00, 0x00, 0x02, 0x83, 0x01, 0x81,
+	0x00, 0x86, 0x01, 0x00, 0x16, 0x88, 0x00, 0x8a, 0x01, 0x81, 0x00, 0x87, 0x01, 0x00, 0x14, 0x87,
+	0x00, 0x89, 0x01, 0x02, 0x02, 0x00, 0x00, 0x88, 0x01, 0x00, 0x0a, 0x86, 0x00, 0x88, 0x01, 0x00,
+	0x02, 0x82, 0x00, 0x88, 0x01, 0x01, 0x13, 0x09, 0x92, 0x00, 0x89, 0x01, 0x01, 0x12, 0x08, 0x91,
+	0x00, 0x8a, 0x01, 0x01, 0x10, 0x06, 0x82, 0x00, 0x99, 0x01, 0x00, 0x04, 0x82, 0x00, 0x9a, 0x01,
+	0x02, 0x0e, 0x00, 0x00, 0x9b, 0x01, 0x01, 0x05, 0x03, 0x9c, 0x01, 0x00, 0x0c, 0x8d, 0x01,
+};
+
+// 41 x 30 pixels, 4 colours, 351 bytes (was 2464)
+extern const uint8_t IconBedComp[] =
+{
+	41, 30,		// width, height
+	4,			// number of palette entries
+	0xff, 0xff, 0x00, 0x00, 0x18, 0xc6, 0xef, 0x7b,
+	0x8c, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x00, 0x02, 0x99, 0x00,
+	0x03, 0x03, 0x01, 0x01, 0x03, 0x99, 0x00, 0x00, 0x02, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x00,
+	0x02, 0x84, 0x00, 0x00, 0x02, 0x93, 0x00, 0x03, 0x03, 0x01, 0x01, 0x03, 0x83, 0x00, 0x01, 0x02,
+	0x01, 0x93, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x00, 0x02, 0x02, 0x01, 0x01, 0x94, 0x00, 0x82,
+	0x01, 0x81, 0x00, 0x00, 0x02, 0x82, 0x01, 0x94, 0x00, 0x82, 0x01, 0x01, 0x00, 0x02, 0x89, 0x01,
+	0x8e, 0x00, 0x82, 0x01, 0x01, 0x00, 0x02, 0x89, 0x01, 0x8e, 0x00, 0x82, 0x01, 0x81, 0x00, 0x00,
+	0x02, 0x82, 0x01, 0x93, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x00, 0x02, 0x02, 0x01, 0x01, 0x93,
+	0x00, 0x03, 0x03, 0x01, 0x01, 0x03, 0x83, 0x00, 0x01, 0x02, 0x01, 0x93, 0x00, 0x82, 0x01, 0x00,
+	0x02, 0x84, 0x00, 0x00, 0x02, 0x93, 0x00, 0x82, 0x01, 0x99, 0x00, 0x00, 0x02, 0x82, 0x01, 0x99,
+	0x00, 0x03, 0x03, 0x01, 0x01, 0x03, 0x99, 0x00, 0x82, 0x01, 0x00, 0x02, 0x98, 0x00, 0x00, 0x02,
+	0x82, 0x01, 0x99, 0x00, 0x03, 0x03, 0x01, 0x01, 0x03, 0x98, 0x00, 0x00, 0x02, 0x82, 0x01, 0x00,
+	0x02, 0x98, 0x00, 0x03, 0x03, 0x01, 0x01, 0x03, 0x99, 0x00, 0x82, 0x01, 0x00, 0x02, 0x92, 0x00,
+	0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x82, 0x01, 0x93, 0x00, 0x01, 0x01, 0x02, 0x83, 0x00, 0x03,
+	0x03, 0x01, 0x01, 0x03, 0x93, 0x00, 0x81, 0x01, 0x00, 0x02, 0x82, 0x00, 0x82, 0x01, 0x00, 0x02,
+	0x93, 0x00, 0x82, 0x01, 0x02, 0x02, 0x00, 0x00, 0x82, 0x01, 0x90, 0x00, 0x87, 0x01, 0x01, 0x02,
+	0x00, 0x82, 0x01, 0x90, 0x00, 0x87, 0x01, 0x01, 0x02, 0x00, 0x82, 0x01, 0x94, 0x00, 0x82, 0x01,
+	0x02, 0x02, 0x00, 0x00, 0x82, 0x01, 0x94, 0x00, 0x81, 0x01, 0x00, 0x02, 0x82, 0x00, 0x82, 0x01,
+	0x00, 0x02, 0x93, 0x00, 0x01, 0x01, 0x02, 0x83, 0x00, 0x03, 0x03, 0x01, 0x01, 0x03, 0x93, 0x00,
+	0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x00, 0x02, 0x99, 0x00,
+	0x03, 0x03, 0x01, 0x01, 0x03, 0x99, 0x00, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x99, 0x00, 0x03,
+	0x03, 0x01, 0x01, 0x03, 0x99, 0x00, 0x00, 0x02, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00,
+	0x82, 0x01, 0x8d, 0x00,
+};
+
+#else
+
+// 25 x 21 pixels, 20 colours, 196 bytes (was 1054)
+extern const uint8_t IconHomeAll[] =
+{
+	25, 21,		// width, height
+	20,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0x18, 0xc6, 0x20, 0x00, 0x82, 0x10, 0xa2, 0x10, 0x45, 0x29, 0xe7, 0x39,
+	0xaa, 0x52, 0x34, 0xa5, 0x75, 0xad, 0x38, 0xc6, 0xba, 0xd6, 0x7d, 0xef, 0xdf, 0xff, 0x69, 0x4a,
+	0x6d, 0x6b, 0x10, 0x84, 0xd3, 0x9c, 0x5d, 0xef,
+	0x89, 0x01, 0x00, 0x09, 0x92, 0x01, 0x01, 0x02, 0x00, 0x91, 0x01, 0x03, 0x0c, 0x05, 0x00, 0x13,
+	0x8f, 0x01, 0x01, 0x0d, 0x06, 0x8b, 0x00, 0x85, 0x01, 0x01, 0x0e, 0x07, 0x8c, 0x00, 0x85, 0x01,
+	0x00, 0x08, 0x8d, 0x00, 0x00, 0x01, 0x93, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x83, 0x01, 0x84, 0x00,
+	0x00, 0x01, 0x8a, 0x00, 0x83, 0x01, 0x84, 0x00, 0x81, 0x01, 0x00, 0x0a, 0x88, 0x00, 0x83, 0x01,
+	0x84, 0x00, 0x02, 0x01, 0x02, 0x03, 0x91, 0x00, 0x01, 0x0b, 0x04, 0x92, 0x00, 0x00, 0x0f, 0x93,
+	0x00, 0x01, 0x0b, 0x04, 0x92, 0x00, 0x02, 0x01, 0x02, 0x03, 0x88, 0x00, 0x8a, 0x01, 0x00, 0x0a,
+	0x88, 0x00, 0x8b, 0x01, 0x00, 0x12, 0x87, 0x00, 0x8c, 0x01, 0x00, 0x11, 0x86, 0x00, 0x8d, 0x01,
+	0x00, 0x10, 0x8e, 0x00, 0x85, 0x01, 0x00, 0x08, 0x8d, 0x00, 0x85, 0x01, 0x01, 0x0e, 0x07, 0x8c,
+	0x00, 0x86, 0x01, 0x01, 0x0d, 0x06, 0x8b, 0x00, 0x87, 0x01, 0x02, 0x0c, 0x05, 0x00, 0x92, 0x01,
+	0x01, 0x02, 0x00, 0x93, 0x01, 0x00, 0x09, 0x89, 0x01,
+};
+
+// 25 x 21 pixels, 29 colours, 338 bytes (was 1054)
+extern const uint8_t IconHomeX[] =
+{
+	25, 21,		// width, height
+	29,			// number of palette entries
+	0xff, 0xff, 0x00, 0x00, 0x7d, 0xef, 0x04, 0x21, 0x82, 0x10, 0x55, 0xad, 0xae, 0x73, 0x18, 0xc6,
+	0x79, 0xce, 0xaa, 0x52, 0x2c, 0x63, 0x20, 0x00, 0xa2, 0x10, 0x45, 0x29, 0x86, 0x31, 0xe7, 0x39,
+	0x34, 0xa5, 0x75, 0xad, 0x38, 0xc6, 0xba, 0xd6, 0xfb, 0xde, 0xdf, 0xff, 0x28, 0x42, 0x69, 0x4a,
+	0x6d, 0x6b, 0x10, 0x84, 0x51, 0x8c, 0xd3, 0x9c, 0x5d, 0xef,
+	0x89, 0x00, 0x00, 0x10, 0x92, 0x00, 0x01, 0x07, 0x01, 0x91, 0x00, 0x03, 0x13, 0x0c, 0x01, 0x1c,
+	0x8f, 0x00, 0x01, 0x02, 0x0d, 0x8b, 0x01, 0x85, 0x00, 0x01, 0x15, 0x0f, 0x8c, 0x01, 0x85, 0x00,
+	0x00, 0x09, 0x8d, 0x01, 0x00, 0x00, 0x8a, 0x01, 0x83, 0x00, 0x84, 0x01, 0x00, 0x00, 0x8a, 0x01,
+	0x83, 0x00, 0x84, 0x01, 0x00, 0x00, 0x87, 0x01, 0x02, 0x03, 0x01, 0x01, 0x83, 0x00, 0x81, 0x01,
+	0x05, 0x0e, 0x01, 0x01, 0x00, 0x00, 0x11, 0x85, 0x01, 0x01, 0x14, 0x0e, 0x85, 0x01, 0x06, 0x06,
+	0x02, 0x01, 0x01, 0x00, 0x07, 0x0b, 0x85, 0x01, 0x81, 0x00, 0x00, 0x06, 0x82, 0x01, 0x07, 0x03,
+	0x05, 0x00, 0x00, 0x01, 0x01, 0x12, 0x04, 0x86, 0x01, 0x82, 0x00, 0x03, 0x08, 0x03, 0x0a, 0x02,
+	0x82, 0x00, 0x81, 0x01, 0x00, 0x17, 0x87, 0x01, 0x00, 0x02, 0x82, 0x00, 0x00, 0x02, 0x83, 0x00,
+	0x04, 0x08, 0x01, 0x01, 0x12, 0x04, 0x86, 0x01, 0x01, 0x03, 0x05, 0x84, 0x00, 0x01, 0x02, 0x0a,
+	0x82, 0x01, 0x02, 0x00, 0x07, 0x0b, 0x86, 0x01, 0x01, 0x04, 0x08, 0x83, 0x00, 0x00, 0x1a, 0x83,
+	0x01, 0x81, 0x00, 0x00, 0x11, 0x85, 0x01, 0x01, 0x06, 0x02, 0x85, 0x00, 0x03, 0x14, 0x16, 0x01,
+	0x01, 0x82, 0x00, 0x00, 0x1b, 0x84, 0x01, 0x83, 0x00, 0x01, 0x05, 0x02, 0x83, 0x00, 0x81, 0x01,
+	0x83, 0x00, 0x00, 0x19, 0x83, 0x01, 0x81, 0x00, 0x04, 0x02, 0x09, 0x01, 0x04, 0x05, 0x82, 0x00,
+	0x81, 0x01, 0x84, 0x00, 0x00, 0x18, 0x82, 0x01, 0x02, 0x00, 0x05, 0x03, 0x83, 0x01, 0x04, 0x0a,
+	0x02, 0x00, 0x01, 0x01, 0x85, 0x00, 0x03, 0x09, 0x01, 0x01, 0x06, 0x86, 0x01, 0x03, 0x03, 0x08,
+	0x01, 0x01, 0x85, 0x00, 0x01, 0x15, 0x0f, 0x89, 0x01, 0x02, 0x04, 0x01, 0x01, 0x86, 0x00, 0x01,
+	0x02, 0x0d, 0x8b, 0x01, 0x87, 0x00, 0x02, 0x13, 0x0c, 0x01, 0x92, 0x00, 0x01, 0x07, 0x01, 0x93,
+	0x00, 0x00, 0x10, 0x89, 0x00,
+};
+
+// 25 x 21 pixels, 27 colours, 286 bytes (was 1054)
+extern const uint8_t IconHomeY[] =
+{
+	25, 21,		// width, height
+	27,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0xd7, 0xbd, 0xae, 0x73, 0x7d, 0xef, 0x18, 0xc6, 0xfb, 0xde, 0x82, 0x10,
+	0x20, 0x00, 0xa2, 0x10, 0x04, 0x21, 0x45, 0x29, 0xe7, 0x39, 0x28, 0x42, 0xaa, 0x52, 0x2c, 0x63,
+	0xd3, 0x9c, 0x34, 0xa5, 0x75, 0xad, 0x38, 0xc6, 0xba, 0xd6, 0xdf, 0xff, 0x86, 0x31, 0x69, 0x4a,
+	0x6d, 0x6b, 0x10, 0x84, 0x5d, 0xef,
+	0x89, 0x01, 0x00, 0x11, 0x92, 0x01, 0x01, 0x05, 0x00, 0x91, 0x01, 0x03, 0x14, 0x09, 0x00, 0x1a,
+	0x8f, 0x01, 0x01, 0x04, 0x0b, 0x8b, 0x00, 0x85, 0x01, 0x01, 0x15, 0x0c, 0x8c, 0x00, 0x85, 0x01,
+	0x00, 0x0e, 0x8d, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x83, 0x01, 0x84, 0x00, 0x00, 0x01, 0x8a, 0x00,
+	0x83, 0x01, 0x84, 0x00, 0x00, 0x01, 0x8a, 0x00, 0x83, 0x01, 0x84, 0x00, 0x81, 0x01, 0x00, 0x12,
+	0x85, 0x00, 0x00, 0x0f, 0x8a, 0x00, 0x02, 0x01, 0x05, 0x08, 0x85, 0x00, 0x02, 0x01, 0x10, 0x07,
+	0x88, 0x00, 0x01, 0x13, 0x07, 0x86, 0x00, 0x81, 0x01, 0x01, 0x04, 0x0f, 0x87, 0x00, 0x00, 0x17,
+	0x87, 0x00, 0x83, 0x01, 0x01, 0x02, 0x0a, 0x85, 0x00, 0x01, 0x13, 0x07, 0x86, 0x00, 0x00, 0x02,
+	0x84, 0x01, 0x83, 0x06, 0x81, 0x00, 0x02, 0x01, 0x05, 0x08, 0x86, 0x00, 0x01, 0x0d, 0x02, 0x86,
+	0x01, 0x81, 0x00, 0x81, 0x01, 0x00, 0x12, 0x86, 0x00, 0x01, 0x0d, 0x02, 0x86, 0x01, 0x81, 0x00,
+	0x82, 0x01, 0x00, 0x10, 0x84, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x83, 0x03, 0x81, 0x00,
+	0x83, 0x01, 0x00, 0x19, 0x83, 0x00, 0x82, 0x01, 0x01, 0x04, 0x03, 0x86, 0x00, 0x84, 0x01, 0x00,
+	0x18, 0x82, 0x00, 0x81, 0x01, 0x01, 0x02, 0x0a, 0x87, 0x00, 0x85, 0x01, 0x04, 0x0e, 0x00, 0x00,
+	0x04, 0x03, 0x89, 0x00, 0x85, 0x01, 0x03, 0x15, 0x0c, 0x00, 0x16, 0x8a, 0x00, 0x86, 0x01, 0x01,
+	0x04, 0x0b, 0x8b, 0x00, 0x87, 0x01, 0x02, 0x14, 0x09, 0x00, 0x92, 0x01, 0x01, 0x05, 0x00, 0x93,
+	0x01, 0x00, 0x11, 0x89, 0x01,
+};
+
+// 25 x 21 pixels, 26 colours, 293 bytes (was 1054)
+extern const uint8_t IconHomeZ[] =
+{
+	25, 21,		// width, height
+	26,			// number of palette entries
+	0xff, 0xff, 0x00, 0x00, 0xae, 0x73, 0xd3, 0x9c, 0x82, 0x10, 0x18, 0xc6, 0xaa, 0x52, 0x7d, 0xef,
+	0x20, 0x00, 0xa2, 0x10, 0x45, 0x29, 0xe7, 0x39, 0x34, 0xa5, 0x75, 0xad, 0x38, 0xc6, 0xba, 0xd6,
+	0xfb, 0xde, 0xdf, 0xff, 0x04, 0x21, 0x28, 0x42, 0x69, 0x4a, 0x2c, 0x63, 0x6d, 0x6b, 0x10, 0x84,
+	0xd7, 0xbd, 0x5d, 0xef,
+	0x89, 0x00, 0x00, 0x0c, 0x92, 0x00, 0x01, 0x05, 0x01, 0x91, 0x00, 0x03, 0x0f, 0x09, 0x01, 0x19,
+	0x8f, 0x00, 0x01, 0x07, 0x0a, 0x8b, 0x01, 0x85, 0x00, 0x01, 0x11, 0x0b, 0x8c, 0x01, 0x85, 0x00,
+	0x00, 0x06, 0x8d, 0x01, 0x00, 0x00, 0x93, 0x01, 0x00, 0x00, 0x8a, 0x01, 0x83, 0x00, 0x84, 0x01,
+	0x00, 0x00, 0x8a, 0x01, 0x83, 0x00, 0x84, 0x01, 0x81, 0x00, 0x00, 0x0d, 0x88, 0x01, 0x83, 0x00,
+	0x84, 0x01, 0x02, 0x00, 0x05, 0x08, 0x91, 0x01, 0x01, 0x0e, 0x04, 0x86, 0x01, 0x82, 0x02, 0x82,
+	0x01, 0x00, 0x04, 0x82, 0x03, 0x81, 0x01, 0x00, 0x14, 0x87, 0x01, 0x82, 0x00, 0x81, 0x01, 0x01,
+	0x12, 0x10, 0x82, 0x00, 0x81, 0x01, 0x01, 0x0e, 0x04, 0x86, 0x01, 0x82, 0x00, 0x02, 0x01, 0x13,
+	0x07, 0x83, 0x00, 0x81, 0x01, 0x02, 0x00, 0x05, 0x08, 0x85, 0x01, 0x82, 0x00, 0x00, 0x15, 0x85,
+	0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x0d, 0x85, 0x01, 0x85, 0x00, 0x00, 0x10, 0x82, 0x00, 0x81,
+	0x01, 0x82, 0x00, 0x00, 0x03, 0x84, 0x01, 0x84, 0x00, 0x01, 0x18, 0x04, 0x82, 0x00, 0x81, 0x01,
+	0x83, 0x00, 0x00, 0x17, 0x83, 0x01, 0x83, 0x00, 0x02, 0x03, 0x01, 0x01, 0x82, 0x00, 0x81, 0x01,
+	0x84, 0x00, 0x00, 0x16, 0x82, 0x01, 0x82, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x00, 0x81, 0x01,
+	0x85, 0x00, 0x05, 0x06, 0x01, 0x01, 0x02, 0x02, 0x06, 0x83, 0x01, 0x82, 0x02, 0x81, 0x01, 0x85,
+	0x00, 0x01, 0x11, 0x0b, 0x8c, 0x01, 0x86, 0x00, 0x01, 0x07, 0x0a, 0x8b, 0x01, 0x87, 0x00, 0x02,
+	0x0f, 0x09, 0x01, 0x92, 0x00, 0x01, 0x05, 0x01, 0x93, 0x00, 0x00, 0x0c, 0x89, 0x00,
+};
+
+// 25 x 21 pixels, 22 colours, 258 bytes (was 1054)
+extern const uint8_t IconHomeU[] =
+{
+	25, 21,		// width, height
+	22,			// number of palette entries
+	0xff, 0xff, 0x00, 0x00, 0x18, 0xc6, 0xef, 0x7b, 0x82, 0x10, 0x20, 0x00, 0xa2, 0x10, 0x45, 0x29,
+	0xaa, 0x52, 0x34, 0xa5, 0x75, 0xad, 0x38, 0xc6, 0xba, 0xd6, 0x7d, 0xef, 0xdf, 0xff, 0xc7, 0x39,
+	0xe7, 0x39, 0x69, 0x4a, 0x6d, 0x6b, 0x10, 0x84, 0xd3, 0x9c, 0x5d, 0xef,
+	0x89, 0x00, 0x00, 0x09, 0x92, 0x00, 0x01, 0x02, 0x01, 0x91, 0x00, 0x03, 0x0c, 0x06, 0x01, 0x15,
+	0x8f, 0x00, 0x01, 0x0d, 0x07, 0x8b, 0x01, 0x85, 0x00, 0x01, 0x0e, 0x10, 0x8c, 0x01, 0x85, 0x00,
+	0x00, 0x08, 0x8d, 0x01, 0x00, 0x00, 0x8a, 0x01, 0x83, 0x00, 0x84, 0x01, 0x00, 0x00, 0x8a, 0x01,
+	0x83, 0x00, 0x84, 0x01, 0x00, 0x00, 0x8a, 0x01, 0x83, 0x00, 0x84, 0x01, 0x81, 0x00, 0x00, 0x0a,
+	0x91, 0x01, 0x02, 0x00, 0x02, 0x05, 0x87, 0x01, 0x00, 0x04, 0x88, 0x01, 0x01, 0x0b, 0x04, 0x86,
+	0x01, 0x86, 0x00, 0x00, 0x03, 0x83, 0x01, 0x00, 0x11, 0x87, 0x01, 0x87, 0x00, 0x00, 0x02, 0x82,
+	0x01, 0x01, 0x0b, 0x04, 0x86, 0x01, 0x88, 0x00, 0x05, 0x03, 0x01, 0x01, 0x00, 0x02, 0x05, 0x8a,
+	0x01, 0x00, 0x02, 0x82, 0x00, 0x05, 0x02, 0x01, 0x01, 0x00, 0x00, 0x0a, 0x8b, 0x01, 0x83, 0x00,
+	0x81, 0x01, 0x82, 0x00, 0x00, 0x14, 0x89, 0x01, 0x00, 0x02, 0x82, 0x00, 0x02, 0x02, 0x01, 0x01,
+	0x83, 0x00, 0x00, 0x13, 0x83, 0x01, 0x88, 0x00, 0x02, 0x03, 0x01, 0x01, 0x84, 0x00, 0x00, 0x12,
+	0x82, 0x01, 0x87, 0x00, 0x00, 0x02, 0x82, 0x01, 0x85, 0x00, 0x02, 0x08, 0x01, 0x01, 0x86, 0x00,
+	0x00, 0x03, 0x83, 0x01, 0x85, 0x00, 0x01, 0x0e, 0x0f, 0x8c, 0x01, 0x86, 0x00, 0x01, 0x0d, 0x07,
+	0x8b, 0x01, 0x87, 0x00, 0x02, 0x0c, 0x06, 0x01, 0x92, 0x00, 0x01, 0x02, 0x01, 0x93, 0x00, 0x00,
+	0x09, 0x89, 0x00,
+};
+
+// 25 x 21 pixels, 4 colours, 209 bytes (was 1054)
+extern const uint8_t IconBedComp[] =
+{
+	25, 21,		// width, height
+	4,			// number of palette entries
+	0xff, 0xff, 0x00, 0x00, 0x18, 0xc6, 0xef, 0x7b,
+	0x88, 0x00, 0x81, 0x01, 0x92, 0x00, 0x81, 0x01, 0x92, 0x00, 0x81, 0x01, 0x92, 0x00, 0x02, 0x03,
+	0x01, 0x02, 0x83, 0x00, 0x00, 0x02, 0x8c, 0x00, 0x02, 0x02, 0x01, 0x03, 0x82, 0x00, 0x01, 0x02,
+	0x01, 0x8d, 0x00, 0x81, 0x01, 0x81, 0x00, 0x02, 0x02, 0x01, 0x01, 0x8d, 0x00, 0x81, 0x01, 0x01,
+	0x00, 0x02, 0x86, 0x01, 0x89, 0x00, 0x81, 0x01, 0x01, 0x00, 0x02, 0x86, 0x01, 0x89, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x02, 0x02, 0x01, 0x01, 0x8c, 0x00, 0x02, 0x02, 0x01, 0x03, 0x82, 0x00, 0x01,
+	0x02, 0x01, 0x8c, 0x00, 0x02, 0x03, 0x01, 0x02, 0x83, 0x00, 0x00, 0x02, 0x8c, 0x00, 0x81, 0x01,
+	0x92, 0x00, 0x81, 0x01, 0x8c, 0x00, 0x00, 0x02, 0x83, 0x00, 0x02, 0x02, 0x01, 0x03, 0x8c, 0x00,
+	0x01, 0x01, 0x02, 0x82, 0x00, 0x02, 0x03, 0x01, 0x02, 0x8c, 0x00, 0x81, 0x01, 0x04, 0x02, 0x00,
+	0x00, 0x01, 0x01, 0x8a, 0x00, 0x85, 0x01, 0x03, 0x02, 0x00, 0x01, 0x01, 0x8a, 0x00, 0x85, 0x01,
+	0x03, 0x02, 0x00, 0x01, 0x01, 0x8d, 0x00, 0x81, 0x01, 0x04, 0x02, 0x00, 0x00, 0x01, 0x01, 0x8d,
+	0x00, 0x01, 0x01, 0x02, 0x82, 0x00, 0x02, 0x03, 0x01, 0x02, 0x8c, 0x00, 0x00, 0x02, 0x83, 0x00,
+	0x02, 0x02, 0x01, 0x03, 0x92, 0x00, 0x81, 0x01, 0x92, 0x00, 0x81, 0x01, 0x92, 0x00, 0x81, 0x01,
+	0x92, 0x00, 0x81, 0x01, 0x89, 0x00,
+};
+
+#endif
+
+// Icons from KeyIcons.cpp
+
+#if LARGE_FONT
+
+// 30 x 24 pixels, 29 colours, 385 bytes (was 1444)
+extern const uint8_t IconBackspace[] =
+{
+	30, 24,		// width, height
+	29,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0x28, 0x42, 0x75, 0xad, 0x9e, 0xf7, 0x61, 0x08, 0xa2, 0x10, 0x34, 0xa5,
+	0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0x20, 0x00, 0x8a, 0x52, 0x79, 0xce, 0x82, 0x10, 0xc3, 0x18,
+	0xe3, 0x18, 0x04, 0x21, 0xa6, 0x31, 0x08, 0x42, 0xaa, 0x52, 0xae, 0x73, 0xcf, 0x7b, 0x30, 0x84,
+	0xf3, 0x9c, 0x55, 0xad, 0x18, 0xc6, 0x38, 0xc6, 0x7d, 0xef,
+	0x89, 0x01, 0x03, 0x04, 0x13, 0x13, 0x04, 0x92, 0x01, 0x05, 0x03, 0x05, 0x00, 0x00, 0x05, 0x03,
+	0x8f, 0x01, 0x01, 0x1c, 0x14, 0x85, 0x00, 0x01, 0x14, 0x1c, 0x8c, 0x01, 0x01, 0x19, 0x0e, 0x87,
+	0x00, 0x01, 0x0e, 0x19, 0x89, 0x01, 0x01, 0x04, 0x0c, 0x8b, 0x00, 0x01, 0x0c, 0x04, 0x86, 0x01,
+	0x01, 0x03, 0x05, 0x8d, 0x00, 0x01, 0x05, 0x03, 0x83, 0x01, 0x01, 0x04, 0x0c, 0x91, 0x00, 0x04,
+	0x0c, 0x04, 0x01, 0x07, 0x12, 0x93, 0x00, 0x02, 0x12, 0x07, 0x02, 0x95, 0x00, 0x81, 0x02, 0x95,
+	0x00, 0x81, 0x02, 0x95, 0x00, 0x81, 0x02, 0x84, 0x00, 0x02, 0x06, 0x16, 0x06, 0x85, 0x00, 0x02,
+	0x06, 0x16, 0x06, 0x84, 0x00, 0x81, 0x02, 0x83, 0x00, 0x03, 0x0b, 0x0d, 0x01, 0x08, 0x85, 0x00,
+	0x03, 0x08, 0x01, 0x0d, 0x0b, 0x83, 0x00, 0x81, 0x02, 0x83, 0x00, 0x04, 0x0b, 0x0d, 0x01, 0x01,
+	0x03, 0x83, 0x00, 0x04, 0x03, 0x01, 0x01, 0x0d, 0x0b, 0x83, 0x00, 0x81, 0x02, 0x85, 0x00, 0x09,
+	0x09, 0x01, 0x01, 0x08, 0x00, 0x00, 0x08, 0x01, 0x01, 0x09, 0x85, 0x00, 0x81, 0x02, 0x86, 0x00,
+	0x07, 0x09, 0x01, 0x01, 0x18, 0x18, 0x01, 0x01, 0x09, 0x86, 0x00, 0x81, 0x02, 0x87, 0x00, 0x00,
+	0x03, 0x83, 0x01, 0x00, 0x03, 0x87, 0x00, 0x81, 0x02, 0x87, 0x00, 0x05, 0x10, 0x04, 0x01, 0x01,
+	0x04, 0x10, 0x87, 0x00, 0x81, 0x02, 0x87, 0x00, 0x00, 0x07, 0x83, 0x01, 0x00, 0x07, 0x87, 0x00,
+	0x81, 0x02, 0x86, 0x00, 0x07, 0x08, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x08, 0x86, 0x00, 0x81,
+	0x02, 0x85, 0x00, 0x09, 0x03, 0x01, 0x01, 0x0a, 0x00, 0x00, 0x0a, 0x01, 0x01, 0x03, 0x85, 0x00,
+	0x81, 0x02, 0x84, 0x00, 0x03, 0x1b, 0x01, 0x01, 0x09, 0x83, 0x00, 0x03, 0x09, 0x01, 0x01, 0x1b,
+	0x84, 0x00, 0x81, 0x02, 0x84, 0x00, 0x02, 0x0a, 0x01, 0x0a, 0x85, 0x00, 0x02, 0x0a, 0x01, 0x0a,
+	0x84, 0x00, 0x81, 0x02, 0x84, 0x00, 0x02, 0x05, 0x15, 0x0f, 0x85, 0x00, 0x02, 0x0f, 0x15, 0x05,
+	0x84, 0x00, 0x81, 0x02, 0x95, 0x00, 0x81, 0x02, 0x95, 0x00, 0x81, 0x02, 0x95, 0x00, 0x81, 0x02,
+	0x95, 0x00, 0x02, 0x02, 0x17, 0x06, 0x93, 0x00, 0x04, 0x06, 0x17, 0x01, 0x1a, 0x11, 0x91, 0x00,
+	0x02, 0x11, 0x1a, 0x01,
+};
+
+// 17 x 30 pixels, 3 colours, 121 bytes (was 1024)
+extern const uint8_t IconDown[] =
+{
+	17, 30,		// width, height
+	3,			// number of palette entries
+	0xff, 0xff, 0x00, 0x00, 0x18, 0xc6,
+	0x92, 0x00, 0x82, 0x02, 0x9a, 0x00, 0x82, 0x01, 0x00, 0x02, 0x99, 0x00, 0x83, 0x01, 0x00, 0x02,
+	0x98, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x98, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02,
+	0x98, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x98, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02,
+	0x83, 0x00, 0x99, 0x01, 0x00, 0x02, 0x82, 0x00, 0x9a, 0x01, 0x82, 0x00, 0x99, 0x01, 0x00, 0x02,
+	0x96, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x96, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02,
+	0x96, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x96, 0x00, 0x00, 0x02, 0x83, 0x01, 0x98, 0x00,
+	0x83, 0x01, 0x00, 0x02, 0x98, 0x00, 0x82, 0x01, 0x00, 0x02, 0x99, 0x00, 0x82, 0x02, 0x87, 0x00,
+};
+
+// 17 x 30 pixels, 3 colours, 121 bytes (was 1024)
+extern const uint8_t IconUp[] =
+{
+	17, 30,		// width, height
+	3,			// number of palette entries
+	0xff, 0xff, 0x00, 0x00, 0x18, 0xc6,
+	0x87, 0x00, 0x82, 0x02, 0x99, 0x00, 0x00, 0x02, 0x82, 0x01, 0x98, 0x00, 0x00, 0x02, 0x83, 0x01,
+	0x98, 0x00, 0x83, 0x01, 0x00, 0x02, 0x96, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x96, 0x00,
+	0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x96, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x96, 0x00,
+	0x00, 0x02, 0x99, 0x01, 0x82, 0x00, 0x9a, 0x01, 0x82, 0x00, 0x00, 0x02, 0x99, 0x01, 0x83, 0x00,
+	0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x98, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x98, 0x00,
+	0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x98, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x98, 0x00,
+	0x00, 0x02, 0x83, 0x01, 0x99, 0x00, 0x00, 0x02, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x02, 0x92, 0x00,
+};
+
+// 30 x 30 pixels, 3 colours, 179 bytes (was 1804)
+extern const uint8_t IconEnter[] =
+{
+	30, 30,		// width, height
+	3,			// number of palette entries
+	0xff, 0xff, 0x00, 0x00, 0x18, 0xc6,
+	0x90, 0x00, 0x02, 0x02, 0x01, 0x02, 0x99, 0x00, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x97, 0x00,
+	0x00, 0x02, 0x84, 0x01, 0x00, 0x02, 0x95, 0x00, 0x00, 0x02, 0x86, 0x01, 0x00, 0x02, 0x93, 0x00,
+	0x00, 0x02, 0x88, 0x01, 0x00, 0x02, 0x91, 0x00, 0x00, 0x02, 0x8a, 0x01, 0x00, 0x02, 0x8f, 0x00,
+	0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x8e, 0x00,
+	0x00, 0x02, 0x82, 0x01, 0x01, 0x02, 0x00, 0x82, 0x01, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02,
+	0x94, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01,
+	0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01,
+	0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01,
+	0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01,
+	0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x9a, 0x00, 0x82, 0x01, 0x8d, 0x00, 0x8f, 0x01,
+	0x8d, 0x00, 0x8f, 0x01, 0x8d, 0x00, 0x8f, 0x01, 0x89, 0x00,
+};
+
+#else
+
+// 28 x 18 pixels, 25 colours, 268 bytes (was 1012)
+extern const uint8_t IconBackspace[] =
+{
+	28, 18,		// width, height
+	25,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0x75, 0xad, 0x61, 0x08, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0x9e, 0xf7,
+	0x20, 0x00, 0xa2, 0x10, 0x34, 0xa5, 0x79, 0xce, 0x82, 0x10, 0xc3, 0x18, 0xe3, 0x18, 0x08, 0x42,
+	0x8a, 0x52, 0xaa, 0x52, 0xae, 0x73, 0xcf, 0x7b, 0xf3, 0x9c, 0x55, 0xad, 0x18, 0xc6, 0x38, 0xc6,
+	0x7d, 0xef,
+	0x86, 0x01, 0x03, 0x07, 0x0f, 0x0f, 0x07, 0x8c, 0x01, 0x05, 0x02, 0x03, 0x00, 0x00, 0x03, 0x02,
+	0x89, 0x01, 0x01, 0x18, 0x11, 0x85, 0x00, 0x01, 0x11, 0x18, 0x86, 0x01, 0x01, 0x15, 0x0c, 0x87,
+	0x00, 0x01, 0x0c, 0x15, 0x83, 0x01, 0x01, 0x07, 0x10, 0x8b, 0x00, 0x04, 0x10, 0x07, 0x01, 0x02,
+	0x03, 0x8d, 0x00, 0x01, 0x03, 0x02, 0xca, 0x00, 0x02, 0x09, 0x13, 0x09, 0x85, 0x00, 0x02, 0x09,
+	0x13, 0x09, 0x84, 0x00, 0x03, 0x08, 0x0b, 0x01, 0x04, 0x85, 0x00, 0x03, 0x04, 0x01, 0x0b, 0x08,
+	0x83, 0x00, 0x04, 0x08, 0x0b, 0x01, 0x01, 0x02, 0x83, 0x00, 0x04, 0x02, 0x01, 0x01, 0x0b, 0x08,
+	0x85, 0x00, 0x09, 0x05, 0x01, 0x01, 0x04, 0x00, 0x00, 0x04, 0x01, 0x01, 0x05, 0x88, 0x00, 0x07,
+	0x05, 0x01, 0x01, 0x14, 0x14, 0x01, 0x01, 0x05, 0x8a, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02,
+	0x8b, 0x00, 0x05, 0x0e, 0x07, 0x01, 0x01, 0x07, 0x0e, 0x8b, 0x00, 0x00, 0x0a, 0x83, 0x01, 0x00,
+	0x0a, 0x8a, 0x00, 0x07, 0x04, 0x01, 0x01, 0x0a, 0x0a, 0x01, 0x01, 0x04, 0x88, 0x00, 0x09, 0x02,
+	0x01, 0x01, 0x06, 0x00, 0x00, 0x06, 0x01, 0x01, 0x02, 0x86, 0x00, 0x03, 0x17, 0x01, 0x01, 0x05,
+	0x83, 0x00, 0x03, 0x05, 0x01, 0x01, 0x17, 0x85, 0x00, 0x02, 0x06, 0x01, 0x06, 0x85, 0x00, 0x02,
+	0x06, 0x01, 0x06, 0x85, 0x00, 0x02, 0x03, 0x12, 0x0d, 0x85, 0x00, 0x02, 0x0d, 0x12, 0x03, 0xca,
+	0x00, 0x00, 0x16, 0x8f, 0x00, 0x00, 0x16,
+};
+
+// 17 x 21 pixels, 3 colours, 120 bytes (was 718)
+extern const uint8_t IconUp[] =
+{
+	17, 21,		// width, height
+	3,			// number of palette entries
+	0xff, 0xff, 0x00, 0x00, 0x18, 0xc6,
+	0x87, 0x00, 0x82, 0x02, 0x90, 0x00, 0x00, 0x02, 0x82, 0x01, 0x8f, 0x00, 0x00, 0x02, 0x83, 0x01,
+	0x8f, 0x00, 0x83, 0x01, 0x00, 0x02, 0x8d, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x8d, 0x00,
+	0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x8d, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x8d, 0x00,
+	0x00, 0x02, 0x92, 0x01, 0x00, 0x00, 0x93, 0x01, 0x01, 0x00, 0x02, 0x92, 0x01, 0x81, 0x00, 0x00,
+	0x02, 0x83, 0x01, 0x00, 0x02, 0x8f, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x8f, 0x00, 0x00,
+	0x02, 0x83, 0x01, 0x00, 0x02, 0x8f, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x8f, 0x00, 0x00,
+	0x02, 0x83, 0x01, 0x90, 0x00, 0x00, 0x02, 0x82, 0x01, 0x91, 0x00, 0x82, 0x02, 0x89, 0x00,
+};
+
+// 17 x 21 pixels, 3 colours, 120 bytes (was 718)
+extern const uint8_t IconDown[] =
+{
+	17, 21,		// width, height
+	3,			// number of palette entries
+	0xff, 0xff, 0x00, 0x00, 0x18, 0xc6,
+	0x89, 0x00, 0x82, 0x02, 0x91, 0x00, 0x82, 0x01, 0x00, 0x02, 0x90, 0x00, 0x83, 0x01, 0x00, 0x02,
+	0x8f, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x8f, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02,
+	0x8f, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x8f, 0x00, 0x00, 0x02, 0x83, 0x01, 0x02, 0x02,
+	0x00, 0x00, 0x92, 0x01, 0x01, 0x02, 0x00, 0x93, 0x01, 0x00, 0x00, 0x92, 0x01, 0x00, 0x02, 0x8d,
+	0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x8d, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x8d,
+	0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x8d, 0x00, 0x00, 0x02, 0x83, 0x01, 0x8f, 0x00, 0x83,
+	0x01, 0x00, 0x02, 0x8f, 0x00, 0x82, 0x01, 0x00, 0x02, 0x90, 0x00, 0x82, 0x02, 0x87, 0x00,
+};
+
+// 30 x 21 pixels, 3 colours, 179 bytes (was 1264)
+extern const uint8_t IconEnter[] =
+{
+	30, 21,		// width, height
+	3,			// number of palette entries
+	0xff, 0xff, 0x00, 0x00, 0x18, 0xc6,
+	0x8a, 0x00, 0x02, 0x02, 0x01, 0x02, 0x90, 0x00, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x8e, 0x00,
+	0x00, 0x02, 0x84, 0x01, 0x00, 0x02, 0x8c, 0x00, 0x00, 0x02, 0x86, 0x01, 0x00, 0x02, 0x8a, 0x00,
+	0x00, 0x02, 0x88, 0x01, 0x00, 0x02, 0x88, 0x00, 0x00, 0x02, 0x8a, 0x01, 0x00, 0x02, 0x86, 0x00,
+	0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x85, 0x00,
+	0x00, 0x02, 0x82, 0x01, 0x01, 0x02, 0x00, 0x82, 0x01, 0x01, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02,
+	0x8b, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01,
+	0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01,
+	0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01,
+	0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01,
+	0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01, 0x87, 0x00, 0x8c, 0x01,
+	0x87, 0x00, 0x8c, 0x01, 0x87, 0x00, 0x8c, 0x01, 0x86, 0x00,
+};
+
+#endif
+
+// Icons from MiscIcons.cpp
+
+#if LARGE_FONT
+
+// 30 x 30 pixels, 223 colours, 1226 bytes (was 1804)
+extern const uint8_t IconCancel[] =
+{
+	30, 30,		// width, height
+	223,			// number of palette entries
+	0xff, 0xff, 0xc1, 0xa8, 0xc1, 0xb0, 0xe1, 0xc0, 0xe1, 0xc8, 0xc1, 0xa0, 0xe1, 0xb8, 0x01, 0xd1,
+	0x2b, 0xb3, 0x8d, 0xbb, 0xce, 0xbb, 0xe1, 0xd0, 0xea, 0xb2, 0x01, 0xd9, 0x01, 0xe1, 0xa1, 0x98,
+	0x2f, 0xbc, 0x89, 0xb2, 0x00, 0xb8, 0xa1, 0x90, 0x60, 0x98, 0xc1, 0x98, 0xca, 0xb2, 0xce, 0xc3,
+	0x00, 0x88, 0x64, 0x91, 0x80, 0x98, 0xa0, 0x98, 0x00, 0xa0, 0xa1, 0xa0, 0x00, 0xb0, 0x68, 0xb2,
+	0xc1, 0xb8, 0x30, 0xbc, 0xb2, 0xc4, 0xd2, 0xcc, 0xd2, 0xd4, 0x91, 0xdc, 0x13, 0xdd, 0x01, 0xe9,
+	0x80, 0x80, 0x07, 0x8a, 0x00, 0x90, 0x60, 0x90, 0x80, 0x90, 0xa0, 0x90, 0x85, 0x91, 0x6d, 0x9b,
+	0x02, 0xa1, 0x84, 0xa1, 0x00, 0xa8, 0xe6, 0xa9, 0x50, 0xac, 0x88, 0xb2, 0xea, 0xba, 0x4c, 0xbb,
+	0xd2, 0xbc, 0xf3, 0xbc, 0x8d, 0xc3, 0x0f, 0xc4, 0xf3, 0xc4, 0x00, 0xc8, 0x91, 0xcc, 0xf3, 0xcc,
+	0x34, 0xcd, 0x34, 0xd5, 0x54, 0xd5, 0x75, 0xd5, 0xd2, 0xdc, 0x54, 0xdd, 0x95, 0xdd, 0xd6, 0xdd,
+	0xc9, 0xe2, 0x34, 0xe5, 0x54, 0xe5, 0xba, 0xe6, 0x22, 0xe9, 0xda, 0xee, 0x79, 0xfe, 0x5d, 0xff,
+	0xbe, 0xff, 0x61, 0x78, 0x00, 0x80, 0x40, 0x80, 0x60, 0x80, 0x61, 0x80, 0x81, 0x80, 0xc2, 0x80,
+	0xc6, 0x81, 0x40, 0x88, 0x60, 0x88, 0x80, 0x88, 0xa0, 0x88, 0xa1, 0x88, 0x69, 0x8a, 0x02, 0x91,
+	0x03, 0x91, 0x43, 0x91, 0xa5, 0x91, 0xc6, 0x91, 0x27, 0x92, 0x48, 0x92, 0x69, 0x92, 0x89, 0x92,
+	0x20, 0x98, 0x85, 0x99, 0x48, 0x9a, 0x68, 0x9a, 0x80, 0xa0, 0xa0, 0xa0, 0x23, 0xa1, 0x43, 0xa1,
+	0x64, 0xa1, 0xe6, 0xa1, 0x27, 0xa2, 0xa9, 0xa2, 0x0b, 0xa3, 0x6c, 0xa3, 0xce, 0xa3, 0xee, 0xa3,
+	0xa5, 0xa9, 0xc5, 0xa9, 0x27, 0xaa, 0x88, 0xaa, 0x8d, 0xab, 0xce, 0xab, 0x80, 0xb0, 0xa0, 0xb0,
+	0x63, 0xb1, 0x64, 0xb1, 0xc5, 0xb1, 0x27, 0xb2, 0x47, 0xb2, 0xa9, 0xb2, 0x2c, 0xb3, 0x6c, 0xb3,
+	0xad, 0xb3, 0x0f, 0xb4, 0x2f, 0xb4, 0x30, 0xb4, 0x71, 0xb4, 0x91, 0xb4, 0xc0, 0xb8, 0x43, 0xb9,
+	0xe5, 0xb9, 0x47, 0xba, 0x0b, 0xbb, 0x6d, 0xbb, 0x71, 0xbc, 0x40, 0xc0, 0x63, 0xc1, 0x4c, 0xc3,
+	0xef, 0xc3, 0x50, 0xc4, 0x91, 0xc4, 0xd2, 0xc4, 0x13, 0xc5, 0x34, 0xc5, 0x06, 0xca, 0x26, 0xca,
+	0x68, 0xca, 0xea, 0xca, 0x4c, 0xcb, 0xce, 0xcb, 0x2f, 0xcc, 0x50, 0xcc, 0xb1, 0xcc, 0x13, 0xcd,
+	0x43, 0xd1, 0x63, 0xd1, 0x47, 0xd2, 0x67, 0xd2, 0xa8, 0xd2, 0x0a, 0xd3, 0xee, 0xd3, 0x0f, 0xd4,
+	0x2f, 0xd4, 0x70, 0xd4, 0x71, 0xd4, 0xb1, 0xd4, 0xf3, 0xd4, 0x27, 0xda, 0xc9, 0xda, 0x8c, 0xdb,
+	0x70, 0xdc, 0xb1, 0xdc, 0x34, 0xdd, 0x75, 0xdd, 0xb6, 0xdd, 0xd7, 0xdd, 0x18, 0xde, 0x79, 0xde,
+	0xb2, 0xe4, 0xd2, 0xe4, 0xf2, 0xe4, 0xf3, 0xe4, 0x13, 0xe5, 0x74, 0xe5, 0x58, 0xe6, 0x99, 0xe6,
+	0x21, 0xe9, 0xc9, 0xea, 0xca, 0xea, 0x0a, 0xeb, 0xb6, 0xed, 0x0a, 0xf3, 0xcd, 0xf3, 0xee, 0xf3,
+	0x58, 0xf6, 0x99, 0xf6, 0xfb, 0xf6, 0x3c, 0xf7, 0x95, 0xfd, 0xb5, 0xfd, 0xd6, 0xfd, 0x37, 0xfe,
+	0x38, 0xfe, 0x58, 0xfe, 0x99, 0xfe, 0xfb, 0xfe, 0x1c, 0xff, 0x3c, 0xff, 0x7d, 0xff,
+	0x89, 0x00, 0x09, 0x4f, 0xc5, 0xae, 0xa1, 0x90, 0x82, 0x36, 0x17, 0x45, 0xd3, 0x91, 0x00, 0x05,
+	0xd1, 0xac, 0x7f, 0x01, 0x05, 0x05, 0x84, 0x01, 0x02, 0x05, 0x72, 0x47, 0x8d, 0x00, 0x11, 0x50,
+	0xb6, 0x32, 0x68, 0x2d, 0x0f, 0x15, 0x05, 0x01, 0x01, 0x02, 0x02, 0x06, 0x03, 0x20, 0x6d, 0x63,
+	0x4d, 0x8a, 0x00, 0x0a, 0xdb, 0x95, 0x18, 0x54, 0x5c, 0x2d, 0x15, 0x05, 0x05, 0x01, 0x01, 0x82,
+	0x02, 0x05, 0x06, 0x03, 0x04, 0x20, 0x5b, 0x40, 0x88, 0x00, 0x0b, 0xd7, 0x12, 0x52, 0x62, 0x7b,
+	0x11, 0x6e, 0x14, 0x05, 0x05, 0x01, 0x01, 0x82, 0x02, 0x81, 0x06, 0x04, 0x03, 0x07, 0x04, 0x2c,
+	0x8b, 0x86, 0x00, 0x0c, 0x4e, 0x12, 0x51, 0x74, 0x17, 0x37, 0x92, 0x79, 0x14, 0x05, 0x05, 0x01,
+	0x01, 0x82, 0x02, 0x81, 0x06, 0x81, 0x03, 0x03, 0x07, 0x0d, 0x5d, 0x9b, 0x84, 0x00, 0x0d, 0xde,
+	0x3d, 0x53, 0x89, 0x99, 0x08, 0x0c, 0x16, 0x33, 0x1a, 0x1d, 0x05, 0x01, 0x01, 0x82, 0x02, 0x81,
+	0x06, 0x82, 0x03, 0x81, 0x0d, 0x01, 0x28, 0xbf, 0x83, 0x00, 0x0d, 0xcd, 0x2a, 0x77, 0xa6, 0x93,
+	0x86, 0x0c, 0x3a, 0x35, 0x0f, 0x1b, 0x05, 0x01, 0x01, 0x82, 0x02, 0x08, 0x8f, 0x9f, 0x03, 0x03,
+	0x04, 0x04, 0x0e, 0x03, 0x29, 0x82, 0x00, 0x0e, 0x4e, 0x1e, 0x67, 0x40, 0x0a, 0x09, 0x08, 0xa5,
+	0x00, 0xbc, 0x30, 0x1a, 0x05, 0x01, 0x01, 0x82, 0x02, 0x12, 0xc2, 0x00, 0xad, 0x03, 0x04, 0x04,
+	0x0b, 0x27, 0x0f, 0x9d, 0x00, 0x00, 0xcb, 0x2b, 0x8d, 0x9a, 0x0a, 0x09, 0x98, 0x82, 0x00, 0x02,
+	0x24, 0x0f, 0x05, 0x82, 0x01, 0x01, 0x02, 0x25, 0x82, 0x00, 0x00, 0xaa, 0x82, 0x04, 0x0c, 0x0e,
+	0x04, 0x64, 0x00, 0xdd, 0x12, 0x66, 0x43, 0x10, 0x0a, 0x09, 0x08, 0xc6, 0x82, 0x00, 0x05, 0xb3,
+	0x05, 0x01, 0x01, 0x02, 0xb8, 0x82, 0x00, 0x12, 0xcc, 0x03, 0x04, 0x04, 0x0b, 0x07, 0x27, 0x13,
+	0x4b, 0xd5, 0x1c, 0x2f, 0x42, 0x10, 0x0a, 0x09, 0x08, 0x16, 0x47, 0x82, 0x00, 0x03, 0x24, 0x01,
+	0x01, 0x25, 0x82, 0x00, 0x14, 0x49, 0x03, 0x03, 0x04, 0x04, 0x0b, 0x07, 0x4c, 0x01, 0x9c, 0xcf,
+	0x1b, 0x34, 0x3f, 0x21, 0x0a, 0x09, 0x08, 0x0c, 0x1f, 0x46, 0x82, 0x00, 0x01, 0xaf, 0xa3, 0x82,
+	0x00, 0x16, 0xc4, 0x06, 0x03, 0x03, 0x04, 0x04, 0x0b, 0x07, 0x0e, 0x03, 0x7c, 0x48, 0x5f, 0x38,
+	0x23, 0x21, 0x0a, 0x09, 0x08, 0x0c, 0x11, 0x7a, 0x46, 0x85, 0x00, 0x18, 0x4a, 0x06, 0x06, 0x03,
+	0x03, 0x04, 0x04, 0x0b, 0x07, 0x0e, 0x07, 0x6b, 0xa9, 0x19, 0x3c, 0x22, 0x21, 0x0a, 0x09, 0x08,
+	0x0c, 0x11, 0x1f, 0x78, 0xa4, 0x83, 0x00, 0x19, 0x25, 0x02, 0x06, 0x06, 0x03, 0x03, 0x04, 0x04,
+	0x0b, 0x07, 0x0d, 0x0d, 0x2e, 0xa8, 0x19, 0x3c, 0x22, 0x10, 0x0a, 0x09, 0x08, 0x0c, 0x11, 0x1f,
+	0x70, 0x3a, 0x83, 0x00, 0x18, 0xb0, 0x02, 0x06, 0x06, 0x03, 0x03, 0x04, 0x04, 0x0b, 0x07, 0x0d,
+	0x0d, 0x2e, 0x48, 0x60, 0x38, 0x23, 0x10, 0x0a, 0x09, 0x08, 0x0c, 0x11, 0x84, 0xb4, 0x85, 0x00,
+	0x16, 0x44, 0x06, 0x06, 0x03, 0x03, 0x04, 0x04, 0x0b, 0x07, 0x0e, 0x07, 0x6a, 0xce, 0x0f, 0x34,
+	0x3f, 0x10, 0x0a, 0x09, 0x08, 0x0c, 0x35, 0x41, 0x82, 0x00, 0x01, 0xb2, 0xb1, 0x82, 0x00, 0x14,
+	0xb9, 0x06, 0x03, 0x03, 0x04, 0x04, 0x0b, 0x07, 0x0e, 0x03, 0x75, 0xd4, 0x1c, 0x2f, 0x42, 0x10,
+	0x0a, 0x09, 0x08, 0x16, 0xbb, 0x82, 0x00, 0x03, 0xba, 0x01, 0x01, 0x26, 0x82, 0x00, 0x12, 0xc0,
+	0x03, 0x03, 0x04, 0x04, 0x0b, 0x07, 0x4c, 0x02, 0x39, 0xdc, 0x12, 0x65, 0x43, 0x10, 0x0a, 0x09,
+	0x08, 0xbd, 0x82, 0x00, 0x05, 0x26, 0x05, 0x01, 0x01, 0x02, 0x44, 0x82, 0x00, 0x10, 0x49, 0x03,
+	0x04, 0x04, 0x0b, 0x07, 0x27, 0x13, 0x4b, 0x00, 0xc9, 0x59, 0x8c, 0x3e, 0x0a, 0x09, 0x3b, 0x82,
+	0x00, 0x07, 0x26, 0x05, 0x05, 0x01, 0x01, 0x02, 0x02, 0xc3, 0x82, 0x00, 0x00, 0xab, 0x82, 0x04,
+	0x13, 0x0e, 0x04, 0x29, 0x00, 0x00, 0xd9, 0x32, 0x5e, 0xa7, 0x0a, 0x09, 0x08, 0x23, 0x00, 0x45,
+	0x0f, 0x05, 0x05, 0x01, 0x01, 0x82, 0x02, 0x09, 0x4a, 0x00, 0xb7, 0x03, 0x04, 0x04, 0x0b, 0xc8,
+	0x0f, 0x39, 0x82, 0x00, 0x0d, 0xca, 0x18, 0x76, 0x3e, 0x87, 0x08, 0x0c, 0x17, 0x31, 0x14, 0x05,
+	0x05, 0x01, 0x01, 0x82, 0x02, 0x08, 0x96, 0xa0, 0x03, 0x03, 0x04, 0x04, 0x0e, 0x04, 0x58, 0x83,
+	0x00, 0x0d, 0x4f, 0x3d, 0x56, 0x8a, 0x3b, 0x08, 0x0c, 0x16, 0x6f, 0x14, 0x05, 0x05, 0x01, 0x01,
+	0x82, 0x02, 0x81, 0x06, 0x82, 0x03, 0x03, 0x07, 0x0d, 0x28, 0xbe, 0x84, 0x00, 0x0c, 0xd8, 0x1e,
+	0x57, 0x88, 0x17, 0x0c, 0x85, 0x33, 0x1b, 0x1d, 0x05, 0x01, 0x01, 0x82, 0x02, 0x81, 0x06, 0x81,
+	0x03, 0x03, 0x07, 0x0d, 0x13, 0x94, 0x86, 0x00, 0x0b, 0xd6, 0x1e, 0x55, 0x73, 0x37, 0x36, 0x11,
+	0x30, 0x1a, 0x05, 0x01, 0x01, 0x82, 0x02, 0x81, 0x06, 0x04, 0x03, 0x07, 0x0b, 0x2c, 0x7d, 0x88,
+	0x00, 0x0a, 0xda, 0x12, 0x18, 0x61, 0x71, 0x31, 0x15, 0x1d, 0x05, 0x01, 0x01, 0x82, 0x02, 0x05,
+	0x06, 0x03, 0x04, 0x8e, 0x5a, 0x22, 0x8a, 0x00, 0x11, 0x50, 0xb5, 0x1c, 0x2a, 0x2b, 0x13, 0x15,
+	0x05, 0x01, 0x01, 0x02, 0x02, 0x06, 0x03, 0x20, 0x6c, 0x19, 0xc7, 0x8d, 0x00, 0x05, 0xd0, 0x9e,
+	0x7e, 0x01, 0x05, 0x05, 0x84, 0x01, 0x02, 0x05, 0x69, 0x41, 0x91, 0x00, 0x09, 0xd2, 0xc1, 0xa2,
+	0x91, 0x81, 0x80, 0x83, 0x97, 0x24, 0x4d, 0x89, 0x00,
+};
+
+// 24 x 30 pixels, 21 colours, 269 bytes (was 1444)
+extern const uint8_t IconOk[] =
+{
+	24, 30,		// width, height
+	21,			// number of palette entries
+	0xff, 0xff, 0x60, 0x05, 0x67, 0x05, 0x60, 0x3d, 0x9f, 0x97, 0x92, 0xff, 0x40, 0xb6, 0x6c, 0x05,
+	0xf2, 0x05, 0xff, 0xb7, 0xff, 0xdf, 0x56, 0x06, 0xbb, 0x3e, 0xe0, 0x95, 0xa7, 0xde, 0xfb, 0xff,
+	0x60, 0x65, 0x3f, 0x67, 0x2c, 0xff, 0xf6, 0xff, 0x00, 0x00,
+	0x90, 0x00, 0x01, 0x05, 0x12, 0x89, 0x00, 0x00, 0x14, 0x90, 0x00, 0x02, 0x03, 0x01, 0x0e, 0x9a,
+	0x00, 0x82, 0x01, 0x01, 0x06, 0x0f, 0x98, 0x00, 0x83, 0x01, 0x01, 0x0d, 0x13, 0x97, 0x00, 0x00,
+	0x02, 0x83, 0x01, 0x01, 0x10, 0x05, 0x96, 0x00, 0x01, 0x04, 0x07, 0x83, 0x01, 0x02, 0x03, 0x0e,
+	0x0f, 0x95, 0x00, 0x01, 0x09, 0x08, 0x84, 0x01, 0x01, 0x0d, 0x05, 0x95, 0x00, 0x02, 0x0a, 0x0c,
+	0x02, 0x83, 0x01, 0x00, 0x03, 0x97, 0x00, 0x00, 0x04, 0x84, 0x01, 0x95, 0x00, 0x02, 0x13, 0x12,
+	0x06, 0x84, 0x01, 0x93, 0x00, 0x02, 0x05, 0x0e, 0x10, 0x86, 0x01, 0x91, 0x00, 0x02, 0x05, 0x06,
+	0x03, 0x85, 0x01, 0x02, 0x07, 0x0b, 0x11, 0x8f, 0x00, 0x02, 0x12, 0x06, 0x03, 0x84, 0x01, 0x03,
+	0x02, 0x08, 0x11, 0x09, 0x8f, 0x00, 0x01, 0x05, 0x06, 0x85, 0x01, 0x03, 0x02, 0x0b, 0x04, 0x0a,
+	0x8f, 0x00, 0x02, 0x05, 0x06, 0x03, 0x84, 0x01, 0x02, 0x07, 0x0b, 0x04, 0x90, 0x00, 0x02, 0x0f,
+	0x0e, 0x03, 0x84, 0x01, 0x02, 0x02, 0x0c, 0x09, 0x91, 0x00, 0x01, 0x05, 0x0d, 0x84, 0x01, 0x02,
+	0x02, 0x0b, 0x04, 0x91, 0x00, 0x02, 0x0f, 0x06, 0x03, 0x84, 0x01, 0x01, 0x08, 0x04, 0x93, 0x00,
+	0x00, 0x0d, 0x84, 0x01, 0x02, 0x07, 0x11, 0x0a, 0x93, 0x00, 0x00, 0x13, 0x83, 0x01, 0x02, 0x02,
+	0x0c, 0x09, 0x95, 0x00, 0x00, 0x10, 0x82, 0x01, 0x01, 0x08, 0x04, 0x97, 0x00, 0x81, 0x01, 0x02,
+	0x02, 0x0c, 0x0a, 0x98, 0x00, 0x02, 0x07, 0x08, 0x04, 0x9a, 0x00, 0x01, 0x09, 0x0a, 0x98, 0x00,
+};
+
+// 44 x 30 pixels, 131 colours, 809 bytes (was 2644)
+extern const uint8_t IconFiles[] =
+{
+	44, 30,		// width, height
+	131,			// number of palette entries
+	0xe4, 0x20, 0x00, 0x00, 0xff, 0xff, 0xc3, 0x18, 0x04, 0x21, 0xf2, 0xff, 0xf6, 0xff, 0xa3, 0x10,
+	0xc3, 0x20, 0xf1, 0xff, 0xf3, 0xff, 0xf4, 0xff, 0x20, 0x08, 0x24, 0x29, 0xa3, 0x18, 0xa3, 0x20,
+	0xe3, 0x20, 0x45, 0x29, 0xa6, 0x39, 0xc7, 0x39, 0xef, 0xff, 0xf0, 0xff, 0xf7, 0xff, 0xfc, 0xff,
+	0x41, 0x08, 0x82, 0x10, 0xe3, 0x18, 0xf2, 0xee, 0xae, 0xff, 0xcf, 0xff, 0xdf, 0xff, 0xf5, 0xff,
+	0x00, 0x08, 0xa2, 0x18, 0xc4, 0x18, 0x45, 0x31, 0x65, 0x31, 0xa5, 0x39, 0xc7, 0x41, 0xe7, 0x41,
+	0x6a, 0x52, 0x8a, 0x52, 0xaa, 0x52, 0xeb, 0x62, 0x6d, 0x6b, 0xe7, 0x7a, 0xe6, 0x82, 0x51, 0x8c,
+	0x66, 0x93, 0x6e, 0x94, 0xef, 0x94, 0xc9, 0x9b, 0xe8, 0x9b, 0x2a, 0x9c, 0x4a, 0x9c, 0xad, 0x9c,
+	0x10, 0x9d, 0x84, 0xa3, 0xe9, 0xa3, 0x2a, 0xa4, 0x8b, 0xa4, 0xac, 0xa4, 0x28, 0xac, 0x34, 0xad,
+	0x07, 0xb4, 0x89, 0xb4, 0x96, 0xb5, 0x69, 0xbc, 0x0b, 0xbd, 0x0c, 0xbd, 0x4c, 0xbd, 0x6e, 0xbd,
+	0x68, 0xc4, 0xc8, 0xc4, 0x0c, 0xc5, 0x6c, 0xc5, 0x18, 0xc6, 0x54, 0xc6, 0xe8, 0xcc, 0xe9, 0xcc,
+	0x0b, 0xcd, 0x2a, 0xcd, 0x8c, 0xcd, 0xad, 0xcd, 0xcc, 0xcd, 0xcd, 0xcd, 0x28, 0xd5, 0x29, 0xd5,
+	0x27, 0xdd, 0xab, 0xdd, 0x50, 0xde, 0x90, 0xde, 0xd2, 0xde, 0xdb, 0xde, 0xf3, 0xde, 0x05, 0xe5,
+	0x49, 0xe5, 0x68, 0xe5, 0x87, 0xe5, 0xaa, 0xe5, 0xc7, 0xe5, 0x2b, 0xe6, 0x4c, 0xe6, 0x4d, 0xe6,
+	0xb0, 0xe6, 0x3c, 0xe7, 0xcb, 0xed, 0x8f, 0xee, 0x90, 0xee, 0xaf, 0xee, 0xb0, 0xee, 0xb2, 0xee,
+	0x33, 0xef, 0x4c, 0xf6, 0x4e, 0xf6, 0xd0, 0xf6, 0xd1, 0xf6, 0xf1, 0xf6, 0x9e, 0xf7, 0x6c, 0xfe,
+	0x6e, 0xfe, 0xad, 0xff, 0xcb, 0xff, 0xce, 0xff, 0xec, 0xff, 0xed, 0xff, 0xee, 0xff, 0xf8, 0xff,
+	0xf9, 0xff, 0xfb, 0xff, 0xfd, 0xff,
+	0x01, 0x76, 0x2a, 0x99, 0x01, 0x04, 0x29, 0x69, 0x13, 0x01, 0x0d, 0x97, 0x00, 0x04, 0x04, 0x0c,
+	0x11, 0x21, 0x04, 0x99, 0x00, 0x02, 0x04, 0x03, 0x01, 0x9b, 0x00, 0x81, 0x01, 0x9b, 0x00, 0x81,
+	0x01, 0x9b, 0x00, 0x81, 0x01, 0x9b, 0x00, 0x81, 0x01, 0x9b, 0x00, 0x81, 0x01, 0x9b, 0x00, 0x81,
+	0x01, 0x9b, 0x00, 0x81, 0x01, 0x9b, 0x00, 0x81, 0x01, 0x9b, 0x00, 0x81, 0x01, 0x9b, 0x00, 0x81,
+	0x01, 0x00, 0x0d, 0x9a, 0x00, 0x03, 0x01, 0x26, 0x01, 0x04, 0x99, 0x00, 0x04, 0x01, 0x1e, 0x11,
+	0x0c, 0x04, 0x98, 0x00, 0x04, 0x01, 0x02, 0x1e, 0x13, 0x19, 0x98, 0x00, 0x00, 0x01, 0x82, 0x02,
+	0x00, 0x01, 0x98, 0x00, 0x00, 0x01, 0x82, 0x02, 0x00, 0x20, 0x98, 0x00, 0x00, 0x01, 0x82, 0x02,
+	0x00, 0x01, 0x98, 0x00, 0x04, 0x01, 0x02, 0x02, 0x2f, 0x0c, 0x98, 0x00, 0x04, 0x01, 0x2c, 0x2b,
+	0x11, 0x10, 0x98, 0x00, 0x04, 0x01, 0x18, 0x18, 0x03, 0x04, 0x98, 0x00, 0x81, 0x01, 0x00, 0x04,
+	0x9a, 0x00, 0x03, 0x01, 0x0c, 0x10, 0x04, 0x99, 0x00, 0x04, 0x01, 0x42, 0x01, 0x0e, 0x04, 0x98,
+	0x00, 0x05, 0x01, 0x02, 0x3f, 0x01, 0x0e, 0x04, 0x97, 0x00, 0x06, 0x01, 0x02, 0x02, 0x4c, 0x01,
+	0x0e, 0x04, 0x96, 0x00, 0x00, 0x01, 0x82, 0x02, 0x02, 0x01, 0x19, 0x03, 0x96, 0x00, 0x00, 0x01,
+	0x82, 0x02, 0x81, 0x01, 0x00, 0x03, 0x96, 0x00, 0x00, 0x01, 0x82, 0x02, 0x81, 0x01, 0x00, 0x04,
+	0x96, 0x00, 0x00, 0x01, 0x82, 0x02, 0x1a, 0x22, 0x00, 0x00, 0x10, 0x07, 0x03, 0x00, 0x03, 0x07,
+	0x00, 0x03, 0x07, 0x00, 0x00, 0x07, 0x03, 0x00, 0x03, 0x07, 0x00, 0x1a, 0x07, 0x00, 0x00, 0x07,
+	0x00, 0x01, 0x82, 0x02, 0x83, 0x00, 0x16, 0x08, 0x03, 0x00, 0x03, 0x0f, 0x00, 0x1a, 0x08, 0x00,
+	0x00, 0x0f, 0x08, 0x00, 0x03, 0x08, 0x00, 0x03, 0x0f, 0x00, 0x00, 0x08, 0x00, 0x01, 0x82, 0x02,
+	0x81, 0x00, 0x18, 0x30, 0x62, 0x00, 0x60, 0x40, 0x00, 0x43, 0x63, 0x00, 0x2d, 0x65, 0x00, 0x66,
+	0x41, 0x0d, 0x48, 0x61, 0x00, 0x2e, 0x64, 0x00, 0x5f, 0x39, 0x00, 0x01, 0x82, 0x02, 0x81, 0x00,
+	0x18, 0x50, 0x7e, 0x00, 0x1c, 0x6a, 0x00, 0x78, 0x15, 0x00, 0x3a, 0x09, 0x00, 0x05, 0x59, 0x23,
+	0x77, 0x7d, 0x00, 0x3e, 0x7c, 0x00, 0x7a, 0x58, 0x00, 0x01, 0x82, 0x02, 0x81, 0x00, 0x18, 0x4a,
+	0x09, 0x00, 0x09, 0x67, 0x00, 0x6c, 0x09, 0x00, 0x35, 0x05, 0x00, 0x05, 0x51, 0x24, 0x72, 0x14,
+	0x00, 0x34, 0x79, 0x00, 0x1c, 0x56, 0x00, 0x01, 0x82, 0x02, 0x81, 0x00, 0x18, 0x44, 0x05, 0x00,
+	0x0a, 0x68, 0x00, 0x6d, 0x0a, 0x00, 0x36, 0x0b, 0x00, 0x05, 0x55, 0x25, 0x6b, 0x1d, 0x00, 0x33,
+	0x7b, 0x00, 0x1d, 0x57, 0x00, 0x01, 0x82, 0x02, 0x81, 0x00, 0x18, 0x45, 0x0a, 0x00, 0x0b, 0x5b,
+	0x00, 0x6e, 0x06, 0x00, 0x37, 0x06, 0x00, 0x0b, 0x54, 0x12, 0x73, 0x09, 0x00, 0x3b, 0x15, 0x00,
+	0x14, 0x4f, 0x00, 0x01, 0x82, 0x02, 0x81, 0x00, 0x18, 0x46, 0x0b, 0x00, 0x06, 0x5c, 0x00, 0x1b,
+	0x1f, 0x00, 0x38, 0x16, 0x00, 0x0b, 0x52, 0x12, 0x75, 0x05, 0x00, 0x3c, 0x05, 0x00, 0x14, 0x49,
+	0x00, 0x01, 0x82, 0x02, 0x81, 0x00, 0x18, 0x4b, 0x06, 0x00, 0x16, 0x5e, 0x00, 0x70, 0x06, 0x00,
+	0x32, 0x80, 0x00, 0x1f, 0x53, 0x13, 0x74, 0x05, 0x00, 0x3d, 0x05, 0x00, 0x15, 0x4e, 0x00, 0x01,
+	0x82, 0x02, 0x81, 0x00, 0x18, 0x5a, 0x17, 0x00, 0x17, 0x06, 0x00, 0x16, 0x17, 0x00, 0x31, 0x81,
+	0x00, 0x82, 0x1b, 0x12, 0x6f, 0x0a, 0x00, 0x47, 0x06, 0x00, 0x0a, 0x71, 0x00, 0x01, 0x82, 0x02,
+	0x8a, 0x00, 0x01, 0x4d, 0x02, 0x83, 0x00, 0x01, 0x06, 0x7f, 0x86, 0x00, 0x00, 0x01, 0x82, 0x02,
+	0x81, 0x01, 0x96, 0x00, 0x01, 0x01, 0x0d, 0x82, 0x02, 0x00, 0x28, 0x97, 0x01, 0x01, 0x27, 0x5d,
+};
+
+// 61 x 29 pixels, 2 colours, 495 bytes (was 3542)
+extern const uint8_t IconKeyboard[] =
+{
+	61, 29,		// width, height
+	2,			// number of palette entries
+	0xff, 0xff, 0x00, 0x00,
+	0x84, 0x01, 0x97, 0x00, 0x84, 0x01, 0x97, 0x00, 0x84, 0x01, 0x97, 0x00, 0x84, 0x01, 0x82, 0x00,
+	0x84, 0x01, 0x8f, 0x00, 0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x97, 0x00, 0x84, 0x01, 0x97, 0x00,
+	0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x8f, 0x00, 0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x87, 0x00,
+	0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x87, 0x00,
+	0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x8f, 0x00,
+	0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x97, 0x00, 0x84, 0x01, 0x97, 0x00, 0x84, 0x01, 0x82, 0x00,
+	0x84, 0x01, 0x8f, 0x00, 0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x8a, 0x00,
+	0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x8a, 0x00,
+	0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x82, 0x00, 0x84, 0x01, 0x8a, 0x00, 0x89, 0x01, 0x82, 0x00,
+	0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x87, 0x00,
+	0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x82, 0x00,
+	0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x8a, 0x00,
+	0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x82, 0x00,
+	0x84, 0x01, 0x8a, 0x00, 0x89, 0x01, 0x82, 0x00, 0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x87, 0x00,
+	0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x82, 0x00,
+	0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x8a, 0x00,
+	0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x8a, 0x00,
+	0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x82, 0x00, 0x84, 0x01, 0x8a, 0x00, 0x89, 0x01, 0x82, 0x00,
+	0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x87, 0x00,
+	0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x82, 0x00,
+	0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x8a, 0x00,
+	0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x82, 0x00,
+	0x84, 0x01, 0x8a, 0x00, 0x89, 0x01, 0x82, 0x00, 0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x87, 0x00,
+	0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x82, 0x00,
+	0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x82, 0x00, 0x89, 0x01, 0x8a, 0x00,
+	0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x8a, 0x00,
+	0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x8f, 0x00, 0x84, 0x01, 0x82, 0x00,
+	0x84, 0x01, 0x97, 0x00, 0x84, 0x01, 0x97, 0x00, 0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x8f, 0x00,
+	0x84, 0x01, 0x82, 0x00, 0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x87, 0x00,
+	0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x87, 0x00, 0x84, 0x01, 0x8a, 0x00, 0x84, 0x01, 0x87, 0x00,
+	0x84, 0x01, 0x97, 0x00, 0x84, 0x01, 0x97, 0x00,
+};
+
+// 25 x 30 pixels, 110 colours, 738 bytes (was 1504)
+extern const uint8_t IconTrash[] =
+{
+	25, 30,		// width, height
+	110,			// number of palette entries
+	0xff, 0xff, 0xba, 0xd6, 0x79, 0xce, 0x7a, 0xce, 0x38, 0xc6, 0xdf, 0xff, 0x7d, 0xef, 0x28, 0x42,
+	0x9a, 0xce, 0xfc, 0xde, 0xdb, 0xde, 0x1c, 0xe7, 0x59, 0xce, 0xd3, 0x9c, 0x96, 0xb5, 0x9a, 0xd6,
+	0x5d, 0xef, 0x24, 0x21, 0xcf, 0x7b, 0xf4, 0x9c, 0x9e, 0xf7, 0x31, 0x84, 0x92, 0x94, 0xb3, 0x94,
+	0x3c, 0xe7, 0x49, 0x4a, 0x8e, 0x73, 0x55, 0xad, 0xfb, 0xde, 0x51, 0x8c, 0xbb, 0xd6, 0xbe, 0xf7,
+	0x69, 0x4a, 0x6e, 0x6b, 0x14, 0xa5, 0x35, 0xa5, 0x18, 0xc6, 0x39, 0xc6, 0x82, 0x10, 0xe3, 0x18,
+	0xb7, 0xb5, 0xba, 0xde, 0x3d, 0xe7, 0xa6, 0x31, 0x8a, 0x52, 0xae, 0x73, 0xf3, 0x9c, 0x34, 0xa5,
+	0x75, 0xad, 0xd7, 0xbd, 0xbf, 0xf7, 0x61, 0x08, 0xa2, 0x10, 0x04, 0x21, 0xa7, 0x31, 0xc7, 0x39,
+	0x29, 0x42, 0x6a, 0x4a, 0xcb, 0x5a, 0x4d, 0x6b, 0x10, 0x84, 0x52, 0x8c, 0x72, 0x8c, 0xd3, 0x94,
+	0xda, 0xde, 0x7e, 0xef, 0xc3, 0x18, 0xe7, 0x39, 0x08, 0x42, 0xab, 0x52, 0xec, 0x5a, 0x0c, 0x63,
+	0x6d, 0x6b, 0xaf, 0x73, 0xef, 0x7b, 0xf0, 0x7b, 0x30, 0x84, 0x76, 0xad, 0xf7, 0xbd, 0x59, 0xc6,
+	0x20, 0x00, 0x41, 0x08, 0xc2, 0x18, 0xe4, 0x18, 0x25, 0x21, 0x25, 0x29, 0x45, 0x29, 0x65, 0x29,
+	0xe8, 0x39, 0x08, 0x3a, 0x6a, 0x52, 0xaa, 0x52, 0xcc, 0x5a, 0x0c, 0x5b, 0x0d, 0x63, 0x2d, 0x63,
+	0x10, 0x7c, 0x11, 0x84, 0x51, 0x84, 0x31, 0x8c, 0x71, 0x8c, 0x93, 0x94, 0xb2, 0x94, 0xf4, 0xa4,
+	0x76, 0xb5, 0xf8, 0xbd, 0x5d, 0xe7, 0x5e, 0xef, 0x9e, 0xef, 0xde, 0xff,
+	0x05, 0x00, 0x03, 0x3a, 0x5d, 0x46, 0x1c, 0x98, 0x00, 0x05, 0x02, 0x1a, 0x4b, 0x1d, 0x24, 0x0a,
+	0x93, 0x01, 0x00, 0x10, 0x82, 0x00, 0x13, 0x0a, 0x16, 0x1b, 0x24, 0x3e, 0x5c, 0x3b, 0x3c, 0x1d,
+	0x15, 0x4c, 0x3c, 0x60, 0x4a, 0x12, 0x12, 0x49, 0x2d, 0x1a, 0x1a, 0x84, 0x21, 0x0c, 0x47, 0x3a,
+	0x2e, 0x00, 0x00, 0x1c, 0x30, 0x02, 0x18, 0x24, 0x65, 0x13, 0x30, 0x83, 0x0e, 0x04, 0x68, 0x4d,
+	0x30, 0x1b, 0x1b, 0x82, 0x23, 0x81, 0x2f, 0x81, 0x22, 0x0d, 0x13, 0x15, 0x4c, 0x49, 0x0e, 0x00,
+	0x0b, 0x31, 0x0a, 0x06, 0x0b, 0x0f, 0x0c, 0x22, 0x83, 0x0d, 0x82, 0x3f, 0x82, 0x0d, 0x84, 0x17,
+	0x81, 0x16, 0x0a, 0x0e, 0x04, 0x1b, 0x1d, 0x00, 0x06, 0x24, 0x1c, 0x14, 0x6d, 0x1f, 0x8a, 0x00,
+	0x83, 0x05, 0x00, 0x32, 0x82, 0x1f, 0x0a, 0x00, 0x10, 0x02, 0x2f, 0x00, 0x02, 0x0c, 0x18, 0x14,
+	0x05, 0x05, 0x93, 0x00, 0x0d, 0x14, 0x01, 0x0e, 0x30, 0x2f, 0x1e, 0x0b, 0x10, 0x1f, 0x05, 0x00,
+	0x05, 0x09, 0x1c, 0x84, 0x0b, 0x83, 0x18, 0x81, 0x2a, 0x12, 0x6a, 0x10, 0x10, 0x2a, 0x00, 0x14,
+	0x0f, 0x0e, 0x57, 0x28, 0x1e, 0x09, 0x0b, 0x10, 0x32, 0x18, 0x2e, 0x4b, 0x61, 0x85, 0x15, 0x00,
+	0x62, 0x83, 0x1d, 0x82, 0x3d, 0x0f, 0x15, 0x13, 0x0a, 0x0f, 0x1b, 0x19, 0x28, 0x03, 0x1e, 0x1e,
+	0x09, 0x2a, 0x0f, 0x4e, 0x0f, 0x03, 0x8e, 0x02, 0x0e, 0x4e, 0x25, 0x24, 0x13, 0x20, 0x28, 0x0c,
+	0x03, 0x03, 0x01, 0x03, 0x0f, 0x18, 0x6c, 0x41, 0x8e, 0x06, 0x09, 0x18, 0x0c, 0x0e, 0x17, 0x2c,
+	0x28, 0x0c, 0x03, 0x03, 0x0f, 0x82, 0x03, 0x8f, 0x08, 0x81, 0x03, 0x0b, 0x25, 0x4d, 0x66, 0x2c,
+	0x69, 0x08, 0x1e, 0x01, 0x0a, 0x1e, 0x1e, 0x0a, 0x8c, 0x09, 0x83, 0x1c, 0x0b, 0x0a, 0x03, 0x28,
+	0x0d, 0x45, 0x0c, 0x09, 0x0b, 0x09, 0x2a, 0x10, 0x41, 0x92, 0x00, 0x10, 0x0b, 0x25, 0x23, 0x3a,
+	0x0f, 0x10, 0x41, 0x6b, 0x14, 0x05, 0x1f, 0x2e, 0x47, 0x3b, 0x48, 0x48, 0x21, 0x82, 0x1a, 0x82,
+	0x2d, 0x84, 0x12, 0x0e, 0x1a, 0x13, 0x10, 0x0f, 0x0e, 0x5b, 0x02, 0x10, 0x32, 0x32, 0x05, 0x05,
+	0x02, 0x2b, 0x43, 0x8e, 0x07, 0x08, 0x43, 0x2b, 0x24, 0x01, 0x0e, 0x37, 0x04, 0x0b, 0x14, 0x82,
+	0x05, 0x02, 0x14, 0x01, 0x01, 0x84, 0x29, 0x82, 0x40, 0x86, 0x0a, 0x81, 0x01, 0x0b, 0x10, 0x01,
+	0x0e, 0x1b, 0x0e, 0x0a, 0x06, 0x1f, 0x14, 0x10, 0x14, 0x00, 0x85, 0x05, 0x8b, 0x00, 0x0d, 0x10,
+	0x0c, 0x1b, 0x00, 0x0c, 0x0c, 0x0b, 0x14, 0x0a, 0x31, 0x25, 0x4f, 0x02, 0x0c, 0x82, 0x02, 0x87,
+	0x03, 0x00, 0x08, 0x82, 0x0f, 0x0c, 0x0c, 0x31, 0x23, 0x64, 0x00, 0x06, 0x1b, 0x25, 0x0b, 0x31,
+	0x63, 0x67, 0x22, 0x83, 0x13, 0x00, 0x2e, 0x83, 0x0d, 0x82, 0x17, 0x82, 0x16, 0x14, 0x3e, 0x16,
+	0x22, 0x16, 0x4a, 0x3b, 0x00, 0x0a, 0x3e, 0x23, 0x04, 0x0d, 0x5e, 0x5a, 0x55, 0x11, 0x54, 0x11,
+	0x11, 0x35, 0x35, 0x82, 0x27, 0x02, 0x42, 0x34, 0x34, 0x82, 0x26, 0x18, 0x33, 0x50, 0x56, 0x5f,
+	0x45, 0x20, 0x00, 0x0f, 0x1a, 0x3c, 0x13, 0x12, 0x38, 0x2b, 0x33, 0x51, 0x33, 0x26, 0x26, 0x34,
+	0x52, 0x42, 0x27, 0x27, 0x35, 0x86, 0x11, 0x0d, 0x37, 0x07, 0x36, 0x16, 0x00, 0x02, 0x2c, 0x46,
+	0x12, 0x39, 0x53, 0x44, 0x2c, 0x07, 0x84, 0x19, 0x81, 0x20, 0x81, 0x39, 0x81, 0x20, 0x0e, 0x19,
+	0x38, 0x07, 0x44, 0x38, 0x58, 0x11, 0x12, 0x00, 0x00, 0x04, 0x37, 0x59, 0x19, 0x22, 0x82, 0x04,
+	0x81, 0x0c, 0x01, 0x4f, 0x25, 0x8d, 0x04, 0x00, 0x0b, 0x82, 0x00, 0x04, 0x0c, 0x2b, 0x36, 0x36,
+	0x01, 0x97, 0x00,
+};
+
+#else
+
+// 18 x 21 pixels, 20 colours, 206 bytes (was 760)
+extern const uint8_t IconOk[] =
+{
+	18, 21,		// width, height
+	20,			// number of palette entries
+	0xff, 0xff, 0x60, 0x05, 0x56, 0x06, 0xe0, 0x95, 0x67, 0x05, 0xfb, 0xff, 0x60, 0x3d, 0x3f, 0x67,
+	0x9f, 0x97, 0x40, 0xb6, 0x92, 0xff, 0x6c, 0x05, 0x60, 0x65, 0xff, 0xb7, 0xa7, 0xde, 0xf6, 0xff,
+	0xf2, 0x05, 0xff, 0xdf, 0x2c, 0xff, 0x9b, 0x97,
+	0x8b, 0x00, 0x02, 0x0e, 0x09, 0x05, 0x91, 0x00, 0x81, 0x01, 0x01, 0x03, 0x05, 0x90, 0x00, 0x82,
+	0x01, 0x01, 0x03, 0x0f, 0x8f, 0x00, 0x00, 0x02, 0x82, 0x01, 0x01, 0x0c, 0x12, 0x8f, 0x00, 0x00,
+	0x02, 0x83, 0x01, 0x01, 0x09, 0x0f, 0x8e, 0x00, 0x01, 0x07, 0x04, 0x82, 0x01, 0x00, 0x0c, 0x8f,
+	0x00, 0x00, 0x13, 0x83, 0x01, 0x8d, 0x00, 0x02, 0x0a, 0x0e, 0x03, 0x83, 0x01, 0x8a, 0x00, 0x03,
+	0x05, 0x0a, 0x09, 0x06, 0x83, 0x01, 0x01, 0x0b, 0x02, 0x88, 0x00, 0x03, 0x05, 0x12, 0x03, 0x06,
+	0x82, 0x01, 0x03, 0x04, 0x10, 0x07, 0x0d, 0x88, 0x00, 0x01, 0x0a, 0x03, 0x83, 0x01, 0x03, 0x04,
+	0x02, 0x08, 0x11, 0x88, 0x00, 0x02, 0x0f, 0x09, 0x06, 0x82, 0x01, 0x02, 0x04, 0x02, 0x08, 0x89,
+	0x00, 0x02, 0x05, 0x0e, 0x0c, 0x82, 0x01, 0x02, 0x04, 0x02, 0x08, 0x8a, 0x00, 0x01, 0x0a, 0x03,
+	0x83, 0x01, 0x01, 0x10, 0x08, 0x8c, 0x00, 0x00, 0x06, 0x82, 0x01, 0x02, 0x0b, 0x07, 0x11, 0x8d,
+	0x00, 0x82, 0x01, 0x01, 0x02, 0x0d, 0x8f, 0x00, 0x02, 0x01, 0x0b, 0x07, 0x91, 0x00, 0x01, 0x02,
+	0x0d, 0x90, 0x00,
+};
+
+// 21 x 21 pixels, 164 colours, 737 bytes (was 886)
+extern const uint8_t IconCancel[] =
+{
+	21, 21,		// width, height
+	164,			// number of palette entries
+	0xff, 0xff, 0xe1, 0xc8, 0xc1, 0xa8, 0xc1, 0xb0, 0xc1, 0xa0, 0xe1, 0xb8, 0xe1, 0xc0, 0x8d, 0xbb,
+	0x01, 0xd9, 0x01, 0xd1, 0x0b, 0xb3, 0x60, 0x98, 0x84, 0xa1, 0x0f, 0xbc, 0x01, 0xe9, 0x1c, 0xf7,
+	0x7d, 0xff, 0x80, 0x98, 0x4c, 0xa3, 0x68, 0xb2, 0xa9, 0xb2, 0xce, 0xbb, 0xe1, 0xd0, 0xd2, 0xd4,
+	0x01, 0xe1, 0xfb, 0xf6, 0x5d, 0xf7, 0x9e, 0xff, 0xbe, 0xff, 0xc1, 0x90, 0xa1, 0xa0, 0x43, 0xa1,
+	0xca, 0xa2, 0xae, 0xa3, 0x22, 0xa9, 0xe6, 0xa9, 0x0b, 0xab, 0x00, 0xb0, 0xc5, 0xb1, 0xca, 0xb2,
+	0x2b, 0xb3, 0x43, 0xb9, 0x4c, 0xbb, 0xef, 0xbb, 0x91, 0xbc, 0x84, 0xc1, 0xa5, 0xc1, 0x47, 0xca,
+	0xd2, 0xcc, 0x54, 0xcd, 0x75, 0xcd, 0x0b, 0xdb, 0x79, 0xee, 0x1b, 0xf7, 0x3c, 0xf7, 0xdf, 0xff,
+	0x00, 0x88, 0x81, 0x88, 0xc1, 0x88, 0x03, 0x89, 0x44, 0x89, 0x00, 0x90, 0x60, 0x90, 0x80, 0x90,
+	0xa1, 0x90, 0x22, 0x91, 0x43, 0x91, 0x85, 0x91, 0x40, 0x98, 0xa0, 0x98, 0xa1, 0x98, 0xc1, 0x98,
+	0xc2, 0x98, 0x02, 0x99, 0xc5, 0x99, 0x00, 0xa0, 0x02, 0xa1, 0x23, 0xa1, 0x64, 0xa1, 0x8d, 0xa3,
+	0x20, 0xa8, 0x40, 0xa8, 0xa1, 0xa8, 0x23, 0xa9, 0x43, 0xa9, 0x06, 0xaa, 0x27, 0xaa, 0x0a, 0xab,
+	0x6d, 0xab, 0x80, 0xb0, 0x22, 0xb1, 0x43, 0xb1, 0x84, 0xb1, 0x06, 0xb2, 0x89, 0xb2, 0xea, 0xb2,
+	0x0a, 0xb3, 0x4c, 0xb3, 0x6c, 0xb3, 0x8d, 0xb3, 0x60, 0xb8, 0xc0, 0xb8, 0xe2, 0xb8, 0x22, 0xb9,
+	0x06, 0xba, 0x27, 0xba, 0xea, 0xba, 0x0b, 0xbb, 0x2b, 0xbb, 0x6c, 0xbb, 0x70, 0xbc, 0x71, 0xbc,
+	0xb2, 0xbc, 0xd2, 0xbc, 0x13, 0xbd, 0x14, 0xbd, 0xa0, 0xc0, 0xc2, 0xc0, 0x03, 0xc1, 0x43, 0xc1,
+	0x4c, 0xc3, 0xef, 0xc3, 0x0f, 0xc4, 0x01, 0xc9, 0x23, 0xc9, 0x06, 0xca, 0x88, 0xca, 0xc9, 0xca,
+	0xea, 0xca, 0x4b, 0xcb, 0x50, 0xcc, 0x34, 0xcd, 0x13, 0xd5, 0x54, 0xd5, 0xad, 0xdb, 0xcd, 0xdb,
+	0xee, 0xdb, 0x0f, 0xdc, 0x17, 0xde, 0x58, 0xde, 0x50, 0xe4, 0x91, 0xe4, 0xf2, 0xe4, 0x59, 0xe6,
+	0x9a, 0xe6, 0xdb, 0xe6, 0x50, 0xec, 0x91, 0xec, 0xb1, 0xec, 0x58, 0xee, 0x9a, 0xee, 0xba, 0xee,
+	0xfb, 0xee, 0xf2, 0xf4, 0x13, 0xf5, 0xba, 0xf6, 0xdb, 0xf6, 0x5c, 0xf7, 0x7d, 0xf7, 0x9e, 0xf7,
+	0x3c, 0xff, 0x5c, 0xff, 0x5d, 0xff, 0x9d, 0xff,
+	0x85, 0x00, 0x08, 0x1b, 0x8e, 0x81, 0x69, 0x53, 0x5d, 0x78, 0x17, 0x1a, 0x8a, 0x00, 0x05, 0x94,
+	0x50, 0x0b, 0x04, 0x04, 0x02, 0x82, 0x03, 0x02, 0x04, 0x07, 0x1c, 0x86, 0x00, 0x0e, 0x1c, 0x76,
+	0x38, 0x3a, 0x1d, 0x46, 0x04, 0x02, 0x02, 0x03, 0x06, 0x01, 0x65, 0x49, 0x90, 0x84, 0x00, 0x10,
+	0x10, 0x25, 0x39, 0x57, 0x60, 0x1f, 0x0b, 0x04, 0x02, 0x02, 0x03, 0x05, 0x05, 0x09, 0x16, 0x3f,
+	0x8b, 0x82, 0x00, 0x70, 0x37, 0x7c, 0x3c, 0x6e, 0x07, 0x5f, 0x0c, 0x0b, 0x04, 0x02, 0x02, 0x03,
+	0x05, 0x05, 0x06, 0x09, 0x08, 0x42, 0x9f, 0x00, 0x00, 0x93, 0x48, 0x71, 0x15, 0x0a, 0x17, 0x6c,
+	0x11, 0x1e, 0x02, 0x02, 0x03, 0x2f, 0x86, 0x06, 0x06, 0x08, 0x01, 0x58, 0x00, 0x10, 0x59, 0x21,
+	0x30, 0x6d, 0x84, 0x00, 0x0f, 0x4c, 0x04, 0x02, 0x03, 0x67, 0x19, 0x00, 0x87, 0x01, 0x01, 0x0e,
+	0x04, 0x98, 0x9a, 0x0c, 0x73, 0x7a, 0x07, 0x79, 0x1c, 0x00, 0x19, 0x22, 0x02, 0x5a, 0x9c, 0x00,
+	0x1b, 0x2f, 0x01, 0x01, 0x18, 0x01, 0x2c, 0x33, 0x20, 0x32, 0x0d, 0x07, 0x0a, 0x6b, 0x1a, 0x00,
+	0x34, 0x5c, 0x95, 0x00, 0xa0, 0x2d, 0x06, 0x01, 0x01, 0x08, 0x08, 0x24, 0x2e, 0x12, 0x31, 0x0d,
+	0x07, 0x28, 0x5e, 0x14, 0x0f, 0x82, 0x00, 0x11, 0x35, 0x2d, 0x05, 0x06, 0x01, 0x01, 0x09, 0x18,
+	0x55, 0x66, 0x4f, 0x83, 0x0d, 0x07, 0x0a, 0x14, 0x56, 0x13, 0x82, 0x00, 0x11, 0x7f, 0x05, 0x05,
+	0x06, 0x01, 0x01, 0x09, 0x0e, 0x0c, 0x2e, 0x12, 0x31, 0x2b, 0x07, 0x0a, 0x14, 0x13, 0x97, 0x82,
+	0x00, 0x70, 0x9b, 0x29, 0x05, 0x06, 0x01, 0x01, 0x09, 0x0e, 0x23, 0x33, 0x20, 0x32, 0x2b, 0x07,
+	0x0a, 0x27, 0x36, 0x00, 0x96, 0x68, 0x34, 0x00, 0x19, 0x77, 0x06, 0x01, 0x01, 0x08, 0x08, 0x24,
+	0x99, 0x4e, 0x72, 0x0d, 0x07, 0x15, 0x9e, 0x00, 0x0f, 0x54, 0x02, 0x5b, 0x35, 0x00, 0xa1, 0x7d,
+	0x01, 0x01, 0x18, 0x01, 0x2c, 0x10, 0x51, 0x21, 0x30, 0x62, 0x85, 0x00, 0x9d, 0x1f, 0x04, 0x02,
+	0x03, 0x29, 0x36, 0x00, 0x88, 0x01, 0x01, 0x0e, 0x04, 0x91, 0x00, 0x92, 0x40, 0x70, 0x15, 0x28,
+	0x17, 0x13, 0x11, 0x04, 0x02, 0x02, 0x03, 0x7e, 0x89, 0x06, 0x06, 0x08, 0x16, 0x12, 0x00, 0x00,
+	0x37, 0x75, 0x43, 0x6f, 0x2a, 0x27, 0x4d, 0x0b, 0x04, 0x02, 0x02, 0x03, 0x05, 0x05, 0x06, 0x09,
+	0x08, 0x41, 0x1a, 0x82, 0x00, 0x10, 0xa2, 0x25, 0x3b, 0x63, 0x2a, 0x23, 0x11, 0x1e, 0x02, 0x02,
+	0x03, 0x05, 0x05, 0x7b, 0x16, 0x3e, 0x8a, 0x84, 0x00, 0x0e, 0xa3, 0x64, 0x3d, 0x4a, 0x0c, 0x45,
+	0x04, 0x02, 0x02, 0x03, 0x05, 0x01, 0x74, 0x1d, 0x8f, 0x87, 0x00, 0x05, 0x8c, 0x4b, 0x44, 0x47,
+	0x04, 0x02, 0x82, 0x03, 0x02, 0x52, 0x61, 0x1b, 0x89, 0x00, 0x08, 0x10, 0x8d, 0x80, 0x26, 0x22,
+	0x26, 0x6a, 0x82, 0x0f, 0x85, 0x00,
+};
+
+// 29 x 21 pixels, 61 colours, 619 bytes (was 1222)
+extern const uint8_t IconFiles[] =
+{
+	29, 21,		// width, height
+	61,			// number of palette entries
+	0xe4, 0x20, 0x04, 0x21, 0x00, 0x00, 0xff, 0xff, 0x20, 0x08, 0x86, 0x31, 0xe7, 0x41, 0x96, 0xb5,
+	0xdf, 0xff, 0x21, 0x08, 0x61, 0x10, 0x82, 0x10, 0xa2, 0x18, 0x24, 0x21, 0x24, 0x29, 0x45, 0x29,
+	0x8b, 0x52, 0xaa, 0x5a, 0x72, 0x8c, 0xf3, 0x9c, 0x8e, 0xcd, 0xef, 0xcd, 0x6c, 0xd5, 0x8d, 0xd5,
+	0x2f, 0xde, 0x4e, 0xde, 0x8a, 0xe5, 0x4d, 0xe6, 0xd3, 0xe6, 0x13, 0xe7, 0x88, 0xed, 0xab, 0xed,
+	0xb0, 0xee, 0xd0, 0xee, 0xa9, 0xf5, 0xeb, 0xf5, 0x4d, 0xf6, 0x8e, 0xf6, 0xae, 0xf6, 0x95, 0xf7,
+	0xbe, 0xf7, 0xca, 0xfd, 0x28, 0xfe, 0x8d, 0xfe, 0xcd, 0xfe, 0xce, 0xfe, 0xcf, 0xfe, 0xed, 0xfe,
+	0x0c, 0xff, 0x0f, 0xff, 0x31, 0xff, 0x50, 0xff, 0x52, 0xff, 0x70, 0xff, 0x72, 0xff, 0x93, 0xff,
+	0xb3, 0xff, 0xf0, 0xff, 0xf5, 0xff, 0xf7, 0xff, 0xf8, 0xff,
+	0x00, 0x07, 0x92, 0x02, 0x00, 0x13, 0x95, 0x02, 0x02, 0x01, 0x00, 0x00, 0x89, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x0e, 0x00, 0x01, 0x02, 0x02, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x82, 0x01, 0x81, 0x00, 0x09, 0x01, 0x00, 0x01, 0x02, 0x02, 0x00, 0x00, 0x01, 0x00,
+	0x01, 0x83, 0x00, 0x0b, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02,
+	0x85, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00, 0x05, 0x01, 0x02, 0x02,
+	0x00, 0x00, 0x01, 0x82, 0x00, 0x05, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x83, 0x00, 0x09, 0x01,
+	0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x01, 0x00, 0x01, 0x85, 0x00, 0x02, 0x01, 0x00, 0x00, 0x82,
+	0x01, 0x0a, 0x00, 0x01, 0x02, 0x02, 0x0d, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x83, 0x00, 0x02,
+	0x01, 0x00, 0x01, 0x83, 0x00, 0x1b, 0x01, 0x02, 0x0f, 0x09, 0x0e, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x28, 0x06, 0x0b,
+	0x00, 0x00, 0x87, 0x01, 0x83, 0x00, 0x1e, 0x01, 0x00, 0x01, 0x02, 0x03, 0x03, 0x02, 0x00, 0x00,
+	0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02,
+	0x03, 0x03, 0x02, 0x00, 0x00, 0x01, 0x83, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x82, 0x01, 0x06,
+	0x00, 0x01, 0x01, 0x02, 0x08, 0x07, 0x04, 0x83, 0x00, 0x00, 0x01, 0x85, 0x00, 0x0c, 0x01, 0x00,
+	0x01, 0x00, 0x00, 0x01, 0x02, 0x05, 0x02, 0x00, 0x01, 0x00, 0x01, 0x83, 0x00, 0x02, 0x01, 0x00,
+	0x01, 0x83, 0x00, 0x0a, 0x01, 0x00, 0x01, 0x02, 0x04, 0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x82,
+	0x01, 0x81, 0x00, 0x00, 0x01, 0x85, 0x00, 0x09, 0x01, 0x02, 0x06, 0x02, 0x01, 0x01, 0x00, 0x01,
+	0x00, 0x01, 0x83, 0x00, 0x0b, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x08, 0x05,
+	0x04, 0x82, 0x01, 0x81, 0x00, 0x04, 0x01, 0x00, 0x01, 0x00, 0x01, 0x83, 0x00, 0x0b, 0x01, 0x00,
+	0x01, 0x02, 0x03, 0x03, 0x11, 0x0a, 0x00, 0x01, 0x01, 0x00, 0x82, 0x01, 0x09, 0x00, 0x01, 0x00,
+	0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x02, 0x82, 0x03, 0x08, 0x0c, 0x00, 0x01, 0x00, 0x01, 0x00,
+	0x01, 0x01, 0x00, 0x82, 0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x02, 0x82, 0x03, 0x00, 0x02, 0x8f,
+	0x00, 0x00, 0x02, 0x82, 0x03, 0x01, 0x02, 0x00, 0x82, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x00,
+	0x82, 0x01, 0x01, 0x00, 0x02, 0x82, 0x03, 0x11, 0x02, 0x00, 0x22, 0x29, 0x01, 0x00, 0x2b, 0x1f,
+	0x01, 0x00, 0x16, 0x1a, 0x00, 0x01, 0x1e, 0x2a, 0x00, 0x02, 0x82, 0x03, 0x11, 0x02, 0x00, 0x2d,
+	0x31, 0x01, 0x00, 0x33, 0x25, 0x01, 0x00, 0x17, 0x1b, 0x00, 0x01, 0x23, 0x30, 0x00, 0x02, 0x82,
+	0x03, 0x11, 0x02, 0x00, 0x2e, 0x36, 0x01, 0x00, 0x34, 0x21, 0x01, 0x00, 0x14, 0x19, 0x00, 0x01,
+	0x24, 0x2c, 0x00, 0x02, 0x82, 0x03, 0x11, 0x02, 0x00, 0x32, 0x38, 0x01, 0x00, 0x37, 0x1d, 0x01,
+	0x00, 0x15, 0x18, 0x00, 0x01, 0x26, 0x2f, 0x00, 0x02, 0x82, 0x03, 0x11, 0x02, 0x00, 0x3a, 0x3b,
+	0x01, 0x00, 0x3c, 0x27, 0x01, 0x00, 0x1c, 0x20, 0x00, 0x01, 0x35, 0x39, 0x00, 0x02, 0x82, 0x03,
+	0x00, 0x02, 0x8f, 0x00, 0x00, 0x02, 0x82, 0x03, 0x00, 0x10, 0x8f, 0x02, 0x00, 0x12,
+};
+
+// 40 x 21 pixels, 2 colours, 343 bytes (was 1684)
+extern const uint8_t IconKeyboard[] =
+{
+	40, 21,		// width, height
+	2,			// number of palette entries
+	0xff, 0xff, 0x00, 0x00,
+	0x83, 0x01, 0x90, 0x00, 0x83, 0x01, 0x90, 0x00, 0x83, 0x01, 0x90, 0x00, 0x83, 0x01, 0x81, 0x00,
+	0x83, 0x01, 0x90, 0x00, 0x83, 0x01, 0x90, 0x00, 0x83, 0x01, 0x81, 0x00, 0x83, 0x01, 0x84, 0x00,
+	0x83, 0x01, 0x81, 0x00, 0x83, 0x01, 0x81, 0x00, 0x83, 0x01, 0x84, 0x00, 0x83, 0x01, 0x87, 0x00,
+	0x83, 0x01, 0x84, 0x00, 0x83, 0x01, 0x87, 0x00, 0x83, 0x01, 0x84, 0x00, 0x83, 0x01, 0x81, 0x00,
+	0x83, 0x01, 0x87, 0x00, 0x82, 0x01, 0x85, 0x00, 0x83, 0x01, 0x87, 0x00, 0x82, 0x01, 0x85, 0x00,
+	0x83, 0x01, 0x81, 0x00, 0x83, 0x01, 0x81, 0x00, 0x86, 0x01, 0x81, 0x00, 0x83, 0x01, 0x81, 0x00,
+	0x83, 0x01, 0x81, 0x00, 0x86, 0x01, 0x87, 0x00, 0x83, 0x01, 0x81, 0x00, 0x86, 0x01, 0x87, 0x00,
+	0x83, 0x01, 0x81, 0x00, 0x86, 0x01, 0x81, 0x00, 0x83, 0x01, 0x87, 0x00, 0x82, 0x01, 0x85, 0x00,
+	0x83, 0x01, 0x87, 0x00, 0x82, 0x01, 0x85, 0x00, 0x83, 0x01, 0x81, 0x00, 0x83, 0x01, 0x81, 0x00,
+	0x86, 0x01, 0x81, 0x00, 0x83, 0x01, 0x81, 0x00, 0x83, 0x01, 0x81, 0x00, 0x86, 0x01, 0x87, 0x00,
+	0x83, 0x01, 0x81, 0x00, 0x86, 0x01, 0x87, 0x00, 0x83, 0x01, 0x81, 0x00, 0x86, 0x01, 0x81, 0x00,
+	0x83, 0x01, 0x87, 0x00, 0x82, 0x01, 0x85, 0x00, 0x83, 0x01, 0x87, 0x00, 0x82, 0x01, 0x85, 0x00,
+	0x83, 0x01, 0x81, 0x00, 0x83, 0x01, 0x81, 0x00, 0x86, 0x01, 0x81, 0x00, 0x83, 0x01, 0x81, 0x00,
+	0x83, 0x01, 0x81, 0x00, 0x86, 0x01, 0x87, 0x00, 0x83, 0x01, 0x81, 0x00, 0x86, 0x01, 0x87, 0x00,
+	0x83, 0x01, 0x81, 0x00, 0x86, 0x01, 0x81, 0x00, 0x83, 0x01, 0x87, 0x00, 0x82, 0x01, 0x85, 0x00,
+	0x83, 0x01, 0x87, 0x00, 0x82, 0x01, 0x85, 0x00, 0x83, 0x01, 0x81, 0x00, 0x83, 0x01, 0x81, 0x00,
+	0x86, 0x01, 0x81, 0x00, 0x83, 0x01, 0x81, 0x00, 0x83, 0x01, 0x81, 0x00, 0x86, 0x01, 0x87, 0x00,
+	0x83, 0x01, 0x81, 0x00, 0x86, 0x01, 0x87, 0x00, 0x83, 0x01, 0x84, 0x00, 0x83, 0x01, 0x81, 0x00,
+	0x83, 0x01, 0x90, 0x00, 0x83, 0x01, 0x90, 0x00, 0x83, 0x01, 0x81, 0x00, 0x83, 0x01, 0x84, 0x00,
+	0x83, 0x01, 0x81, 0x00, 0x83, 0x01, 0x81, 0x00, 0x83, 0x01, 0x84, 0x00, 0x83, 0x01, 0x87, 0x00,
+	0x83, 0x01, 0x84, 0x00, 0x83, 0x01, 0x87, 0x00, 0x83, 0x01, 0x84, 0x00, 0x83, 0x01, 0x90, 0x00,
+};
+
+// 17 x 21 pixels, 82 colours, 444 bytes (was 718)
+extern const uint8_t IconTrash[] =
+{
+	17, 21,		// width, height
+	82,			// number of palette entries
+	0xff, 0xff, 0x7d, 0xef, 0x0c, 0x63, 0x3c, 0xe7, 0xf7, 0xbd, 0x5d, 0xef, 0x96, 0xb5, 0xd7, 0xbd,
+	0x79, 0xce, 0x9a, 0xd6, 0x9e, 0xf7, 0xbf, 0xf7, 0xdf, 0xff, 0xaa, 0x52, 0xcb, 0x5a, 0x92, 0x94,
+	0x76, 0xad, 0x2c, 0x63, 0x51, 0x8c, 0xd3, 0x9c, 0x14, 0xa5, 0x18, 0xc6, 0x59, 0xce, 0xfc, 0xde,
+	0x1c, 0xe7, 0xa2, 0x10, 0x72, 0x8c, 0xb2, 0x94, 0x35, 0xa5, 0xb7, 0xb5, 0x7a, 0xce, 0xdb, 0xde,
+	0x3d, 0xe7, 0xc3, 0x18, 0xab, 0x52, 0x2d, 0x63, 0x8e, 0x73, 0x71, 0x8c, 0xf4, 0x9c, 0x55, 0xad,
+	0x75, 0xad, 0xb6, 0xb5, 0x38, 0xc6, 0x39, 0xc6, 0xba, 0xd6, 0xbe, 0xf7, 0xe3, 0x18, 0x45, 0x29,
+	0x08, 0x42, 0x69, 0x4a, 0x8a, 0x52, 0xec, 0x5a, 0x4d, 0x6b, 0x6d, 0x6b, 0x6e, 0x6b, 0x31, 0x84,
+	0x34, 0xa5, 0xbb, 0xd6, 0xfb, 0xde, 0x7e, 0xef, 0x9f, 0xf7, 0x61, 0x08, 0x82, 0x10, 0xc2, 0x18,
+	0x86, 0x31, 0x89, 0x52, 0x8b, 0x52, 0xca, 0x5a, 0xeb, 0x5a, 0xae, 0x73, 0xaf, 0x73, 0xcf, 0x73,
+	0xcf, 0x7b, 0xef, 0x7b, 0x30, 0x84, 0x51, 0x84, 0x92, 0x8c, 0xb3, 0x94, 0xf3, 0x9c, 0x96, 0xad,
+	0xf8, 0xbd, 0x5c, 0xef,
+	0x03, 0x00, 0x49, 0x0e, 0x13, 0x91, 0x00, 0x05, 0x13, 0x14, 0x38, 0x12, 0x4a, 0x1b, 0x82, 0x0f,
+	0x81, 0x1a, 0x81, 0x25, 0x82, 0x12, 0x07, 0x4b, 0x46, 0x0f, 0x2d, 0x00, 0x07, 0x09, 0x2c, 0x83,
+	0x14, 0x81, 0x26, 0x15, 0x4e, 0x13, 0x13, 0x4d, 0x1b, 0x0f, 0x4c, 0x25, 0x12, 0x37, 0x1b, 0x00,
+	0x15, 0x3a, 0x0a, 0x01, 0x17, 0x16, 0x08, 0x08, 0x16, 0x16, 0x84, 0x08, 0x0a, 0x16, 0x2b, 0x1f,
+	0x2c, 0x38, 0x01, 0x15, 0x03, 0x2d, 0x0c, 0x0c, 0x8c, 0x00, 0x0c, 0x03, 0x29, 0x35, 0x09, 0x17,
+	0x05, 0x0c, 0x17, 0x1c, 0x1c, 0x27, 0x27, 0x28, 0x82, 0x10, 0x0e, 0x4f, 0x06, 0x06, 0x27, 0x15,
+	0x18, 0x1d, 0x33, 0x09, 0x09, 0x1f, 0x18, 0x2b, 0x29, 0x50, 0x88, 0x04, 0x81, 0x07, 0x02, 0x2b,
+	0x1c, 0x23, 0x82, 0x1e, 0x03, 0x16, 0x09, 0x03, 0x20, 0x89, 0x03, 0x08, 0x17, 0x07, 0x13, 0x34,
+	0x39, 0x2c, 0x39, 0x09, 0x17, 0x84, 0x0b, 0x81, 0x3c, 0x83, 0x0a, 0x0d, 0x0b, 0x05, 0x15, 0x26,
+	0x24, 0x18, 0x20, 0x05, 0x0b, 0x20, 0x10, 0x1c, 0x28, 0x10, 0x82, 0x06, 0x00, 0x29, 0x82, 0x1d,
+	0x0b, 0x06, 0x1e, 0x18, 0x06, 0x24, 0x3a, 0x2d, 0x0c, 0x0c, 0x28, 0x30, 0x41, 0x84, 0x0d, 0x00,
+	0x43, 0x82, 0x0e, 0x0a, 0x31, 0x35, 0x1f, 0x07, 0x45, 0x09, 0x0a, 0x0c, 0x0c, 0x01, 0x05, 0x8a,
+	0x01, 0x09, 0x51, 0x18, 0x07, 0x01, 0x15, 0x03, 0x05, 0x2a, 0x1f, 0x3b, 0x83, 0x05, 0x85, 0x01,
+	0x09, 0x3b, 0x20, 0x07, 0x1b, 0x00, 0x10, 0x2a, 0x2a, 0x37, 0x36, 0x83, 0x02, 0x12, 0x33, 0x44,
+	0x0e, 0x22, 0x22, 0x0d, 0x32, 0x31, 0x02, 0x48, 0x23, 0x00, 0x1a, 0x0f, 0x1a, 0x42, 0x2f, 0x3d,
+	0x3e, 0x82, 0x19, 0x10, 0x3f, 0x21, 0x21, 0x2e, 0x2e, 0x21, 0x19, 0x40, 0x30, 0x34, 0x00, 0x36,
+	0x22, 0x23, 0x02, 0x0e, 0x11, 0x84, 0x02, 0x82, 0x11, 0x82, 0x02, 0x06, 0x32, 0x24, 0x0a, 0x00,
+	0x11, 0x2f, 0x47, 0x90, 0x00,
+};
+
+#endif
+
+// Icons from NozzleIcons.cpp
+
+#if LARGE_FONT
+
+// 30 x 28 pixels, 4 colours, 294 bytes (was 1684)
+extern const uint8_t IconNozzle1[] =
+{
+	30, 28,		// width, height
+	4,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0x18, 0xc6, 0xef, 0x7b,
+	0x90, 0x01, 0x84, 0x00, 0x96, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00,
+	0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x85, 0x01, 0x95, 0x00, 0x85, 0x01, 0x95, 0x00,
+	0x00, 0x02, 0x84, 0x01, 0x96, 0x00, 0x00, 0x02, 0x83, 0x01, 0x97, 0x00, 0x00, 0x02, 0x82, 0x01,
+	0x85, 0x00, 0x00, 0x03, 0x91, 0x00, 0x02, 0x02, 0x01, 0x01, 0x84, 0x00, 0x01, 0x03, 0x01, 0x87,
+	0x00, 0x81, 0x01, 0x88, 0x00, 0x01, 0x02, 0x01, 0x83, 0x00, 0x02, 0x03, 0x01, 0x01, 0x87, 0x00,
+	0x81, 0x01, 0x89, 0x00, 0x00, 0x02, 0x83, 0x00, 0x8c, 0x01, 0x8e, 0x00, 0x8c, 0x01, 0x8e, 0x00,
+	0x8c, 0x01, 0x8e, 0x00, 0x8c, 0x01, 0x99, 0x00, 0x81, 0x01, 0x89, 0x00, 0x00, 0x02, 0x8e, 0x00,
+	0x81, 0x01, 0x88, 0x00, 0x01, 0x02, 0x01, 0x98, 0x00, 0x02, 0x02, 0x01, 0x01, 0x97, 0x00, 0x00,
+	0x02, 0x82, 0x01, 0x96, 0x00, 0x00, 0x02, 0x83, 0x01, 0x95, 0x00, 0x00, 0x02, 0x84, 0x01, 0x95,
+	0x00, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84,
+	0x00, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84,
+	0x00, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84,
+	0x00, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84,
+	0x00, 0x96, 0x01, 0x84, 0x00, 0x96, 0x01, 0x84, 0x00, 0x85, 0x01,
+};
+
+// 30 x 28 pixels, 4 colours, 354 bytes (was 1684)
+extern const uint8_t IconNozzle2[] =
+{
+	30, 28,		// width, height
+	4,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0xef, 0x7b, 0x18, 0xc6,
+	0x90, 0x01, 0x84, 0x00, 0x96, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00,
+	0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x85, 0x01, 0x95, 0x00, 0x85, 0x01, 0x95, 0x00,
+	0x00, 0x03, 0x84, 0x01, 0x96, 0x00, 0x00, 0x03, 0x83, 0x01, 0x97, 0x00, 0x00, 0x03, 0x82, 0x01,
+	0x98, 0x00, 0x02, 0x03, 0x01, 0x01, 0x84, 0x00, 0x02, 0x02, 0x01, 0x01, 0x84, 0x00, 0x00, 0x02,
+	0x82, 0x01, 0x88, 0x00, 0x01, 0x03, 0x01, 0x83, 0x00, 0x00, 0x02, 0x82, 0x01, 0x83, 0x00, 0x00,
+	0x02, 0x83, 0x01, 0x89, 0x00, 0x00, 0x03, 0x83, 0x00, 0x82, 0x01, 0x00, 0x02, 0x82, 0x00, 0x00,
+	0x02, 0x84, 0x01, 0x8e, 0x00, 0x81, 0x01, 0x00, 0x02, 0x82, 0x00, 0x00, 0x02, 0x82, 0x01, 0x02,
+	0x02, 0x01, 0x01, 0x8e, 0x00, 0x81, 0x01, 0x03, 0x02, 0x00, 0x00, 0x02, 0x82, 0x01, 0x03, 0x02,
+	0x00, 0x01, 0x01, 0x8e, 0x00, 0x82, 0x01, 0x01, 0x02, 0x00, 0x82, 0x01, 0x04, 0x02, 0x00, 0x00,
+	0x01, 0x01, 0x8e, 0x00, 0x00, 0x02, 0x85, 0x01, 0x00, 0x02, 0x82, 0x00, 0x81, 0x01, 0x89, 0x00,
+	0x00, 0x03, 0x84, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x02, 0x83, 0x00, 0x81, 0x01, 0x88, 0x00,
+	0x01, 0x03, 0x01, 0x98, 0x00, 0x02, 0x03, 0x01, 0x01, 0x97, 0x00, 0x00, 0x03, 0x82, 0x01, 0x96,
+	0x00, 0x00, 0x03, 0x83, 0x01, 0x95, 0x00, 0x00, 0x03, 0x84, 0x01, 0x95, 0x00, 0x89, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84, 0x00, 0x89, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84, 0x00, 0x89, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84, 0x00, 0x89, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84, 0x00, 0x96, 0x01, 0x84,
+	0x00, 0x96, 0x01, 0x84, 0x00, 0x85, 0x01,
+};
+
+// 30 x 28 pixels, 4 colours, 357 bytes (was 1684)
+extern const uint8_t IconNozzle3[] =
+{
+	30, 28,		// width, height
+	4,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0x10, 0x84, 0x18, 0xc6,
+	0x90, 0x01, 0x84, 0x00, 0x96, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00,
+	0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x85, 0x01, 0x95, 0x00, 0x85, 0x01, 0x95, 0x00,
+	0x00, 0x03, 0x84, 0x01, 0x96, 0x00, 0x00, 0x03, 0x83, 0x01, 0x97, 0x00, 0x00, 0x03, 0x82, 0x01,
+	0x98, 0x00, 0x02, 0x03, 0x01, 0x01, 0x84, 0x00, 0x02, 0x02, 0x01, 0x01, 0x84, 0x00, 0x81, 0x01,
+	0x00, 0x02, 0x89, 0x00, 0x01, 0x03, 0x01, 0x83, 0x00, 0x00, 0x02, 0x82, 0x01, 0x84, 0x00, 0x82,
+	0x01, 0x00, 0x02, 0x89, 0x00, 0x00, 0x03, 0x83, 0x00, 0x82, 0x01, 0x00, 0x02, 0x84, 0x00, 0x00,
+	0x02, 0x82, 0x01, 0x8e, 0x00, 0x81, 0x01, 0x00, 0x02, 0x86, 0x00, 0x02, 0x02, 0x01, 0x01, 0x8e,
+	0x00, 0x81, 0x01, 0x0a, 0x02, 0x00, 0x00, 0x02, 0x01, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x8e,
+	0x00, 0x82, 0x01, 0x81, 0x02, 0x82, 0x01, 0x81, 0x02, 0x82, 0x01, 0x8e, 0x00, 0x00, 0x02, 0x84,
+	0x01, 0x00, 0x02, 0x84, 0x01, 0x00, 0x02, 0x89, 0x00, 0x00, 0x03, 0x84, 0x00, 0x00, 0x02, 0x82,
+	0x01, 0x02, 0x02, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x89, 0x00, 0x01, 0x03, 0x01, 0x86, 0x00,
+	0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x8a, 0x00, 0x02, 0x03, 0x01, 0x01, 0x97, 0x00, 0x00, 0x03,
+	0x82, 0x01, 0x96, 0x00, 0x00, 0x03, 0x83, 0x01, 0x95, 0x00, 0x00, 0x03, 0x84, 0x01, 0x95, 0x00,
+	0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84, 0x00,
+	0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84, 0x00,
+	0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84, 0x00,
+	0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84, 0x00,
+	0x96, 0x01, 0x84, 0x00, 0x96, 0x01, 0x84, 0x00, 0x85, 0x01,
+};
+
+// 30 x 28 pixels, 3 colours, 277 bytes (was 1684)
+extern const uint8_t IconNozzle4[] =
+{
+	30, 28,		// width, height
+	3,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0x18, 0xc6,
+	0x90, 0x01, 0x84, 0x00, 0x96, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00,
+	0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x85, 0x01, 0x95, 0x00, 0x85, 0x01, 0x95, 0x00,
+	0x00, 0x02, 0x84, 0x01, 0x96, 0x00, 0x00, 0x02, 0x83, 0x01, 0x97, 0x00, 0x00, 0x02, 0x82, 0x01,
+	0x98, 0x00, 0x02, 0x02, 0x01, 0x01, 0x83, 0x00, 0x88, 0x01, 0x8c, 0x00, 0x01, 0x02, 0x01, 0x83,
+	0x00, 0x88, 0x01, 0x8d, 0x00, 0x00, 0x02, 0x8a, 0x00, 0x81, 0x01, 0x99, 0x00, 0x81, 0x01, 0x97,
+	0x00, 0x87, 0x01, 0x93, 0x00, 0x87, 0x01, 0x95, 0x00, 0x81, 0x01, 0x8d, 0x00, 0x00, 0x02, 0x8a,
+	0x00, 0x81, 0x01, 0x8c, 0x00, 0x01, 0x02, 0x01, 0x98, 0x00, 0x02, 0x02, 0x01, 0x01, 0x97, 0x00,
+	0x00, 0x02, 0x82, 0x01, 0x96, 0x00, 0x00, 0x02, 0x83, 0x01, 0x95, 0x00, 0x00, 0x02, 0x84, 0x01,
+	0x95, 0x00, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01,
+	0x84, 0x00, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01,
+	0x84, 0x00, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01,
+	0x84, 0x00, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01,
+	0x84, 0x00, 0x96, 0x01, 0x84, 0x00, 0x96, 0x01, 0x84, 0x00, 0x85, 0x01,
+};
+
+// 30 x 28 pixels, 4 colours, 335 bytes (was 1684)
+extern const uint8_t IconNozzle5[] =
+{
+	30, 28,		// width, height
+	4,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0x18, 0xc6, 0x10, 0x84,
+	0x90, 0x01, 0x84, 0x00, 0x96, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00,
+	0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x85, 0x01, 0x95, 0x00, 0x85, 0x01, 0x95, 0x00,
+	0x85, 0x01, 0x96, 0x00, 0x84, 0x01, 0x97, 0x00, 0x83, 0x01, 0x98, 0x00, 0x82, 0x01, 0x83, 0x00,
+	0x85, 0x01, 0x05, 0x02, 0x00, 0x00, 0x01, 0x01, 0x02, 0x89, 0x00, 0x81, 0x01, 0x83, 0x00, 0x85,
+	0x01, 0x02, 0x02, 0x00, 0x00, 0x82, 0x01, 0x00, 0x03, 0x89, 0x00, 0x00, 0x01, 0x83, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x02, 0x03, 0x01, 0x02, 0x82, 0x00, 0x02, 0x02, 0x01, 0x01, 0x8e, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x02, 0x03, 0x01, 0x02, 0x83, 0x00, 0x81, 0x01, 0x8e, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x02, 0x03, 0x01, 0x02, 0x83, 0x00, 0x81, 0x01, 0x8e, 0x00, 0x81, 0x01, 0x81, 0x00, 0x02,
+	0x03, 0x01, 0x01, 0x82, 0x00, 0x02, 0x02, 0x01, 0x01, 0x8e, 0x00, 0x81, 0x01, 0x82, 0x00, 0x86,
+	0x01, 0x00, 0x03, 0x89, 0x00, 0x00, 0x01, 0x83, 0x00, 0x81, 0x01, 0x82, 0x00, 0x01, 0x03, 0x02,
+	0x83, 0x01, 0x00, 0x03, 0x89, 0x00, 0x81, 0x01, 0x98, 0x00, 0x82, 0x01, 0x97, 0x00, 0x83, 0x01,
+	0x96, 0x00, 0x84, 0x01, 0x95, 0x00, 0x85, 0x01, 0x95, 0x00, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01,
+	0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84, 0x00, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01,
+	0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84, 0x00, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01,
+	0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84, 0x00, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01,
+	0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84, 0x00, 0x96, 0x01, 0x84, 0x00, 0x96, 0x01,
+	0x84, 0x00, 0x85, 0x01,
+};
+
+// 30 x 28 pixels, 4 colours, 342 bytes (was 1684)
+extern const uint8_t IconNozzle6[] =
+{
+	30, 28,		// width, height
+	4,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0x10, 0x84, 0x18, 0xc6,
+	0x90, 0x01, 0x84, 0x00, 0x96, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00,
+	0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x00, 0x01, 0x84, 0x00, 0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x00, 0x01, 0x84, 0x00, 0x85, 0x01, 0x95, 0x00, 0x85, 0x01, 0x95, 0x00,
+	0x00, 0x03, 0x84, 0x01, 0x96, 0x00, 0x00, 0x03, 0x83, 0x01, 0x97, 0x00, 0x00, 0x03, 0x82, 0x01,
+	0x98, 0x00, 0x02, 0x03, 0x01, 0x01, 0x85, 0x00, 0x01, 0x02, 0x03, 0x86, 0x01, 0x00, 0x02, 0x89,
+	0x00, 0x01, 0x03, 0x01, 0x84, 0x00, 0x00, 0x02, 0x89, 0x01, 0x00, 0x02, 0x89, 0x00, 0x00, 0x03,
+	0x83, 0x00, 0x00, 0x02, 0x82, 0x01, 0x05, 0x03, 0x01, 0x01, 0x03, 0x00, 0x02, 0x82, 0x01, 0x8e,
+	0x00, 0x82, 0x01, 0x03, 0x02, 0x00, 0x01, 0x01, 0x82, 0x00, 0x02, 0x02, 0x01, 0x01, 0x8e, 0x00,
+	0x81, 0x01, 0x0a, 0x02, 0x00, 0x00, 0x01, 0x01, 0x02, 0x00, 0x00, 0x02, 0x01, 0x01, 0x8e, 0x00,
+	0x81, 0x01, 0x82, 0x00, 0x82, 0x01, 0x81, 0x02, 0x82, 0x01, 0x8e, 0x00, 0x81, 0x01, 0x82, 0x00,
+	0x00, 0x02, 0x85, 0x01, 0x00, 0x02, 0x89, 0x00, 0x00, 0x03, 0x89, 0x00, 0x00, 0x02, 0x83, 0x01,
+	0x00, 0x02, 0x89, 0x00, 0x01, 0x03, 0x01, 0x98, 0x00, 0x02, 0x03, 0x01, 0x01, 0x97, 0x00, 0x00,
+	0x03, 0x82, 0x01, 0x96, 0x00, 0x00, 0x03, 0x83, 0x01, 0x95, 0x00, 0x00, 0x03, 0x84, 0x01, 0x95,
+	0x00, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84,
+	0x00, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84,
+	0x00, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84,
+	0x00, 0x89, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x84,
+	0x00, 0x96, 0x01, 0x84, 0x00, 0x96, 0x01, 0x84, 0x00, 0x85, 0x01,
+};
+
+// 27 x 30 pixels, 3 colours, 405 bytes (was 1624)
+extern const uint8_t IconBed[] =
+{
+	27, 30,		// width, height
+	3,			// number of palette entries
+	0xff, 0xff, 0x00, 0x00, 0x18, 0xc6,
+	0x98, 0x00, 0x84, 0x01, 0x98, 0x00, 0x84, 0x01, 0x83, 0x00, 0x00, 0x02, 0x88, 0x00, 0x00, 0x02,
+	0x89, 0x00, 0x84, 0x01, 0x81, 0x00, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02,
+	0x82, 0x01, 0x00, 0x02, 0x87, 0x00, 0x84, 0x01, 0x07, 0x00, 0x02, 0x01, 0x02, 0x00, 0x02, 0x01,
+	0x02, 0x82, 0x00, 0x06, 0x02, 0x01, 0x02, 0x00, 0x02, 0x01, 0x02, 0x82, 0x00, 0x03, 0x02, 0x01,
+	0x00, 0x00, 0x84, 0x01, 0x02, 0x00, 0x01, 0x02, 0x82, 0x00, 0x06, 0x02, 0x01, 0x02, 0x00, 0x02,
+	0x01, 0x02, 0x82, 0x00, 0x08, 0x02, 0x01, 0x02, 0x00, 0x02, 0x01, 0x02, 0x00, 0x00, 0x84, 0x01,
+	0x86, 0x00, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02,
+	0x82, 0x00, 0x84, 0x01, 0x88, 0x00, 0x00, 0x02, 0x88, 0x00, 0x00, 0x02, 0x84, 0x00, 0x84, 0x01,
+	0x98, 0x00, 0x84, 0x01, 0x98, 0x00, 0x84, 0x01, 0x83, 0x00, 0x00, 0x02, 0x88, 0x00, 0x00, 0x02,
+	0x89, 0x00, 0x84, 0x01, 0x81, 0x00, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02,
+	0x82, 0x01, 0x00, 0x02, 0x87, 0x00, 0x84, 0x01, 0x07, 0x00, 0x02, 0x01, 0x02, 0x00, 0x02, 0x01,
+	0x02, 0x82, 0x00, 0x06, 0x02, 0x01, 0x02, 0x00, 0x02, 0x01, 0x02, 0x82, 0x00, 0x03, 0x02, 0x01,
+	0x00, 0x00, 0x84, 0x01, 0x02, 0x00, 0x01, 0x02, 0x82, 0x00, 0x06, 0x02, 0x01, 0x02, 0x00, 0x02,
+	0x01, 0x02, 0x82, 0x00, 0x08, 0x02, 0x01, 0x02, 0x00, 0x02, 0x01, 0x02, 0x00, 0x00, 0x84, 0x01,
+	0x86, 0x00, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02,
+	0x82, 0x00, 0x84, 0x01, 0x88, 0x00, 0x00, 0x02, 0x88, 0x00, 0x00, 0x02, 0x84, 0x00, 0x84, 0x01,
+	0x98, 0x00, 0x84, 0x01, 0x98, 0x00, 0x84, 0x01, 0x83, 0x00, 0x00, 0x02, 0x88, 0x00, 0x00, 0x02,
+	0x89, 0x00, 0x84, 0x01, 0x81, 0x00, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02,
+	0x82, 0x01, 0x00, 0x02, 0x87, 0x00, 0x84, 0x01, 0x07, 0x00, 0x02, 0x01, 0x02, 0x00, 0x02, 0x01,
+	0x02, 0x82, 0x00, 0x06, 0x02, 0x01, 0x02, 0x00, 0x02, 0x01, 0x02, 0x82, 0x00, 0x03, 0x02, 0x01,
+	0x00, 0x00, 0x84, 0x01, 0x02, 0x00, 0x01, 0x02, 0x82, 0x00, 0x06, 0x02, 0x01, 0x02, 0x00, 0x02,
+	0x01, 0x02, 0x82, 0x00, 0x08, 0x02, 0x01, 0x02, 0x00, 0x02, 0x01, 0x02, 0x00, 0x00, 0x84, 0x01,
+	0x86, 0x00, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02, 0x84, 0x00, 0x00, 0x02, 0x82, 0x01, 0x00, 0x02,
+	0x82, 0x00, 0x84, 0x01, 0x88, 0x00, 0x00, 0x02, 0x88, 0x00, 0x00, 0x02, 0x84, 0x00, 0x84, 0x01,
+	0x98, 0x00, 0x84, 0x01, 0x98, 0x00, 0x84, 0x01, 0x98, 0x00, 0x84, 0x01,
+};
+
+#else
+
+// 21 x 21 pixels, 10 colours, 213 bytes (was 886)
+extern const uint8_t IconNozzle1[] =
+{
+	21, 21,		// width, height
+	10,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0x20, 0xb3, 0xd7, 0xbd, 0x07, 0x00, 0xdf, 0x96, 0xbf, 0x65, 0x61, 0x08,
+	0xc0, 0x91, 0xfb, 0xff,
+	0x8c, 0x01, 0x82, 0x00, 0x91, 0x01, 0x82, 0x00, 0x85, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x82, 0x00, 0x85, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x82, 0x00, 0x84, 0x01, 0x8f, 0x00, 0x84, 0x01, 0x8f, 0x00,
+	0x00, 0x03, 0x83, 0x01, 0x90, 0x00, 0x00, 0x03, 0x82, 0x01, 0x82, 0x00, 0x00, 0x06, 0x87, 0x00,
+	0x00, 0x06, 0x84, 0x00, 0x06, 0x03, 0x01, 0x01, 0x00, 0x00, 0x04, 0x01, 0x87, 0x04, 0x00, 0x01,
+	0x85, 0x00, 0x05, 0x03, 0x01, 0x00, 0x00, 0x05, 0x01, 0x87, 0x05, 0x00, 0x01, 0x86, 0x00, 0x02,
+	0x03, 0x00, 0x00, 0x8a, 0x01, 0x86, 0x00, 0x02, 0x07, 0x00, 0x00, 0x89, 0x02, 0x00, 0x01, 0x86,
+	0x00, 0x00, 0x03, 0x8b, 0x00, 0x00, 0x09, 0x85, 0x00, 0x01, 0x03, 0x01, 0x8b, 0x00, 0x00, 0x08,
+	0x84, 0x00, 0x02, 0x03, 0x01, 0x01, 0x90, 0x00, 0x00, 0x03, 0x82, 0x01, 0x8f, 0x00, 0x00, 0x03,
+	0x83, 0x01, 0x8f, 0x00, 0x86, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x00, 0x01, 0x82, 0x00, 0x86, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x00, 0x01, 0x82, 0x00, 0x91, 0x01, 0x82, 0x00, 0x91, 0x01, 0x82, 0x00, 0x84, 0x01,
+};
+
+// 21 x 21 pixels, 23 colours, 287 bytes (was 886)
+extern const uint8_t IconNozzle2[] =
+{
+	21, 21,		// width, height
+	23,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0xd7, 0xbd, 0x0c, 0x00, 0x36, 0x03, 0x00, 0x38, 0x00, 0x60, 0xd2, 0xfe,
+	0xd2, 0x01, 0x9b, 0x3c, 0xbf, 0x65, 0xc0, 0x91, 0x20, 0xb3, 0xff, 0xdf, 0xac, 0xfd, 0xf6, 0xff,
+	0xfb, 0xff, 0x07, 0x00, 0x61, 0x08, 0xdf, 0x96, 0xac, 0xb5, 0xf6, 0xb7, 0xff, 0xb7,
+	0x8c, 0x01, 0x82, 0x00, 0x91, 0x01, 0x82, 0x00, 0x85, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x82, 0x00, 0x85, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x82, 0x00, 0x84, 0x01, 0x8f, 0x00, 0x84, 0x01, 0x8f, 0x00,
+	0x00, 0x02, 0x83, 0x01, 0x90, 0x00, 0x00, 0x02, 0x82, 0x01, 0x81, 0x00, 0x82, 0x03, 0x85, 0x00,
+	0x81, 0x04, 0x84, 0x00, 0x07, 0x02, 0x01, 0x01, 0x00, 0x00, 0x16, 0x15, 0x14, 0x84, 0x00, 0x02,
+	0x09, 0x01, 0x01, 0x85, 0x00, 0x05, 0x02, 0x01, 0x00, 0x00, 0x01, 0x06, 0x84, 0x00, 0x03, 0x0a,
+	0x0e, 0x01, 0x01, 0x86, 0x00, 0x03, 0x02, 0x00, 0x00, 0x01, 0x83, 0x00, 0x05, 0x11, 0x0a, 0x07,
+	0x00, 0x01, 0x01, 0x86, 0x00, 0x0d, 0x12, 0x00, 0x00, 0x01, 0x09, 0x08, 0x08, 0x04, 0x13, 0x0f,
+	0x05, 0x00, 0x01, 0x01, 0x86, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x07, 0x01, 0x0d, 0x0d, 0x01, 0x10,
+	0x06, 0x00, 0x00, 0x01, 0x01, 0x85, 0x00, 0x09, 0x02, 0x01, 0x00, 0x00, 0x05, 0x07, 0x10, 0x0f,
+	0x0e, 0x0b, 0x82, 0x00, 0x81, 0x01, 0x84, 0x00, 0x02, 0x02, 0x01, 0x01, 0x82, 0x00, 0x02, 0x05,
+	0x0b, 0x06, 0x84, 0x00, 0x81, 0x0c, 0x83, 0x00, 0x00, 0x02, 0x82, 0x01, 0x8f, 0x00, 0x00, 0x02,
+	0x83, 0x01, 0x8f, 0x00, 0x86, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x00, 0x01, 0x82, 0x00, 0x86, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x00, 0x01, 0x82, 0x00, 0x91, 0x01, 0x82, 0x00, 0x91, 0x01, 0x82, 0x00, 0x84, 0x01,
+};
+
+// 21 x 21 pixels, 22 colours, 286 bytes (was 886)
+extern const uint8_t IconNozzle3[] =
+{
+	21, 21,		// width, height
+	22,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0xd7, 0xbd, 0x36, 0x03, 0x00, 0x60, 0xf6, 0xff, 0x0c, 0x00, 0x07, 0x00,
+	0x9b, 0x3c, 0xbf, 0x65, 0xdf, 0x96, 0x20, 0xb3, 0x87, 0xdc, 0xac, 0xfd, 0x61, 0x08, 0x00, 0x38,
+	0xc0, 0x91, 0xac, 0xb5, 0xf6, 0xb7, 0xff, 0xb7, 0xd2, 0xfe, 0xfb, 0xff,
+	0x8c, 0x01, 0x82, 0x00, 0x91, 0x01, 0x82, 0x00, 0x85, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x82, 0x00, 0x85, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x82, 0x00, 0x84, 0x01, 0x8f, 0x00, 0x84, 0x01, 0x8f, 0x00,
+	0x00, 0x02, 0x83, 0x01, 0x90, 0x00, 0x00, 0x02, 0x82, 0x01, 0x81, 0x00, 0x82, 0x06, 0x84, 0x00,
+	0x82, 0x03, 0x84, 0x00, 0x07, 0x02, 0x01, 0x01, 0x00, 0x00, 0x13, 0x12, 0x11, 0x84, 0x00, 0x02,
+	0x0b, 0x0d, 0x01, 0x85, 0x00, 0x05, 0x02, 0x01, 0x00, 0x00, 0x01, 0x04, 0x82, 0x00, 0x00, 0x08,
+	0x83, 0x00, 0x00, 0x01, 0x86, 0x00, 0x03, 0x02, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x83,
+	0x00, 0x00, 0x01, 0x86, 0x00, 0x0d, 0x0e, 0x00, 0x00, 0x01, 0x09, 0x03, 0x03, 0x09, 0x05, 0x03,
+	0x07, 0x07, 0x08, 0x01, 0x86, 0x00, 0x03, 0x02, 0x00, 0x00, 0x14, 0x83, 0x01, 0x05, 0x04, 0x01,
+	0x0a, 0x0a, 0x01, 0x05, 0x85, 0x00, 0x0e, 0x02, 0x01, 0x00, 0x00, 0x0f, 0x0d, 0x05, 0x05, 0x0c,
+	0x00, 0x05, 0x01, 0x01, 0x15, 0x04, 0x84, 0x00, 0x02, 0x02, 0x01, 0x01, 0x83, 0x00, 0x81, 0x04,
+	0x81, 0x00, 0x03, 0x04, 0x0b, 0x0c, 0x10, 0x84, 0x00, 0x00, 0x02, 0x82, 0x01, 0x8f, 0x00, 0x00,
+	0x02, 0x83, 0x01, 0x8f, 0x00, 0x86, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x00, 0x01, 0x82, 0x00, 0x86, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x00, 0x01, 0x82, 0x00, 0x91, 0x01, 0x82, 0x00, 0x91, 0x01, 0x82, 0x00, 0x84, 0x01,
+};
+
+// 21 x 21 pixels, 18 colours, 248 bytes (was 886)
+extern const uint8_t IconNozzle4[] =
+{
+	21, 21,		// width, height
+	18,			// number of palette entries
+	0x00, 0x00, 0xff, 0xff, 0xac, 0xfd, 0xd7, 0xbd, 0x9b, 0x3c, 0x0c, 0x00, 0x36, 0x03, 0xbf, 0x65,
+	0xdf, 0x96, 0xd2, 0x01, 0x61, 0x08, 0x00, 0x38, 0xc0, 0x91, 0xb6, 0xb5, 0xfb, 0xb7, 0xff, 0xb7,
+	0x87, 0xdc, 0xd2, 0xde,
+	0x8c, 0x01, 0x82, 0x00, 0x91, 0x01, 0x82, 0x00, 0x85, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x82, 0x00, 0x85, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x82, 0x00, 0x84, 0x01, 0x8f, 0x00, 0x84, 0x01, 0x8f, 0x00,
+	0x00, 0x03, 0x83, 0x01, 0x87, 0x00, 0x02, 0x09, 0x08, 0x08, 0x85, 0x00, 0x00, 0x03, 0x82, 0x01,
+	0x85, 0x00, 0x04, 0x05, 0x07, 0x11, 0x01, 0x01, 0x86, 0x00, 0x02, 0x03, 0x01, 0x01, 0x84, 0x00,
+	0x05, 0x06, 0x0e, 0x10, 0x0b, 0x01, 0x01, 0x87, 0x00, 0x01, 0x03, 0x01, 0x82, 0x00, 0x07, 0x05,
+	0x07, 0x02, 0x0c, 0x00, 0x00, 0x01, 0x01, 0x88, 0x00, 0x05, 0x03, 0x00, 0x00, 0x06, 0x0f, 0x0d,
+	0x83, 0x04, 0x81, 0x01, 0x81, 0x04, 0x86, 0x00, 0x02, 0x0a, 0x00, 0x00, 0x8a, 0x01, 0x86, 0x00,
+	0x02, 0x03, 0x00, 0x00, 0x86, 0x02, 0x81, 0x01, 0x81, 0x02, 0x85, 0x00, 0x01, 0x03, 0x01, 0x88,
+	0x00, 0x81, 0x02, 0x86, 0x00, 0x02, 0x03, 0x01, 0x01, 0x90, 0x00, 0x00, 0x03, 0x82, 0x01, 0x8f,
+	0x00, 0x00, 0x03, 0x83, 0x01, 0x8f, 0x00, 0x86, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x86, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x00, 0x01, 0x82, 0x00, 0x91, 0x01, 0x82, 0x00, 0x91, 0x01, 0x82, 0x00, 0x84,
+	0x01,
+};
+
+// 20 x 21 pixels, 3 colours, 257 bytes (was 844)
+extern const uint8_t IconBed[] =
+{
+	20, 21,		// width, height
+	3,			// number of palette entries
+	0xff, 0xff, 0x00, 0x00, 0x18, 0xc6,
+	0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01, 0x04, 0x00, 0x02, 0x01, 0x01, 0x02, 0x83, 0x00,
+	0x03, 0x02, 0x01, 0x01, 0x02, 0x84, 0x00, 0x82, 0x01, 0x11, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02,
+	0x00, 0x00, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x00, 0x00, 0x02, 0x00, 0x83, 0x01, 0x10, 0x02,
+	0x00, 0x00, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x00, 0x00, 0x02, 0x01, 0x02, 0x02, 0x01, 0x00,
+	0x82, 0x01, 0x85, 0x00, 0x81, 0x01, 0x84, 0x00, 0x04, 0x02, 0x01, 0x01, 0x02, 0x00, 0x82, 0x01,
+	0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01, 0x04, 0x00, 0x02, 0x01, 0x01, 0x02, 0x83, 0x00,
+	0x03, 0x02, 0x01, 0x01, 0x02, 0x84, 0x00, 0x82, 0x01, 0x11, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02,
+	0x00, 0x00, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x00, 0x00, 0x02, 0x00, 0x83, 0x01, 0x10, 0x02,
+	0x00, 0x00, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x00, 0x00, 0x02, 0x01, 0x02, 0x02, 0x01, 0x00,
+	0x82, 0x01, 0x85, 0x00, 0x81, 0x01, 0x84, 0x00, 0x04, 0x02, 0x01, 0x01, 0x02, 0x00, 0x82, 0x01,
+	0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01, 0x04, 0x00, 0x02, 0x01, 0x01, 0x02, 0x83, 0x00,
+	0x03, 0x02, 0x01, 0x01, 0x02, 0x84, 0x00, 0x82, 0x01, 0x11, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02,
+	0x00, 0x00, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x00, 0x00, 0x02, 0x00, 0x83, 0x01, 0x10, 0x02,
+	0x00, 0x00, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02, 0x00, 0x00, 0x02, 0x01, 0x02, 0x02, 0x01, 0x00,
+	0x82, 0x01, 0x85, 0x00, 0x81, 0x01, 0x84, 0x00, 0x04, 0x02, 0x01, 0x01, 0x02, 0x00, 0x82, 0x01,
+	0x91, 0x00, 0x82, 0x01, 0x91, 0x00, 0x82, 0x01,
+};
+
+#endif
+
+// End
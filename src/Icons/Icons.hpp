@@ -9,19 +9,19 @@
 #ifndef ICONS_H_
 #define ICONS_H_
 
-extern const uint16_t IconNozzle1[], IconNozzle2[], IconNozzle3[], IconNozzle4[];
+extern const uint8_t IconNozzle1[], IconNozzle2[], IconNozzle3[], IconNozzle4[];
 
 #if DISPLAY_X == 800
-extern const uint16_t IconNozzle5[], IconNozzle6[];
+extern const uint8_t IconNozzle5[], IconNozzle6[];
 #endif
 
-extern const uint16_t IconHomeAll[], IconHomeX[], IconHomeY[], IconHomeZ[], IconHomeU[], IconBedComp[];
+extern const uint8_t IconHomeAll[], IconHomeX[], IconHomeY[], IconHomeZ[], IconHomeU[], IconBedComp[];
 
 #if DISPLAY_X == 800
-extern const uint16_t IconHomeV[], IconHomeW[];
+extern const uint8_t IconHomeV[], IconHomeW[];
 #endif
 
-extern const uint16_t IconBed[], IconOk[], IconCancel[], IconFiles[], IconKeyboard[], IconTrash[];
-extern const uint16_t IconBackspace[], IconUp[], IconDown[], IconEnter[];
+extern const uint8_t IconBed[], IconOk[], IconCancel[], IconFiles[], IconKeyboard[], IconTrash[];
+extern const uint8_t IconBackspace[], IconUp[], IconDown[], IconEnter[];
 
 #endif /* ICONS_H_ */
\ No newline at end of file
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+#
+# iconcompress.py
+#
+# Created: 16/10/2026 14:22:40
+#
+# Icon compiler step for PanelDue. Reads the uncompressed RGB565 icon arrays in HomeIcons.cpp, KeyIcons.cpp, MiscIcons.cpp
+# and NozzleIcons.cpp and generates IconData.cpp, which holds each icon as a palette and run-length encoded palette indices.
+# See UTFT::drawPalettedBitmap for a description of the format. Each icon is decoded again and compared with the original.
+#
+# Run this whenever an icon is changed or added, e.g.:
+#   python3 iconcompress.py HomeIcons.cpp KeyIcons.cpp MiscIcons.cpp NozzleIcons.cpp > IconData.cpp
+# The input files are not compiled into the firmware.
+
+import os
+import re
+import sys
+
+MAX_RUN = 128				# longest run in one block
+MAX_LITERALS = 128			# most literal pixels in one block
+
+def read_icons(filename):
+	"""Return a list of items from the file. Each item is either a preprocessor line or a (name, width, height, pixels) tuple."""
+	with open(filename, encoding='latin-1') as f:
+		text = f.read()
+	text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+	items = []
+	pos = 0
+	pattern = re.compile(r'^\s*(#\s*(?:if|ifdef|ifndef|else|elif|endif)\b[^\n]*)$|extern\s+const\s+uint16_t\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\}\s*;', re.M | re.S)
+	for m in pattern.finditer(text):
+		if m.group(1) is not None:
+			items.append(m.group(1).strip())
+		else:
+			body = re.sub(r'//[^\n]*', '', m.group(3))
+			values = [int(v, 0) for v in body.replace('\n', ' ').split(',') if v.strip() != '']
+			width, height, pixels = values[0], values[1], values[2:]
+			if len(pixels) != width * height:
+				raise ValueError("Icon %s in %s has the wrong number of pixels" % (m.group(2), filename))
+			items.append((m.group(2), width, height, pixels))
+	return items
+
+def encode(pixels):
+	"""Return the palette and the encoded pixel data for an icon"""
+	counts = {}
+	for p in pixels:
+		counts[p] = counts.get(p, 0) + 1
+	palette = sorted(counts, key=lambda c: (-counts[c], c))
+	if len(palette) > 255:
+		raise ValueError("Too many colours in icon")
+	index_of = dict((c, i) for i, c in enumerate(palette))
+	indices = [index_of[p] for p in pixels]
+
+	data = []
+	literals = []
+	def flush_literals():
+		while literals:
+			block = literals[:MAX_LITERALS]
+			del literals[:MAX_LITERALS]
+			data.append(len(block) - 1)
+			data.extend(block)
+	i = 0
+	while i < len(indices):
+		run = 1
+		while i + run < len(indices) and indices[i + run] == indices[i]:
+			run += 1
+		# A run of 2 costs the same as 2 literals, so only use it if we are not already in the middle of some literals
+		if run >= 3 or (run == 2 and not literals):
+			flush_literals()
+			left = run
+			while left != 0:
+				num = min(left, MAX_RUN)
+				data.append(0x80 + num - 1)
+				data.append(indices[i])
+				left -= num
+		else:
+			literals.extend(indices[i:i + run])
+		i += run
+	flush_literals()
+	return palette, data
+
+def decode(palette, data, num_pixels):
+	"""Decode the pixel data in the same way that UTFT::drawPalettedBitmap does"""
+	pixels = []
+	i = 0
+	while len(pixels) < num_pixels:
+		control = data[i]
+		i += 1
+		if control & 0x80:
+			pixels.extend([palette[data[i]]] * ((control & 0x7F) + 1))
+			i += 1
+		else:
+			pixels.extend(palette[data[j]] for j in range(i, i + control + 1))
+			i += control + 1
+	if i != len(data) or len(pixels) != num_pixels:
+		raise ValueError("Encoded data has the wrong length")
+	return pixels
+
+def format_bytes(values, indent='\t'):
+	lines = []
+	for i in range(0, len(values), 16):
+		lines.append(indent + ' '.join('0x%02x,' % v for v in values[i:i + 16]))
+	return '\n'.join(lines)
+
+def main(argv):
+	if len(argv) < 2:
+		sys.stderr.write("Usage: iconcompress.py icons.cpp [icons.cpp ...]\n")
+		return 1
+	out = []
+	out.append('/*\n * IconData.cpp\n *\n * Generated by iconcompress.py from ' + ', '.join(os.path.basename(f) for f in argv[1:]) + '. Do not edit.\n */\n')
+	out.append('#include "asf.h"\n#include "Configuration.hpp"\n#include "Icons.hpp"\n')
+	for filename in argv[1:]:
+		out.append('// Icons from ' + os.path.basename(filename) + '\n')
+		for item in read_icons(filename):
+			if isinstance(item, str):
+				out.append(item + '\n')
+				continue
+			name, width, height, pixels = item
+			palette, data = encode(pixels)
+			if decode(palette, data, len(pixels)) != pixels:
+				raise ValueError("Icon %s does not decode correctly" % name)
+			if width > 255 or height > 255:
+				raise ValueError("Icon %s is too large" % name)
+			palette_bytes = []
+			for c in palette:
+				palette_bytes.extend((c & 0xFF, c >> 8))
+			size = 3 + len(palette_bytes) + len(data)
+			out.append('// %d x %d pixels, %d colours, %d bytes (was %d)' % (width, height, len(palette), size, 2 * (2 + len(pixels))))
+			out.append('extern const uint8_t %s[] =\n{\n\t%d, %d,\t\t// width, height\n\t%d,\t\t\t// number of palette entries\n%s\n%s\n};\n'
+						% (name, width, height, len(palette), format_bytes(palette_bytes), format_bytes(data)))
+	out.append('// End')
+	sys.stdout.write('\n'.join(out) + '\n')
+	return 0
+
+if __name__ == '__main__':
+	sys.exit(main(sys.argv))
+
+# End
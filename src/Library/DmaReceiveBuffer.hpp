@@ -0,0 +1,136 @@
+/*
+ * DmaReceiveBuffer.hpp
+ *
+ * Created: 16/10/2026 15:41:08
+ */
+
+
+#ifndef DMARECEIVEBUFFER_H_
+#define DMARECEIVEBUFFER_H_
+
+#include "ecv.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Receive buffer that a peripheral DMA controller fills in fixed-size blocks.
+// The DMA controller is always filling one block and has the following one queued. When it finishes a block, the ISR calls BlockDone
+// to get the block to queue after the one it has just started on. The main loop calls GetData to fetch whatever has arrived since its last call,
+// including data in the block that is still being filled, so that a message is handed over promptly even if the line goes idle part way through a block.
+// Because the queued block may reuse the memory of the oldest block, we only hand out data that is at least one block away from being overwritten.
+// So the caller can fall behind by (numBlocks - 1) blocks, and once it has fetched the number of characters written it has at least another block's
+// worth of reception time to process the data that GetData hands out in place.
+// This class knows nothing about the hardware, so that the hand-over logic can be exercised with a simulated UART.
+class DmaReceiveBuffer
+{
+public:
+	static const size_t blockSize = 512;
+	static const size_t numBlocks = 4;
+	static const size_t bufferSize = blockSize * numBlocks;
+
+	DmaReceiveBuffer() : blocksDone(0), bytesRead(0) { }
+
+	// Start again with an empty buffer. The DMA controller must then be given GetBlock(0) to fill and GetBlock(1) as the next block.
+	void Reset()
+	{
+		blocksDone = 0;
+		bytesRead = 0;
+	}
+
+	char * array GetBlock(uint32_t n)
+	{
+		return buffer + (n % numBlocks) * blockSize;
+	}
+
+	// Called by the ISR when the DMA controller has filled a block and moved on to the next one. Returns the block to queue after that.
+	char * array BlockDone()
+	{
+		++blocksDone;
+		return GetBlock(blocksDone + 1);
+	}
+
+	// Return the total number of characters received, given the number that the DMA controller has still to write to its current block.
+	// The caller must make sure that no call to BlockDone is pending and that none happens while this is called.
+	uint32_t GetBytesWritten(size_t remaining) const
+	{
+		return blocksDone * blockSize + (blockSize - remaining);
+	}
+
+	// Return the total number of characters handed out by GetData
+	uint32_t GetBytesRead() const
+	{
+		return bytesRead;
+	}
+
+	// Return true if the character at total position 'pos' is still in the buffer, allowing for the DMA controller having moved on by up to a block
+	// since 'bytesWritten' was fetched
+	bool IsAvailable(uint32_t pos, uint32_t bytesWritten) const
+	{
+		return bytesWritten - pos <= bufferSize - blockSize;
+	}
+
+	// Copy 'len' characters starting at total position 'pos' to 'dst'
+	void Copy(uint32_t pos, size_t len, char * array dst) const
+	{
+		const size_t first = pos % bufferSize;
+		if (first + len <= bufferSize)
+		{
+			memcpy(dst, buffer + first, len);
+		}
+		else
+		{
+			const size_t len1 = bufferSize - first;
+			memcpy(dst, buffer + first, len1);
+			memcpy(dst + len1, buffer, len - len1);
+		}
+	}
+
+	// Return a pointer to 'len' characters starting at total position 'pos', followed by room for a null terminator in place of the next character.
+	// Normally this points into the buffer. If the characters wrap round the end of the buffer, they are copied to 'scratch' which has room for
+	// 'scratchSize' characters, and 'len' is reduced if there isn't room for them all.
+	char * array GetToken(uint32_t pos, size_t& len, char * array scratch, size_t scratchSize)
+	{
+		const size_t first = pos % bufferSize;
+		if (first + len < bufferSize)
+		{
+			return buffer + first;
+		}
+		if (len >= scratchSize)
+		{
+			len = scratchSize - 1;
+		}
+		Copy(pos, len, scratch);
+		return scratch;
+	}
+
+	// Get the next run of unread characters, given the total number written. The run stops at the end of the buffer, so if the data wraps round
+	// a second call is needed to get the rest. If the DMA controller may already be writing over characters that we hadn't read, skip everything
+	// received so far and set 'overrun'. Returns the number of characters, which the caller must process before calling this again.
+	size_t GetData(uint32_t bytesWritten, const char * array & data, bool& overrun)
+	{
+		overrun = !IsAvailable(bytesRead, bytesWritten);
+		if (overrun)
+		{
+			bytesRead = bytesWritten;
+			return 0;
+		}
+		const size_t start = bytesRead % bufferSize;
+		size_t len = bytesWritten - bytesRead;
+		if (len > bufferSize - start)
+		{
+			len = bufferSize - start;
+		}
+		data = buffer + start;
+		bytesRead += len;
+		return len;
+	}
+
+private:
+	char buffer[bufferSize];
+	volatile uint32_t blocksDone;		// only written by the ISR once the DMA controller is running
+	uint32_t bytesRead;
+};
+
+#endif /* DMARECEIVEBUFFER_H_ */
+
+// End
@@ -0,0 +1,271 @@
+/*
+ * JsonValue.cpp
+ *
+ * Created: 16/10/2026 16:21:02
+ */
+
+#include <cmath>
+#include "ecv.h"
+#include "JsonValue.hpp"
+
+// Numbers are parsed here in a single pass instead of using strtol, strtoul and strtof. Those are slow, they pull in a lot of library code,
+// and strtod in particular is buggy on some long inputs. We accept the JSON number format, which is what the firmware sends:
+// an optional '-', one or more digits, optionally '.' followed by one or more digits, and optionally 'e' or 'E', an optional sign and one or more digits.
+
+const unsigned int maxSignificantDigits = 9;		// the most that we can be sure of fitting in a uint32_t
+const int maxExponent = 100;						// larger exponents are clamped to this, which overflows or underflows a float anyway
+
+static const float powersOfTen[] = { 1.0e0f, 1.0e1f, 1.0e2f, 1.0e3f, 1.0e4f, 1.0e5f, 1.0e6f, 1.0e7f, 1.0e8f, 1.0e9f, 1.0e10f };	// all exactly representable as floats
+const int maxPowerOfTen = 10;
+
+static inline bool IsDigit(char c)
+{
+	return c >= '0' && c <= '9';
+}
+
+// Try to get an integer value. If it is actually a floating point value, round it to the nearest integer, with halves rounded away from zero.
+bool JsonValue::GetInteger(int& rslt) const
+{
+	const char * array p = chars;
+	const char * array const end = chars + len;
+	const bool negative = (p != end && *p == '-');
+	if (negative)
+	{
+		++p;
+	}
+	if (p == end || !IsDigit(*p))
+	{
+		return false;
+	}
+
+	// The largest magnitude we can return is 2^31 if the value is negative, else 2^31 - 1
+	const uint32_t limit = (negative) ? 0x80000000u : 0x7FFFFFFFu;
+	uint32_t val = 0;
+	do
+	{
+		const uint32_t digit = (uint32_t)(*p++ - '0');
+		if (val > (limit - digit)/10)
+		{
+			return HasExponent() && GetRoundedFloat(rslt);		// too big for an int, unless it has a negative exponent
+		}
+		val = (val * 10) + digit;
+	} while (p != end && IsDigit(*p));
+
+	if (p != end && *p == '.')
+	{
+		// Only the first digit after the decimal point affects the rounding, but the rest must still be digits
+		++p;
+		if (p == end || !IsDigit(*p))
+		{
+			return false;
+		}
+		if (*p >= '5')
+		{
+			if (val == limit)
+			{
+				return HasExponent() && GetRoundedFloat(rslt);
+			}
+			++val;
+		}
+		do
+		{
+			++p;
+		} while (p != end && IsDigit(*p));
+	}
+
+	if (p != end)
+	{
+		return GetRoundedFloat(rslt);			// it may have an exponent
+	}
+
+	rslt = (negative) ? (int)(0u - val) : (int)val;
+	return true;
+}
+
+// Return true if the value has an exponent. Without one, a value that overflows the integer part can't be brought back into range, and we
+// mustn't leave it to GetRoundedFloat because a float can't tell values near the limits apart.
+bool JsonValue::HasExponent() const
+{
+	for (size_t i = 0; i < len; ++i)
+	{
+		if (chars[i] == 'e' || chars[i] == 'E')
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// Parse the value as a float and round it to the nearest integer. We only do this for values with an exponent, which are rare.
+bool JsonValue::GetRoundedFloat(int& rslt) const
+{
+	float f;
+	if (!GetFloat(f) || f >= 2147483648.0f || f < -2147483648.0f)
+	{
+		return false;
+	}
+	rslt = (int)roundf(f);					// adding 0.5 would round again when f is 2^23 or more, or just below a half
+	return true;
+}
+
+// Try to get an unsigned integer value
+bool JsonValue::GetUnsignedInteger(unsigned int& rslt) const
+{
+	if (len == 0)
+	{
+		return false;
+	}
+
+	uint32_t val = 0;
+	for (size_t i = 0; i < len; ++i)
+	{
+		if (!IsDigit(chars[i]))
+		{
+			return false;
+		}
+		const uint32_t digit = (uint32_t)(chars[i] - '0');
+		if (val > (0xFFFFFFFFu - digit)/10)
+		{
+			return false;						// too big for an unsigned int
+		}
+		val = (val * 10) + digit;
+	}
+	rslt = val;
+	return true;
+}
+
+// Try to get a floating point value.
+// We keep up to 9 significant digits as an integer mantissa, rounding at the next digit, along with a power of ten.
+// Converting the mantissa to float is exact when it has 7 or fewer digits, and the power of ten is exact for exponents up to 10, so for typical values
+// we do one correctly-rounded multiply or divide and get the same result as strtof. Otherwise there may be two or three roundings, so the result can be a few units in the last place out.
+bool JsonValue::GetFloat(float& rslt) const
+{
+	const char * array p = chars;
+	const char * array const end = chars + len;
+	const bool negative = (p != end && *p == '-');
+	if (negative)
+	{
+		++p;
+	}
+	if (p == end || !IsDigit(*p))
+	{
+		return false;
+	}
+
+	uint32_t mantissa = 0;
+	unsigned int numSignificantDigits = 0;
+	int exponent = 0;
+	bool roundUp = false;
+
+	// Integer part
+	do
+	{
+		const uint32_t digit = (uint32_t)(*p++ - '0');
+		if (numSignificantDigits < maxSignificantDigits)
+		{
+			mantissa = (mantissa * 10) + digit;
+			if (mantissa != 0)
+			{
+				++numSignificantDigits;			// leading zeros are not significant
+			}
+		}
+		else
+		{
+			if (numSignificantDigits == maxSignificantDigits)
+			{
+				roundUp = (digit >= 5);
+				++numSignificantDigits;			// so that we only look at the first digit that we drop
+			}
+			if (exponent < maxExponent)
+			{
+				++exponent;
+			}
+		}
+	} while (p != end && IsDigit(*p));
+
+	// Fractional part
+	if (p != end && *p == '.')
+	{
+		++p;
+		if (p == end || !IsDigit(*p))
+		{
+			return false;
+		}
+		do
+		{
+			const uint32_t digit = (uint32_t)(*p++ - '0');
+			if (numSignificantDigits < maxSignificantDigits)
+			{
+				mantissa = (mantissa * 10) + digit;
+				if (mantissa != 0)
+				{
+					++numSignificantDigits;
+				}
+				if (exponent > -maxExponent)
+				{
+					--exponent;
+				}
+			}
+			else if (numSignificantDigits == maxSignificantDigits)
+			{
+				roundUp = (digit >= 5);
+				++numSignificantDigits;
+			}
+		} while (p != end && IsDigit(*p));
+	}
+
+	// Exponent
+	if (p != end && (*p == 'e' || *p == 'E'))
+	{
+		++p;
+		const bool negativeExponent = (p != end && *p == '-');
+		if (p != end && (*p == '-' || *p == '+'))
+		{
+			++p;
+		}
+		if (p == end || !IsDigit(*p))
+		{
+			return false;
+		}
+		int e = 0;
+		do
+		{
+			if (e < maxExponent)
+			{
+				e = (e * 10) + (*p - '0');
+			}
+			++p;
+		} while (p != end && IsDigit(*p));
+		exponent += (negativeExponent) ? -e : e;
+	}
+
+	if (p != end)
+	{
+		return false;
+	}
+
+	if (roundUp)
+	{
+		++mantissa;								// this can't overflow because the mantissa has at most 9 digits
+	}
+
+	float f = (float)mantissa;
+	if (mantissa != 0)
+	{
+		while (exponent > maxPowerOfTen)
+		{
+			f *= powersOfTen[maxPowerOfTen];
+			exponent -= maxPowerOfTen;
+		}
+		while (exponent < -maxPowerOfTen)
+		{
+			f /= powersOfTen[maxPowerOfTen];
+			exponent += maxPowerOfTen;
+		}
+		f = (exponent >= 0) ? f * powersOfTen[exponent] : f / powersOfTen[-exponent];
+	}
+	rslt = (negative) ? -f : f;
+	return true;
+}
+
+// End
@@ -0,0 +1,59 @@
+/*
+ * JsonValue.hpp
+ *
+ * Created: 16/10/2026 16:20:34
+ */
+
+
+#ifndef JSONVALUE_H_
+#define JSONVALUE_H_
+
+#include "ecv.h"
+#include <cstddef>
+#include <cstdint>
+
+// A value received from the printer. It points directly into the receive buffer, so it is only valid until the function that it was passed to returns.
+// The characters are followed by a null terminator. String values have already had their escape sequences and combining characters processed.
+class JsonValue
+{
+public:
+	JsonValue(const char * array p, size_t n) : chars(p), len(n) { }
+
+	const char * array c_str() const { return chars; }
+	size_t size() const { return len; }
+	bool IsEmpty() const { return len == 0; }
+	char operator[](size_t i) const pre(i <= len) { return chars[i]; }
+
+	bool GetInteger(int& rslt) const;
+	bool GetUnsignedInteger(unsigned int& rslt) const;
+	bool GetFloat(float& rslt) const;
+
+private:
+	bool HasExponent() const;
+	bool GetRoundedFloat(int& rslt) const;
+
+	const char * array chars;
+	size_t len;
+};
+
+// Case-insensitive hash of the ID of a received value (32-bit FNV-1a of the lower-case characters).
+// The parser builds it up one character at a time as it reads the ID. The code that handles the IDs uses the constexpr Hash function for its case labels,
+// so the compiler works out the hashes of the names and reports it if two of them are the same.
+namespace JsonKey
+{
+	const uint32_t initialHash = 2166136261u;
+
+	constexpr uint32_t AddChar(uint32_t hash, char c)
+	{
+		return (hash ^ (uint8_t)(c | 0x20)) * 16777619u;
+	}
+
+	constexpr uint32_t Hash(const char * array s, uint32_t hash = initialHash)
+	{
+		return (*s == 0) ? hash : Hash(s + 1, AddChar(hash, *s));
+	}
+}
+
+#endif /* JSONVALUE_H_ */
+
+// End
@@ -0,0 +1,86 @@
+/*
+ * Utf8Decoder.hpp
+ *
+ * Created: 16/10/2026 09:12:40
+ */ 
+
+
+#ifndef UTF8DECODER_H_
+#define UTF8DECODER_H_
+
+#include <cstdint>
+
+// Class to decode a stream of UTF8 bytes into the 8-bit character codes that our fonts use.
+// Characters that can't be represented in 8 bits and malformed sequences are returned as 0x7F.
+class Utf8Decoder
+{
+public:
+	static const int noChar = -1;
+
+	Utf8Decoder() : charVal(0), numContinuationBytesLeft(0) { }
+
+	void Reset() { numContinuationBytesLeft = 0; }
+
+	// Process a byte. Return the decoded character if we have a complete one, else noChar.
+	int Process(uint8_t c)
+	{
+		if (numContinuationBytesLeft == 0)
+		{
+			if (c < 0x80)
+			{
+				return c;
+			}
+			else if ((c & 0xE0) == 0xC0)
+			{
+				charVal = (uint32_t)(c & 0x1F);
+				numContinuationBytesLeft = 1;
+			}
+			else if ((c & 0xF0) == 0xE0)
+			{
+				charVal = (uint32_t)(c & 0x0F);
+				numContinuationBytesLeft = 2;
+			}
+			else if ((c & 0xF8) == 0xF0)
+			{
+				charVal = (uint32_t)(c & 0x07);
+				numContinuationBytesLeft = 3;
+			}
+			else if ((c & 0xFC) == 0xF8)
+			{
+				charVal = (uint32_t)(c & 0x03);
+				numContinuationBytesLeft = 4;
+			}
+			else if ((c & 0xFE) == 0xFC)
+			{
+				charVal = (uint32_t)(c & 0x01);
+				numContinuationBytesLeft = 5;
+			}
+			else
+			{
+				return 0x7F;
+			}
+			return noChar;
+		}
+
+		if ((c & 0xC0) == 0x80)
+		{
+			charVal = (charVal << 6) | (c & 0x3F);
+			--numContinuationBytesLeft;
+			return (numContinuationBytesLeft != 0) ? noChar
+					: (charVal < 0x100) ? (int)charVal
+						: 0x7F;
+		}
+
+		// Bad UTF8 state
+		numContinuationBytesLeft = 0;
+		return 0x7F;
+	}
+
+private:
+	uint32_t charVal;
+	uint8_t numContinuationBytesLeft;
+};
+
+#endif /* UTF8DECODER_H_ */
+
+// End
@@ -61,6 +61,8 @@ const uint32_t errorBeepLength = 100;
 const uint32_t errorBeepFrequency = 2250;
 const uint32_t longTouchDelay = 250;				// how long we ignore new touches for after pressing Set
 const uint32_t shortTouchDelay = 100;				// how long we ignore new touches while pressing up/down, to get a reasonable repeat rate
+const uint32_t touchReleaseTime = 40;				// how long the touch panel must read no touch before a touch on the file list has ended
+const uint32_t refreshBudget = 10;					// how long we may spend redrawing changed fields in each pass through the main loop, in milliseconds
 const size_t maxUserCommandLength = 40;				// max length of a user gcode command
 const size_t numUserCommandBuffers = 6;				// number of command history buffers plus one
 
@@ -74,8 +76,11 @@ const char* array null currentFile;					// file whose info is displayed in the f
 
 static uint32_t lastTouchTime;
 static uint32_t ignoreTouchTime;
+static ButtonPress listTouch;						// the touch on the file list that is in progress, if any
+static uint32_t lastListTouchTime;					// when we last saw that touch
 static uint32_t lastPollTime;
 static uint32_t lastResponseTime = 0;
+static uint32_t lastChartSampleTime = 0;
 static bool gotMachineName = false;
 static bool isDelta = false;
 static bool gotGeometry = false;
@@ -88,7 +93,6 @@ static unsigned int messageSeq = 0;
 static unsigned int newMessageSeq = 0;
 static int oldIntValue;
 static bool keyboardIsDisplayed = false;
-static bool restartNeeded = false;
 
 static int timesLeft[3];
 static String<50> timesLeftText;
@@ -161,48 +165,6 @@ const char *statusText[] =
 
 static PrinterStatus status = PrinterStatus::connecting;
 
-enum ReceivedDataEvent
-{
-	rcvUnknown = 0,
-	rcvActive,
-	rcvAxes,
-	rcvDir,
-	rcvErr,
-	rcvEfactor,
-	rcvFilament,
-	rcvFiles,
-	rcvHeaters,
-	rcvHomed,
-	rcvHstat,
-	rcvPos,
-	rcvStandby,
-	rcvBeepFreq,
-	rcvBeepLength,
-	rcvFanPercent,
-	rcvFilename,
-	rcvFraction,
-	rcvGeneratedBy,
-	rcvGeometry,
-	rcvHeight,
-	rcvLayerHeight,
-	rcvMessage,
-	rcvMyName,
-	rcvProbe,
-	rcvResponse,
-	rcvSeq,
-	rcvSfactor,
-	rcvSize,
-	rcvStatus,
-	rcvTimesLeft,
-	rcvVolumes
-};
-
-struct ReceiveDataTableEntry
-{
-	ReceivedDataEvent rde;
-	const char* varName;
-};
-
 static Event eventToConfirm = evNull;
 
 int heaterStatus[maxHeaters];
@@ -279,30 +241,6 @@ bool PrintInProgress()
 	return status == PrinterStatus::printing || status == PrinterStatus::paused || status == PrinterStatus::pausing || status == PrinterStatus::resuming;
 }
 
-// Search an ordered table for a matching string
-ReceivedDataEvent bsearch(const ReceiveDataTableEntry array table[], size_t numElems, const char* key)
-{
-	size_t low = 0u, high = numElems;
-	while (high > low)
-	{
-		const size_t mid = (high - low)/2 + low;
-		const int t = strcasecmp(key, table[mid].varName);
-		if (t == 0)
-		{
-			return table[mid].rde;
-		}
-		if (t > 0)
-		{
-			low = mid + 1u;
-		}
-		else
-		{
-			high = mid;
-		}
-	}
-	return (low < numElems && strcasecmp(key, table[low].varName) == 0) ? table[low].rde : rcvUnknown;
-}
-
 // Return true if sending a command or file list request to the printer now is a good idea.
 // We don't want to send these when the printer is busy with a previous command, because they will block normal status requests.
 bool OkToSend()
@@ -456,7 +394,7 @@ void CalibrateTouch()
 
 void CheckSettingsAreSaved()
 {
-	Fields::SettingsAreSaved(nvData == savedNvData, nvData.colourScheme != savedNvData.colourScheme);
+	Fields::SettingsAreSaved(nvData == savedNvData);
 }
 
 // Factory reset
@@ -489,11 +427,6 @@ void PopupAreYouSure(Event ev, const char* text, const char* query = "Are you su
 	mgr.SetPopup(areYouSurePopup, (DisplayX - areYouSurePopupWidth)/2, (DisplayY - areYouSurePopupHeight)/2);
 }
 
-void PopupRestart()
-{
-	PopupAreYouSure(evRestart, "Restart required", "Restart now?");
-}
-
 void Adjusting(ButtonPress bp)
 {
 	fieldBeingAdjusted = bp;
@@ -675,6 +608,10 @@ void ProcessTouch(ButtonPress bp)
 			}
 			break;
 
+		case evTemperatureChart:
+			mgr.SetPopup(temperatureChartPopup, fullWidthPopupX, margin);
+			break;
+
 		case evMovePopup:
 			mgr.SetPopup(movePopup, movePopupX, movePopupY);
 			break;
@@ -752,10 +689,6 @@ void ProcessTouch(ButtonPress bp)
 
 		case evSaveSettings:
 			SaveSettings();
-			if (restartNeeded)
-			{
-				PopupRestart();
-			}
 			break;
 
 		case evSelectHead:
@@ -974,8 +907,11 @@ void ProcessTouch(ButtonPress bp)
 
 		case evAdjustColours:
 			nvData.colourScheme = bp.GetIParam();
-			coloursButton->SetText(colourSchemes[nvData.colourScheme].name);
+			colours = &colourSchemes[nvData.colourScheme];
+			Fields::SetColourScheme(*colours);
+			coloursButton->SetText(colours->name);
 			CheckSettingsAreSaved();
+			mgr.Refresh(true);								// redraw everything in the new colours, including this popup
 			break;
 
 		case evSetLanguage:
@@ -986,7 +922,8 @@ void ProcessTouch(ButtonPress bp)
 		case evAdjustLanguage:
 			nvData.language = bp.GetIParam();
 			languageButton->SetText(longLanguageNames[nvData.language]);
-			CheckSettingsAreSaved();						// not sure we need this because we are going to reset anyway
+			Fields::SetLanguage(nvData.language);
+			CheckSettingsAreSaved();
 			break;
 
 		case evYes:
@@ -1115,18 +1052,9 @@ pre(bp.IsValid())
 		case evSetBaudRate:
 		case evSetVolume:
 		case evSetColours:
-			mgr.ClearPopup();
-			StopAdjusting();
-			break;
-
 		case evSetLanguage:
 			mgr.ClearPopup();
 			StopAdjusting();
-			if (nvData.language != savedNvData.language)
-			{
-				restartNeeded = true;
-				PopupRestart();
-			}
 			break;
 		}
 	}
@@ -1319,88 +1247,57 @@ void AppendTimeLeft(int t)
 	}
 }
 
-// Try to get an integer value from a string. If it is actually a floating point value, round it.
-bool GetInteger(const char s[], int &rslt)
-{
-	if (s[0] == 0) return false;			// empty string
-
-	char* endptr;
-	rslt = (int) strtol(s, &endptr, 10);
-	if (*endptr == 0) return true;			// we parsed an integer
-
-	if (strlen(s) > 10) return false;		// avoid strtod buggy behaviour on long input strings
-
-	double d = strtod(s, &endptr);			// try parsing a floating point number
-	if (*endptr == 0)
-	{
-		rslt = (int)((d < 0.0) ? d - 0.5 : d + 0.5);
-		return true;
-	}
-	return false;
-}
-
-// Try to get an unsigned integer value from a string
-bool GetUnsignedInteger(const char s[], unsigned int &rslt)
-{
-	if (s[0] == 0) return false;			// empty string
-	char* endptr;
-	rslt = (int) strtoul(s, &endptr, 10);
-	return *endptr == 0;
-}
+// Macro to make a case of the switch statement in FindReceivedDataEvent. Comparing the ID with the name as well as its hash means that
+// an ID we don't handle can't be mistaken for one that we do.
+#define RECEIVED_DATA_EVENT(_name, _rde)	case JsonKey::Hash(_name): return (strcasecmp(id, _name) == 0) ? _rde : rcvUnknown
 
-// Try to get a floating point value from a string. if it is actually a floating point value, round it.
-bool GetFloat(const char s[], float &rslt)
+// Public function called by the SerialIo module when it has received the ID of a value, to find out how to handle the value.
+// This is called once per ID, so a long array costs one lookup. If two of these names ever have the same hash, the compiler will report duplicate case values.
+ReceivedDataEvent FindReceivedDataEvent(uint32_t hash, const char id[])
 {
-	if (s[0] == 0) return false;			// empty string
-
-	// GNU strtod is buggy, it's very slow for some long inputs, and some versions have a buffer overflow bug.
-	// We presume strtof may be buggy too. Tame it by rejecting any strings that much longer than we expect to receive.
-	if (strlen(s) > 10) return false;
+	switch (hash)
+	{
+	// Values that are received as arrays
+	RECEIVED_DATA_EVENT("active", rcvActive);
+	RECEIVED_DATA_EVENT("efactor", rcvEfactor);
+	RECEIVED_DATA_EVENT("fanPercent", rcvFanPercent);
+	RECEIVED_DATA_EVENT("filament", rcvFilament);
+	RECEIVED_DATA_EVENT("files", rcvFiles);
+	RECEIVED_DATA_EVENT("heaters", rcvHeaters);
+	RECEIVED_DATA_EVENT("homed", rcvHomed);
+	RECEIVED_DATA_EVENT("hstat", rcvHstat);
+	RECEIVED_DATA_EVENT("pos", rcvPos);
+	RECEIVED_DATA_EVENT("standby", rcvStandby);
+	RECEIVED_DATA_EVENT("timesLeft", rcvTimesLeft);
+
+	// Values that are not received as arrays
+	RECEIVED_DATA_EVENT("axes", rcvAxes);
+	RECEIVED_DATA_EVENT("beep_freq", rcvBeepFreq);
+	RECEIVED_DATA_EVENT("beep_length", rcvBeepLength);
+	RECEIVED_DATA_EVENT("dir", rcvDir);
+	RECEIVED_DATA_EVENT("err", rcvErr);
+	RECEIVED_DATA_EVENT("fileName", rcvFilename);
+	RECEIVED_DATA_EVENT("fraction_printed", rcvFraction);
+	RECEIVED_DATA_EVENT("generatedBy", rcvGeneratedBy);
+	RECEIVED_DATA_EVENT("geometry", rcvGeometry);
+	RECEIVED_DATA_EVENT("height", rcvHeight);
+	RECEIVED_DATA_EVENT("layerHeight", rcvLayerHeight);
+	RECEIVED_DATA_EVENT("message", rcvMessage);
+	RECEIVED_DATA_EVENT("myName", rcvMyName);
+	RECEIVED_DATA_EVENT("probe", rcvProbe);
+	RECEIVED_DATA_EVENT("resp", rcvResponse);
+	RECEIVED_DATA_EVENT("seq", rcvSeq);
+	RECEIVED_DATA_EVENT("sfactor", rcvSfactor);
+	RECEIVED_DATA_EVENT("size", rcvSize);
+	RECEIVED_DATA_EVENT("status", rcvStatus);
+	RECEIVED_DATA_EVENT("volumes", rcvVolumes);
 
-	char* endptr;
-	rslt = strtof(s, &endptr);
-	return *endptr == 0;					// we parsed a float
+	default:
+		return rcvUnknown;
+	}
 }
 
-// These tables must be kept in alphabetical order of the search string
-const ReceiveDataTableEntry arrayDataTable[] =
-{
-	{ rcvActive,		"active" },
-	{ rcvEfactor,		"efactor" },
-	{ rcvFanPercent,	"fanPercent" },
-	{ rcvFilament,		"filament" },
-	{ rcvFiles,			"files" },
-	{ rcvHeaters,		"heaters" },
-	{ rcvHomed,			"homed" },
-	{ rcvHstat,			"hstat" },
-	{ rcvPos,			"pos" },
-	{ rcvStandby,		"standby" },
-	{ rcvTimesLeft,		"timesLeft" }
-};
-
-const ReceiveDataTableEntry nonArrayDataTable[] =
-{
-	{ rcvAxes,			"axes" },
-	{ rcvBeepFreq,		"beep_freq" },
-	{ rcvBeepLength,	"beep_length" },
-	{ rcvDir,			"dir" },
-	{ rcvErr,			"err" },
-	{ rcvFilename,		"fileName" },
-	{ rcvFraction,		"fraction_printed" },
-	{ rcvGeneratedBy,	"generatedBy" },
-	{ rcvGeometry,		"geometry" },
-	{ rcvHeight,		"height" },
-	{ rcvLayerHeight,	"layerHeight" },
-	{ rcvMessage,		"message" },
-	{ rcvMyName,		"myName" },
-	{ rcvProbe,			"probe" },
-	{ rcvResponse,		"resp" },
-	{ rcvSeq,			"seq" },
-	{ rcvSfactor,		"sfactor" },
-	{ rcvSize,			"size" },
-	{ rcvStatus,		"status" },
-	{ rcvVolumes,		"volumes" }
-};
+#undef RECEIVED_DATA_EVENT
 
 void StartReceivedMessage()
 {
@@ -1411,10 +1308,32 @@ void StartReceivedMessage()
 	ShowLine;
 }
 
+// Add the temperature of each heater that we know about to the temperature chart, along with the temperature it is aiming for if it is on
+static void RecordTemperatures()
+{
+	for (unsigned int i = 0; i <= numHeads && i < maxHeaters; ++i)
+	{
+		temperatureChart->SetValue(i, currentTemps[i]->GetValue());
+		const int target = (heaterStatus[i] == 2) ? activeTemps[i]->GetValue()
+							: (heaterStatus[i] == 1) ? standbyTemps[i]->GetValue()
+								: 0;
+		if (target > 0)
+		{
+			temperatureChart->SetTarget(i, target);
+		}
+	}
+	temperatureChart->AddSample();
+}
+
 void EndReceivedMessage()
 {
 	ShowLine;
 	lastResponseTime = SystemTick::GetTickCount();
+	if (lastResponseTime - lastChartSampleTime >= chartSampleInterval)
+	{
+		RecordTemperatures();
+		lastChartSampleTime = lastResponseTime;
+	}
 
 	if (newMessageSeq != messageSeq)
 	{
@@ -1426,18 +1345,18 @@ void EndReceivedMessage()
 }
 
 // Public functions called by the SerialIo module
-void ProcessReceivedValue(const char id[], const char data[], int index)
+void ProcessReceivedValue(ReceivedDataEvent rde, const JsonValue& data, int index)
 {
 	if (index >= 0)			// if this is an element of an array
 	{
 		ShowLine;
-		switch(bsearch(arrayDataTable, sizeof(arrayDataTable)/sizeof(arrayDataTable[0]), id))
+		switch(rde)
 		{
 		case rcvActive:
 			ShowLine;
 			{
 				int ival;
-				if (GetInteger(data, ival) && index < (int)maxHeaters)
+				if (data.GetInteger(ival) && index < (int)maxHeaters)
 				{
 					UpdateField(activeTemps[index], ival);
 				}
@@ -1448,7 +1367,7 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 			ShowLine;
 			{
 				int ival;
-				if (GetInteger(data, ival) && index < (int)maxHeaters && index != 0)
+				if (data.GetInteger(ival) && index < (int)maxHeaters && index != 0)
 				{
 					UpdateField(standbyTemps[index], ival);
 				}
@@ -1459,7 +1378,7 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 			ShowLine;
 			{
 				float fval;
-				if (GetFloat(data, fval) && index < (int)maxHeaters)
+				if (data.GetFloat(fval) && index < (int)maxHeaters)
 				{
 					ShowLine;
 					currentTemps[index]->SetValue(fval);
@@ -1480,15 +1399,14 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 			ShowLine;
 			{
 				int ival;
-				if (GetInteger(data, ival) && index < (int)maxHeaters)
+				if (data.GetInteger(ival) && index < (int)maxHeaters)
 				{
 					heaterStatus[index] = ival;
-					Colour c = (ival == 1) ? colours->standbyBackColour
-								: (ival == 2) ? colours->activeBackColour
-								: (ival == 3) ? colours->errorBackColour
-								: (ival == 4) ? colours->tuningBackColour
-								: colours->defaultBackColour;
-					currentTemps[index]->SetColours((ival == 3) ? colours->errorTextColour : colours->infoTextColour, c);
+					currentTemps[index]->SetStyle((ival == 1) ? styleHeaterStandby
+													: (ival == 2) ? styleHeaterActive
+													: (ival == 3) ? styleError
+													: (ival == 4) ? styleHeaterTuning
+													: styleInfo);
 				}
 			}
 			break;
@@ -1497,7 +1415,7 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 			ShowLine;
 			{
 				float fval;
-				if (GetFloat(data, fval) && index < MAX_AXES)
+				if (data.GetFloat(fval) && index < MAX_AXES)
 				{
 					axisPos[index]->SetValue(fval);
 				}
@@ -1508,7 +1426,7 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 			ShowLine;
 			{
 				int ival;
-				if (GetInteger(data, ival) && index + 1 < (int)maxHeaters)
+				if (data.GetInteger(ival) && index + 1 < (int)maxHeaters)
 				{
 					UpdateField(extrusionFactors[index], ival);
 				}
@@ -1521,7 +1439,7 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 			{
 				FileManager::BeginReceivingFiles();
 			}
-			FileManager::ReceiveFile(data);
+			FileManager::ReceiveFile(data.c_str());
 			break;
 		
 		case rcvFilament:
@@ -1533,7 +1451,7 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 					totalFilament = 0.0;
 				}
 				float f;
-				if (GetFloat(data, f))
+				if (data.GetFloat(f))
 				{
 					totalFilament += f;
 					fpFilamentField->SetValue((int)totalFilament);
@@ -1545,13 +1463,13 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 			ShowLine;
 			{
 				int ival;
-				if (index < MAX_AXES && GetInteger(data, ival) && ival >= 0 && ival < 2)
+				if (index < MAX_AXES && data.GetInteger(ival) && ival >= 0 && ival < 2)
 				{
 					bool isHomed = (ival == 1);
 					if (isHomed != axisHomed[index])
 					{
 						axisHomed[index] = isHomed;
-						homeButtons[index]->SetColours(colours->buttonTextColour, (isHomed) ? colours->homedButtonBackColour : colours->notHomedButtonBackColour);
+						homeButtons[index]->SetStyle((isHomed) ? styleHomedButton : styleNotHomedButton);
 						bool allHomed = true;
 						for (size_t i = 0; i < numAxes; ++i)
 						{
@@ -1564,7 +1482,7 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 						if (allHomed != allAxesHomed)
 						{
 							allAxesHomed = allHomed;
-							homeAllButton->SetColours(colours->buttonTextColour, (allAxesHomed) ? colours->homedButtonBackColour : colours->notHomedButtonBackColour);
+							homeAllButton->SetStyle((allAxesHomed) ? styleHomedButton : styleNotHomedButton);
 						}
 					}
 				}
@@ -1576,7 +1494,7 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 			if (index < (int)ARRAY_SIZE(timesLeft))
 			{
 				int i;
-				bool b = GetInteger(data, i);
+				bool b = data.GetInteger(i);
 				if (b && i >= 0 && i < 10 * 24 * 60 * 60 && PrintInProgress())
 				{
 					timesLeft[index] = i;
@@ -1600,7 +1518,7 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 			if (index == 0)			// currently we only handle one fan
 			{
 				float f;
-				bool b = GetFloat(data, f);
+				bool b = data.GetFloat(f);
 				if (b && f >= 0.0 && f <= 100.0)
 				{
 					UpdateField(fanSpeed, (int)(f + 0.5));
@@ -1616,12 +1534,12 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 	{
 		ShowLine;
 		// Non-array values follow
-		switch(bsearch(nonArrayDataTable, sizeof(nonArrayDataTable)/sizeof(nonArrayDataTable[0]), id))
+		switch(rde)
 		{
 		case rcvSfactor:
 			{
 				int ival;
-				if (GetInteger(data, ival))
+				if (data.GetInteger(ival))
 				{
 					UpdateField(spd, ival);
 				}
@@ -1629,14 +1547,14 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 			break;
 
 		case rcvProbe:
-			zprobeBuf.copy(data);
+			zprobeBuf.copy(data.c_str());
 			zProbe->SetChanged();
 			break;
 		
 		case rcvMyName:
 			if (status != PrinterStatus::configuring && status != PrinterStatus::connecting)
 			{
-				machineName.copy(data);
+				machineName.copy(data.c_str());
 				nameField->SetChanged();
 				gotMachineName = true;
 				if (gotGeometry)
@@ -1647,9 +1565,9 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 			break;
 		
 		case rcvFilename:
-			if (!printingFile.similar(data))
+			if (!printingFile.similar(data.c_str()))
 			{
-				printingFile.copy(data);
+				printingFile.copy(data.c_str());
 				if (currentTab == tabPrint && PrintInProgress())
 				{
 					nameField->SetChanged();
@@ -1661,7 +1579,7 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 		case rcvSize:
 			{
 				int sz;
-				if (GetInteger(data, sz))
+				if (data.GetInteger(sz))
 				{
 					fpSizeField->SetValue(sz);
 				}
@@ -1671,7 +1589,7 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 		case rcvHeight:
 			{
 				float f;
-				if (GetFloat(data, f))
+				if (data.GetFloat(f))
 				{
 					fpHeightField->SetValue(f);
 				}
@@ -1681,7 +1599,7 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 		case rcvLayerHeight:
 			{
 				float f;
-				if (GetFloat(data, f))
+				if (data.GetFloat(f))
 				{
 					fpLayerHeightField->SetValue(f);
 				}
@@ -1689,14 +1607,14 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 			break;
 		
 		case rcvGeneratedBy:
-			generatedByText.copy(data);
+			generatedByText.copy(data.c_str());
 			fpGeneratedByField->SetChanged();
 			break;
 		
 		case rcvFraction:
 			{
 				float f;
-				if (GetFloat(data, f))
+				if (data.GetFloat(f))
 				{
 					if (f >= 0.0 && f <= 1.0)
 					{
@@ -1711,17 +1629,17 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 			break;
 		
 		case rcvBeepFreq:
-			GetInteger(data, beepFrequency);
+			data.GetInteger(beepFrequency);
 			break;
 		
 		case rcvBeepLength:
-			GetInteger(data, beepLength);
+			data.GetInteger(beepLength);
 			break;
 		
 		case rcvGeometry:
 			if (status != PrinterStatus::configuring && status != PrinterStatus::connecting)
 			{
-				isDelta = (strcasecmp(data, "delta") == 0);
+				isDelta = (strcasecmp(data.c_str(), "delta") == 0);
 				gotGeometry = true;
 				if (gotMachineName)
 				{
@@ -1737,36 +1655,38 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 		case rcvAxes:
 			{
 				unsigned int n;
-				GetUnsignedInteger(data, n);
-				numAxes = constrain<unsigned int>(n, MIN_AXES, MAX_AXES);
-				for (size_t i = MIN_AXES; i < MAX_AXES; ++i)
+				if (data.GetUnsignedInteger(n))
 				{
-					mgr.Show(homeButtons[i], !isDelta && i < numAxes);
-					Fields::ShowAxis(i, i < numAxes);
+					numAxes = constrain<unsigned int>(n, MIN_AXES, MAX_AXES);
+					for (size_t i = MIN_AXES; i < MAX_AXES; ++i)
+					{
+						mgr.Show(homeButtons[i], !isDelta && i < numAxes);
+						Fields::ShowAxis(i, i < numAxes);
+					}
 				}
 			}
 			break;
 
 		case rcvSeq:
-			GetUnsignedInteger(data, newMessageSeq);
+			data.GetUnsignedInteger(newMessageSeq);
 			break;
 		
 		case rcvResponse:
-			MessageLog::AppendMessage(data);
+			MessageLog::AppendMessage(data.c_str());
 			break;
 		
 		case rcvDir:
-			FileManager::ReceiveDirectoryName(data);
+			FileManager::ReceiveDirectoryName(data.c_str());
 			break;
 
 		case rcvMessage:
-			if (data[0] == 0)
+			if (data.IsEmpty())
 			{
 				mgr.ClearPopup(true, alertPopup);
 			}
 			else
 			{
-				alertText.copy(data);
+				alertText.copy(data.c_str());
 				mgr.SetPopup(alertPopup, (DisplayX - alertPopupWidth)/2, (DisplayY - alertPopupHeight)/2);
 			}
 			break;
@@ -1774,7 +1694,7 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 		case rcvErr:
 			{
 				int i;
-				if (GetInteger(data, i))
+				if (data.GetInteger(i))
 				{
 					FileManager::ReceiveErrorCode(i);
 				}
@@ -1784,7 +1704,7 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 		case rcvVolumes:
 			{
 				unsigned int i;
-				if (GetUnsignedInteger(data, i))
+				if (data.GetUnsignedInteger(i))
 				{
 					FileManager::SetNumVolumes(i);
 				}
@@ -1799,9 +1719,9 @@ void ProcessReceivedValue(const char id[], const char data[], int index)
 }
 
 // Public function called when the serial I/O module finishes receiving an array of values
-void ProcessArrayLength(const char id[], int length)
+void ProcessArrayLength(ReceivedDataEvent rde, int length)
 {
-	if (length == 0 && strcmp(id, "files") == 0)
+	if (length == 0 && rde == rcvFiles)
 	{
 		FileManager::BeginReceivingFiles();				// received an empty file list - need to tell the file manager about it
 	}
@@ -1926,6 +1846,9 @@ int main(void)
 	while (SystemTick::GetTickCount() - now < 5000) { }		// hold it there for 5 seconds
 #endif
 
+	// Limit the time we spend redrawing fields, so that a burst of status updates doesn't hold up touch and serial input processing
+	mgr.SetRefreshBudget(refreshBudget);
+
 	// Display the Control tab. This also refreshes the display.
 	ChangeTab(tabControl);
 	lastResponseTime = SystemTick::GetTickCount();		// pretend we just received a response
@@ -1949,7 +1872,27 @@ int main(void)
 		ShowLine;
 		
 		// 3. Check for a touch on the touch panel.
-		if (SystemTick::GetTickCount() - lastTouchTime >= ignoreTouchTime)
+		if (listTouch.IsValid())
+		{
+			// A touch on the file list is in progress. The list follows the touch if it moves, else we select the file that was touched when the touch ends.
+			uint16_t x, y;
+			if (touch.read(x, y))
+			{
+				lastListTouchTime = SystemTick::GetTickCount();
+				filenameList->Drag(y, lastListTouchTime);
+			}
+			else if (SystemTick::GetTickCount() - lastListTouchTime >= touchReleaseTime)
+			{
+				if (filenameList->EndDrag(SystemTick::GetTickCount()) && listTouch.GetSParam() != nullptr)
+				{
+					DelayTouchLong();		// by default, ignore further touches for a long time
+					TouchBeep();
+					ProcessTouch(listTouch);
+				}
+				listTouch.Clear();
+			}
+		}
+		else if (SystemTick::GetTickCount() - lastTouchTime >= ignoreTouchTime)
 		{
 			if (currentButton.IsValid())
 			{
@@ -1964,7 +1907,14 @@ int main(void)
 				touchY->SetValue((int)y);	//debug
 #endif
 				ButtonPress bp = mgr.FindEvent(x, y);
-				if (bp.IsValid())
+				if (bp.IsValid() && bp.GetButton() == filenameList)
+				{
+					// We don't know yet whether this is a tap on a file or the start of a drag
+					listTouch = bp;
+					lastListTouchTime = SystemTick::GetTickCount();
+					filenameList->StartDrag(y, lastListTouchTime);
+				}
+				else if (bp.IsValid())
 				{
 					DelayTouchLong();		// by default, ignore further touches for a long time
 					if (bp.GetEvent() != evAdjustVolume)
@@ -1985,7 +1935,8 @@ int main(void)
 		}
 		ShowLine;
 		
-		// 4. Refresh the display
+		// 4. Refresh the display. If the file list is still moving after being dragged, move it on first.
+		filenameList->Animate(SystemTick::GetTickCount());
 		UpdateDebugInfo();
 		mgr.Refresh(false);
 		ShowLine;
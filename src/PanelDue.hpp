@@ -11,10 +11,49 @@
 #include "Hardware/UTFT.hpp"
 #include "Display.hpp"
 #include "RequestTimer.hpp"
+#include "Library/JsonValue.hpp"
+
+// Events that the serial I/O module reports when it receives a value. FindReceivedDataEvent in PanelDue.cpp maps the IDs of received values to these.
+enum ReceivedDataEvent
+{
+	rcvUnknown = 0,
+	rcvActive,
+	rcvAxes,
+	rcvDir,
+	rcvErr,
+	rcvEfactor,
+	rcvFilament,
+	rcvFiles,
+	rcvHeaters,
+	rcvHomed,
+	rcvHstat,
+	rcvPos,
+	rcvStandby,
+	rcvBeepFreq,
+	rcvBeepLength,
+	rcvFanPercent,
+	rcvFilename,
+	rcvFraction,
+	rcvGeneratedBy,
+	rcvGeometry,
+	rcvHeight,
+	rcvLayerHeight,
+	rcvMessage,
+	rcvMyName,
+	rcvProbe,
+	rcvResponse,
+	rcvSeq,
+	rcvSfactor,
+	rcvSize,
+	rcvStatus,
+	rcvTimesLeft,
+	rcvVolumes
+};
 
 // Global functions in PanelDue.cpp that are called from elsewhere
-extern void ProcessReceivedValue(const char id[], const char val[], int index);
-extern void ProcessArrayLength(const char id[], int length);
+extern ReceivedDataEvent FindReceivedDataEvent(uint32_t hash, const char id[]);
+extern void ProcessReceivedValue(ReceivedDataEvent rde, const JsonValue& val, int index);
+extern void ProcessArrayLength(ReceivedDataEvent rde, int length);
 extern void StartReceivedMessage();
 extern void EndReceivedMessage();
 
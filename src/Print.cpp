@@ -84,7 +84,7 @@ size_t Print::print(double n, int digits)
 
 // Private Methods /////////////////////////////////////////////////////////////
 
-size_t Print::printNumber(uint32_t n, uint8_t base)
+size_t Print::printNumber(unsigned long n, uint8_t base)
 {
 	char buf[CHAR_BIT * sizeof(long) + 1];			// the largest buffer is needed when base=2
 	char *str = &buf[sizeof(buf) - 1];